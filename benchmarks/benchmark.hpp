@@ -24,80 +24,69 @@ SOFTWARE.
 
 */
 
-#ifndef SWE_HPP
-#define SWE_HPP 1
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP 1
 
 #include "core.hpp"
 #include "platform.hpp"
 #include "mesh.hpp"
-#include "solver.hpp"
-#include "timeStepper.hpp"
-#include "linAlg.hpp"
+#include "timer.hpp"
+#include <functional>
 
-#define DSWE LIBP_DIR"/solvers/SWEViscosity/"
+#define DBENCHMARK LIBP_DIR"/benchmarks/"
 
 using namespace libp;
 
-class SWESettings_t: public settings_t {
+class benchmarkSettings_t: public settings_t {
 public:
-  SWESettings_t(comm_t _comm);
+  benchmarkSettings_t(comm_t _comm);
   void report();
   void parseFromFile(platformSettings_t& platformSettings,
                      meshSettings_t& meshSettings,
                      const std::string filename);
 };
 
-class SWE_t: public solver_t {
+/* Times the hot kernels in isolation and reports effective bandwidth and
+   throughput, relative to the STREAM triad bandwidth measured on the same
+   device.*/
+class benchmark_t {
 public:
-  mesh_t mesh;
+  platform_t platform;
+  benchmarkSettings_t settings;
+  comm_t comm;
 
-  int Nfields;
-  int Ngrads;
-  int cubature;
-  int curvilinear;
+  int Ntests;
+  std::vector<dlong> vectorSizes;
 
-  timeStepper_t timeStepper;
+  //measured STREAM triad bandwidth, in GB/s
+  double streamBandwidth=0.0;
 
-  ogs::halo_t fieldTraceHalo;
-  ogs::halo_t gradTraceHalo;
+  benchmark_t(platform_t& _platform, benchmarkSettings_t& _settings);
 
-  memory<dfloat> q;
-  deviceMemory<dfloat> o_q;
+  void Run(meshSettings_t& meshSettings);
 
-  memory<dfloat> gradq;
-  deviceMemory<dfloat> o_gradq;
+  //individual kernel groups
+  void Stream();
+  void LinAlg();
+  void TimeStepper();
+  void ParAlmond();
+  void Ogs(mesh_t& mesh);
+  void Elliptic(mesh_t& mesh);
+  void SWE(mesh_t& mesh);
 
-  deviceMemory<dfloat> o_Mq;
+ private:
+  bool Enabled(const std::string group);
 
-  kernel_t volumeKernel;
-  kernel_t surfaceKernel;
-  kernel_t cubatureVolumeKernel;
-  kernel_t cubatureSurfaceKernel;
+  //average time of launch over Ntests, slowest rank
+  double Measure(std::function<void()> launch);
 
-  kernel_t gradVolumeKernel;
-  kernel_t gradSurfaceKernel;
-
-  kernel_t initialConditionKernel;
-
-  SWE_t() = default;
-  SWE_t(platform_t &_platform, mesh_t &_mesh,
-              SWESettings_t& _settings) {
-    Setup(_platform, _mesh, _settings);
-  }
-
-  //setup
-  void Setup(platform_t& _platform, mesh_t& _mesh,
-             SWESettings_t& _settings);
-
-  void Run();
-
-  void Report(dfloat time, int tstep);
-
-  void PlotFields(memory<dfloat> Q, const std::string fileName);
-
-  void rhsf(deviceMemory<dfloat>& o_q, deviceMemory<dfloat>& o_rhs, const dfloat time);
-
-  dfloat MaxWaveSpeed();
+  void ReportHeader(const std::string group);
+  void Report(const std::string kernel, const std::string config,
+              const dlong N, const double time,
+              const double bytes, const double flops);
 };
 
+//readable element type and degree, e.g. "Hex N=4"
+std::string benchmarkMeshConfig(mesh_t& mesh);
+
 #endif
@@ -24,14 +24,14 @@ SOFTWARE.
 
 */
 
-#include "SWEC.hpp"
+#include "benchmark.hpp"
 
 int main(int argc, char **argv){
 
   // start up MPI
   Comm::Init(argc, argv);
 
-  //LIBP_ABORT("Usage: ./SWECMain setupfile", argc!=2);
+  LIBP_ABORT("Usage: ./benchmarkMain setupfile", argc!=2);
 
   { /*Scope so everything is destructed before MPI_Finalize */
     comm_t comm(Comm::World().Dup());
@@ -39,26 +39,24 @@ int main(int argc, char **argv){
     //create default settings
     platformSettings_t platformSettings(comm);
     meshSettings_t meshSettings(comm);
-    SWECSettings_t SWECSettings(comm);
+    benchmarkSettings_t benchmarkSettings(comm);
 
     //load settings from file
-    SWECSettings.parseFromFile(platformSettings, meshSettings,
-                              argv[1],argv[2],argv[3],argv[4]);
+    benchmarkSettings.parseFromFile(platformSettings, meshSettings,
+                                    argv[1]);
 
     // set up platform
     platform_t platform(platformSettings);
-    
+
     platformSettings.report();
-    meshSettings.report();
-    SWECSettings.report();
-    
-    // set up mesh
-    mesh_t mesh(platform, meshSettings, comm);
-    
-    // set up SWEC solver
-    SWEC_t SWEC(platform, mesh, SWECSettings);
-    // run
-    SWEC.Run();
+    benchmarkSettings.report();
+
+    // set up and run the benchmarks
+    benchmark_t benchmark(platform, benchmarkSettings);
+    benchmark.Run(meshSettings);
+
+    //report the profile while every rank is still here, before teardown
+    Profiler::Finalize();
   }
 
   // close down MPI
@@ -0,0 +1,84 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "benchmark.hpp"
+#include "elliptic.hpp"
+
+void benchmark_t::Elliptic(mesh_t& mesh) {
+
+  ReportHeader("elliptic " + benchmarkMeshConfig(mesh));
+
+  ellipticSettings_t ellipticSettings(comm);
+  ellipticSettings.changeSetting("DATA FILE",
+                                 (mesh.dim==2) ? DELLIPTIC "data/ellipticSine2D.h"
+                                               : DELLIPTIC "data/ellipticSine3D.h");
+  ellipticSettings.changeSetting("PRECONDITIONER", "NONE");
+
+  const dfloat lambda = 1.0;
+  memory<int> BCType(3);
+  BCType[0] = 0;
+  BCType[1] = 1;
+  BCType[2] = 2;
+
+  elliptic_t elliptic(platform, mesh, ellipticSettings,
+                      lambda, 3, BCType);
+
+  //apply the operator to every element
+  memory<dlong> elementList(mesh.Nelements);
+  for (dlong e=0;e<mesh.Nelements;++e) elementList[e] = e;
+  deviceMemory<dlong> o_elementList = platform.malloc<dlong>(elementList);
+
+  memory<dfloat> q(elliptic.Ndofs+elliptic.Nhalo, 1.0);
+  deviceMemory<dfloat> o_q = platform.malloc<dfloat>(q);
+
+  double time = Measure([&]() {
+    elliptic.partialAxKernel(mesh.Nelements, o_elementList,
+                             elliptic.o_GlobalToLocal,
+                             elliptic.o_wJAx, elliptic.o_ggeoAx,
+                             mesh.o_D, mesh.o_S, mesh.o_MM,
+                             lambda, o_q, elliptic.o_AqL);
+  });
+
+  const dlong N = mesh.Nelements*mesh.Np;
+  const int dim = mesh.dim;
+  const bool tensor = (mesh.elementType==Mesh::QUADRILATERALS
+                    || mesh.elementType==Mesh::HEXAHEDRA);
+
+  //tensor-product elements carry geometric factors at every node,
+  // simplices carry one set per element
+  double bytes = N*(2*sizeof(dfloat) + sizeof(dlong));
+  double flops;
+  if (tensor) {
+    bytes += static_cast<double>(N)*mesh.Nggeo*sizeof(dfloat);
+    flops  = static_cast<double>(N)*(4*dim*mesh.Nq + 2*dim*dim + 2);
+  } else {
+    bytes += static_cast<double>(mesh.Nelements)*mesh.Nggeo*sizeof(dfloat);
+    flops  = static_cast<double>(N)*2*(dim*(dim+1)/2 + 1)*mesh.Np;
+  }
+
+  Report("Ax " + elliptic.axKernelName, benchmarkMeshConfig(mesh),
+         N, time, bytes, flops);
+}
@@ -0,0 +1,72 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "benchmark.hpp"
+
+void benchmark_t::LinAlg() {
+
+  linAlg_t& linAlg = platform.linAlg();
+  linAlg.InitKernels({"set", "scale", "axpy", "zaxpy", "amxpy",
+                      "norm2", "innerProd", "weightedInnerProd"});
+
+  ReportHeader("linAlg");
+
+  for (const dlong N : vectorSizes) {
+    memory<dfloat> ones(N, 1.0);
+    deviceMemory<dfloat> o_x = platform.malloc<dfloat>(ones);
+    deviceMemory<dfloat> o_y = platform.malloc<dfloat>(ones);
+    deviceMemory<dfloat> o_z = platform.malloc<dfloat>(ones);
+    deviceMemory<dfloat> o_w = platform.malloc<dfloat>(ones);
+
+    const std::string config = "N=" + std::to_string(N);
+    const double vecBytes = N*sizeof(dfloat);
+
+    double time = Measure([&]() { linAlg.set(N, 1.0, o_x); });
+    Report("set", config, N, time, vecBytes, 0.0);
+
+    time = Measure([&]() { linAlg.scale(N, 1.0, o_x); });
+    Report("scale", config, N, time, 2*vecBytes, N);
+
+    time = Measure([&]() { linAlg.axpy(N, 1.0, o_x, 1.0, o_y); });
+    Report("axpy", config, N, time, 3*vecBytes, 3.0*N);
+
+    time = Measure([&]() { linAlg.zaxpy(N, 1.0, o_x, 1.0, o_y, o_z); });
+    Report("zaxpy", config, N, time, 3*vecBytes, 3.0*N);
+
+    time = Measure([&]() { linAlg.amxpy(N, 1.0, o_w, o_x, 1.0, o_y); });
+    Report("amxpy", config, N, time, 4*vecBytes, 4.0*N);
+
+    //reductions include the global sum
+    time = Measure([&]() { linAlg.norm2(N, o_x, comm); });
+    Report("norm2", config, N, time, vecBytes, 2.0*N);
+
+    time = Measure([&]() { linAlg.innerProd(N, o_x, o_y, comm); });
+    Report("innerProd", config, N, time, 2*vecBytes, 2.0*N);
+
+    time = Measure([&]() { linAlg.weightedInnerProd(N, o_w, o_x, o_y, comm); });
+    Report("weightedInnerProd", config, N, time, 3*vecBytes, 3.0*N);
+  }
+}
@@ -24,44 +24,45 @@ SOFTWARE.
 
 */
 
-#include "SWEAV.hpp"
-
-int main(int argc, char **argv){
-
-  // start up MPI
-  Comm::Init(argc, argv);
-
-  //LIBP_ABORT("Usage: ./SWEAVMain setupfile", argc!=2);
-
-  { /*Scope so everything is destructed before MPI_Finalize */
-    comm_t comm(Comm::World().Dup());
-
-    //create default settings
-    platformSettings_t platformSettings(comm);
-    meshSettings_t meshSettings(comm);
-    SWEAVSettings_t SWEAVSettings(comm);
-
-    //load settings from file
-    SWEAVSettings.parseFromFile(platformSettings, meshSettings,
-                              argv[1]);
-
-    // set up platform
-    platform_t platform(platformSettings);
-    
-    platformSettings.report();
-    meshSettings.report();
-    SWEAVSettings.report();
-    
-    // set up mesh
-    mesh_t mesh(platform, meshSettings, comm);
-    
-    // set up SWEAV solver
-    SWEAV_t SWEAV(platform, mesh, SWEAVSettings);
-    // run
-    SWEAV.Run();
-  }
-
-  // close down MPI
-  Comm::Finalize();
-  return LIBP_SUCCESS;
+#include "benchmark.hpp"
+
+void benchmark_t::Ogs(mesh_t& mesh) {
+
+  ReportHeader("ogs " + benchmarkMeshConfig(mesh));
+
+  const dlong N = mesh.Nelements*mesh.Np;
+
+  //setup modifies the ids, so work on a copy
+  memory<hlong> ids(N);
+  ids.copyFrom(mesh.globalIds, N);
+
+  ogs::ogs_t ogs;
+  ogs.Setup(N, ids, mesh.comm, ogs::Signed, ogs::Auto,
+            false, false, platform);
+
+  memory<dfloat> ones(N, 1.0);
+  deviceMemory<dfloat> o_q  = platform.malloc<dfloat>(ones);
+  deviceMemory<dfloat> o_gq = platform.malloc<dfloat>(ones);
+
+  const std::string config = benchmarkMeshConfig(mesh);
+  const dlong Ngather = ogs.Ngather;
+
+  //values and index lists each side of the gather
+  const double gatherBytes = N*(sizeof(dfloat) + sizeof(dlong))
+                           + Ngather*(sizeof(dfloat) + sizeof(dlong));
+
+  double time = Measure([&]() {
+    ogs.GatherScatter(o_q, 1, ogs::Add, ogs::Sym);
+  });
+  Report("gatherScatter", config, N, time, 2*gatherBytes, N);
+
+  time = Measure([&]() {
+    ogs.Gather(o_gq, o_q, 1, ogs::Add, ogs::Trans);
+  });
+  Report("gather", config, N, time, gatherBytes, N);
+
+  time = Measure([&]() {
+    ogs.Scatter(o_q, o_gq, 1, ogs::NoTrans);
+  });
+  Report("scatter", config, N, time, gatherBytes, 0.0);
 }
@@ -0,0 +1,123 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "benchmark.hpp"
+#include "parAlmond.hpp"
+#include "parAlmond/parAlmondparCSR.hpp"
+#include "parAlmond/parAlmondKernels.hpp"
+#include <cmath>
+
+/*SpMV on a 7-point Laplacian. Each rank owns an n^3 block of grid points,
+  stacked in z, with n^3 close to the vector size*/
+void benchmark_t::ParAlmond() {
+
+  parAlmond::buildParAlmondKernels(platform);
+
+  ReportHeader("parAlmond");
+
+  const int rank = comm.rank();
+  const int size = comm.size();
+
+  for (const dlong Nvec : vectorSizes) {
+    const dlong n = std::max(2, static_cast<int>(std::round(std::cbrt(static_cast<double>(Nvec)))));
+    const dlong N = n*n*n;
+    const hlong nz = static_cast<hlong>(n)*size;
+
+    parAlmond::parCOO coo(platform, comm);
+    coo.globalRowStarts.malloc(size+1);
+    coo.globalColStarts.malloc(size+1);
+    for (int r=0;r<size+1;++r) {
+      coo.globalRowStarts[r] = static_cast<hlong>(r)*N;
+      coo.globalColStarts[r] = static_cast<hlong>(r)*N;
+    }
+
+    coo.entries.malloc(7*N);
+    coo.nnz = 0;
+    for (dlong k=0;k<n;++k) {
+      const hlong z = static_cast<hlong>(rank)*n + k;
+      for (dlong j=0;j<n;++j) {
+        for (dlong i=0;i<n;++i) {
+          const hlong row = i + n*(j + n*z);
+          auto add = [&](const hlong col, const dfloat val) {
+            coo.entries[coo.nnz++] = {row, col, val};
+          };
+          add(row, 6.0);
+          if (i>0)    add(row-1, -1.0);
+          if (i<n-1)  add(row+1, -1.0);
+          if (j>0)    add(row-n, -1.0);
+          if (j<n-1)  add(row+n, -1.0);
+          if (z>0)    add(row-n*n, -1.0);
+          if (z<nz-1) add(row+n*n, -1.0);
+        }
+      }
+    }
+
+    parAlmond::parCSR A(coo);
+    A.syncToDevice();
+
+    memory<dfloat> ones(A.Ncols, 1.0);
+    deviceMemory<dfloat> o_x = platform.malloc<dfloat>(ones);
+    deviceMemory<dfloat> o_y = platform.malloc<dfloat>(A.Nrows, ones);
+
+    const std::string config = "N=" + std::to_string(N);
+
+    //stream the matrix, read x once, write y
+    const dlong nnz = A.diag.nnz;
+    const double csrBytes = nnz*(sizeof(dlong) + sizeof(pfloat))
+                          + (A.Nrows+1)*sizeof(dlong)
+                          + 2.0*A.Nrows*sizeof(dfloat);
+
+    double time = Measure([&]() {
+      if (A.diag.NrowBlocks)
+        parAlmond::SpMVcsrKernel1(A.diag.NrowBlocks, 1.0, 0.0,
+                                  A.diag.o_blockRowStarts, A.diag.o_rowStarts,
+                                  A.diag.o_cols, A.diag.o_vals,
+                                  o_x, o_y);
+    });
+    Report("SpMVcsr", config, A.Nrows, time, csrBytes, 2.0*nnz);
+
+    //the local block stored as MCSR with every row listed, so the MCSR
+    // kernel is timed on one rank too
+    memory<dlong> rows(A.Nrows);
+    for (dlong r=0;r<A.Nrows;++r) rows[r] = r;
+    deviceMemory<dlong> o_rows = platform.malloc<dlong>(rows);
+
+    time = Measure([&]() {
+      if (A.diag.NrowBlocks)
+        parAlmond::SpMVmcsrKernel(A.diag.NrowBlocks, 1.0, 0.0,
+                                  A.diag.o_blockRowStarts, A.diag.o_rowStarts,
+                                  o_rows, A.diag.o_cols, A.diag.o_vals,
+                                  o_x, o_y);
+    });
+    Report("SpMVmcsr", config, A.Nrows, time, csrBytes + A.Nrows*sizeof(dlong), 2.0*nnz);
+
+    //full distributed SpMV, including the halo exchange
+    time = Measure([&]() { A.SpMV(1.0, o_x, 0.0, o_y); });
+    Report("parCSR SpMV", config, A.Nrows, time,
+           csrBytes + A.offd.nnz*(sizeof(dlong) + sizeof(pfloat)),
+           2.0*(nnz + A.offd.nnz));
+  }
+}
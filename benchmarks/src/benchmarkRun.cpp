@@ -0,0 +1,155 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "benchmark.hpp"
+#include <sstream>
+
+benchmark_t::benchmark_t(platform_t& _platform, benchmarkSettings_t& _settings):
+  platform(_platform), settings(_settings), comm(_platform.comm) {
+
+  settings.getSetting("NUMBER OF TESTS", Ntests);
+  LIBP_ABORT("NUMBER OF TESTS must be positive", Ntests<1);
+
+  std::string sizes;
+  settings.getSetting("VECTOR SIZES", sizes);
+  std::stringstream ss(sizes);
+  dlong N;
+  while (ss >> N) vectorSizes.push_back(N);
+}
+
+void benchmark_t::Run(meshSettings_t& meshSettings) {
+
+  //reference bandwidth for every other group
+  Stream();
+
+  if (Enabled("LINALG"))      LinAlg();
+  if (Enabled("TIMESTEPPER")) TimeStepper();
+  if (Enabled("PARALMOND"))   ParAlmond();
+
+  if (!Enabled("OGS") && !Enabled("ELLIPTIC") && !Enabled("SWE")) return;
+
+  std::string elementTypes;
+  settings.getSetting("ELEMENT TYPES", elementTypes);
+
+  int minDegree=1, maxDegree=1;
+  settings.getSetting("MIN DEGREE", minDegree);
+  settings.getSetting("MAX DEGREE", maxDegree);
+
+  meshSettings.changeSetting("MESH FILE", "BOX");
+
+  std::stringstream ss(elementTypes);
+  int elementType;
+  while (ss >> elementType) {
+    const int dim = (elementType==Mesh::TRIANGLES
+                  || elementType==Mesh::QUADRILATERALS) ? 2 : 3;
+
+    meshSettings.changeSetting("ELEMENT TYPE", std::to_string(elementType));
+    meshSettings.changeSetting("MESH DIMENSION", std::to_string(dim));
+
+    for (int N=minDegree;N<=maxDegree;++N) {
+      meshSettings.changeSetting("POLYNOMIAL DEGREE", std::to_string(N));
+
+      mesh_t mesh(platform, meshSettings, comm);
+
+      if (Enabled("OGS"))      Ogs(mesh);
+      if (Enabled("ELLIPTIC")) Elliptic(mesh);
+      if (Enabled("SWE") && dim==2) SWE(mesh);
+    }
+  }
+}
+
+bool benchmark_t::Enabled(const std::string group) {
+  std::string groups;
+  settings.getSetting("BENCHMARKS", groups);
+
+  std::stringstream ss(groups);
+  std::string name;
+  while (ss >> name) {
+    if (name==group) return true;
+  }
+  return false;
+}
+
+double benchmark_t::Measure(std::function<void()> launch) {
+
+  launch(); //warm up
+
+  timePoint_t start = GlobalPlatformTime(platform);
+  for (int n=0;n<Ntests;++n) launch();
+  timePoint_t end = PlatformTime(platform);
+
+  double time = ElapsedTime(start, end)/Ntests;
+
+  //the slowest rank sets the pace
+  comm.Allreduce(time, Comm::Max);
+  return time;
+}
+
+void benchmark_t::ReportHeader(const std::string group) {
+  if (comm.rank()==0) {
+    printf("\n%s\n", group.c_str());
+    printf("%-24s %-14s %14s %12s %10s %10s %9s\n",
+           "Kernel", "Config", "Global size", "Time [s]", "GB/s", "GFLOP/s", "% STREAM");
+  }
+}
+
+/*Bytes and flops are per rank and per launch. Rates are aggregated over
+  all ranks*/
+void benchmark_t::Report(const std::string kernel, const std::string config,
+                         const dlong N, const double time,
+                         const double bytes, const double flops) {
+
+  hlong Nglobal = N;
+  comm.Allreduce(Nglobal, Comm::Sum);
+
+  double globalBytes = bytes, globalFlops = flops;
+  comm.Allreduce(globalBytes, Comm::Sum);
+  comm.Allreduce(globalFlops, Comm::Sum);
+
+  const double gbs    = globalBytes/time/1.0e9;
+  const double gflops = globalFlops/time/1.0e9;
+
+  if (comm.rank()==0) {
+    printf("%-24s %-14s %14lld %12.4e %10.2f %10.2f",
+           kernel.c_str(), config.c_str(), static_cast<long long int>(Nglobal),
+           time, gbs, gflops);
+    if (streamBandwidth>0.0)
+      printf(" %8.1f%%", 100.0*gbs/streamBandwidth);
+    printf("\n");
+  }
+}
+
+std::string benchmarkMeshConfig(mesh_t& mesh) {
+  std::string name;
+  switch (mesh.elementType) {
+    case Mesh::TRIANGLES:      name = "Tri"; break;
+    case Mesh::QUADRILATERALS: name = "Quad"; break;
+    case Mesh::TETRAHEDRA:     name = "Tet"; break;
+    case Mesh::HEXAHEDRA:      name = "Hex"; break;
+    default:                   name = "Elem"; break;
+  }
+  return name + " N=" + std::to_string(mesh.N);
+}
@@ -0,0 +1,83 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "benchmark.hpp"
+#include "SWE.hpp"
+
+void benchmark_t::SWE(mesh_t& mesh) {
+
+  ReportHeader("SWE " + benchmarkMeshConfig(mesh));
+
+  SWESettings_t SWESettings(comm);
+  SWESettings.changeSetting("DATA FILE", DSWE "data/SWEAnalytic2D.h");
+
+  SWE_t swe(platform, mesh, SWESettings);
+
+  //unit depth and velocity keeps the fluxes finite
+  memory<dfloat> ones(swe.q.length(), 1.0);
+  swe.o_q.copyFrom(ones);
+
+  const dlong N = mesh.Nelements*mesh.Np;
+  const int Nfields = swe.Nfields;
+  deviceMemory<dfloat> o_rhs = platform.malloc<dfloat>(N*Nfields);
+
+  memory<dlong> elementIds(mesh.Nelements);
+  for (dlong e=0;e<mesh.Nelements;++e) elementIds[e] = e;
+  deviceMemory<dlong> o_elementIds = platform.malloc<dlong>(elementIds);
+
+  const bool tensor = (mesh.elementType==Mesh::QUADRILATERALS);
+  const std::string config = benchmarkMeshConfig(mesh);
+
+  double time = Measure([&]() {
+    swe.volumeKernel(mesh.Nelements,
+                     mesh.o_vgeo,
+                     mesh.o_D,
+                     0.0,
+                     mesh.o_x,
+                     mesh.o_y,
+                     swe.o_q,
+                     swe.o_gradq,
+                     o_rhs);
+  });
+
+  //fields in and out, plus geometric factors per node or per element
+  double bytes = static_cast<double>(N)*2*Nfields*sizeof(dfloat)
+               + static_cast<double>(tensor ? N : mesh.Nelements)*mesh.Nvgeo*sizeof(dfloat);
+  double flops = static_cast<double>(N)*Nfields*(4*(tensor ? mesh.Nq : mesh.Np) + 8);
+  Report("volume", config, N, time, bytes, flops);
+
+  time = Measure([&]() {
+    swe.Surface(mesh.Nelements, o_elementIds, swe.o_q, o_rhs, 0.0);
+  });
+
+  //both traces, surface factors and node maps at every face node
+  const double Nsurf = static_cast<double>(mesh.Nelements)*mesh.Nfaces*mesh.Nfp;
+  bytes = Nsurf*(2*Nfields*sizeof(dfloat) + mesh.Nsgeo*sizeof(dfloat) + 2*sizeof(dlong))
+        + static_cast<double>(N)*2*Nfields*sizeof(dfloat);
+  flops = Nsurf*Nfields*20
+        + (tensor ? 2*Nsurf*Nfields : 2*Nsurf*Nfields*mesh.Np);
+  Report("surface", config, N, time, bytes, flops);
+}
@@ -24,68 +24,53 @@ SOFTWARE.
 
 */
 
-#include "SWE.hpp"
+#include "benchmark.hpp"
 
-//settings for SWE solver
-SWESettings_t::SWESettings_t(comm_t _comm):
+//settings for the kernel benchmarks
+benchmarkSettings_t::benchmarkSettings_t(comm_t _comm):
   settings_t(_comm) {
 
-  newSetting("DATA FILE",
-             "data/SWEAnalytic2D.h",
-             "Boundary and Initial conditions header");
+  newSetting("BENCHMARKS",
+             "LINALG TIMESTEPPER PARALMOND OGS ELLIPTIC SWE",
+             "Kernel groups to time. STREAM is always measured");
 
-  newSetting("ADVECTION TYPE",
-             "COLLOCATION",
-             "Integration type for flux terms",
-             {"COLLOCATION", "CUBATURE"});
+  newSetting("ELEMENT TYPES",
+             "3 4 6 12",
+             "Element types swept by the OGS, ELLIPTIC, and SWE benchmarks");
 
-  newSetting("TIME INTEGRATOR",
-             "DOPRI5",
-             "Time integration method",
-             {"AB3", "DOPRI5", "LSERK4","SSPRK2"});
+  newSetting("MIN DEGREE",
+             "1",
+             "Lowest polynomial degree in the sweep");
 
-  newSetting("CFL NUMBER",
-             "1.0",
-             "Multiplier for timestep stability bound");
+  newSetting("MAX DEGREE",
+             "8",
+             "Highest polynomial degree in the sweep");
 
-  newSetting("START TIME",
-             "0",
-             "Start time for time integration");
+  newSetting("VECTOR SIZES",
+             "65536 1048576 16777216",
+             "Entries per rank swept by the STREAM, LINALG, TIMESTEPPER, and PARALMOND benchmarks");
 
-  newSetting("FINAL TIME",
-             "10",
-             "End time for time integration");
-
-  newSetting("OUTPUT INTERVAL",
-             ".1",
-             "Time between printing output data");
-
-  newSetting("OUTPUT TO FILE",
-             "FALSE",
-             "Flag for writing fields to VTU files",
-             {"TRUE", "FALSE"});
-
-  newSetting("OUTPUT FILE NAME",
-             "SWE");
+  newSetting("NUMBER OF TESTS",
+             "20",
+             "Timed launches of each kernel");
 }
 
-void SWESettings_t::report() {
+void benchmarkSettings_t::report() {
 
   if (comm.rank()==0) {
-    std::cout << "SWE Settings:\n\n";
-    reportSetting("DATA FILE");
-    reportSetting("TIME INTEGRATOR");
-    reportSetting("START TIME");
-    reportSetting("FINAL TIME");
-    reportSetting("OUTPUT INTERVAL");
-    reportSetting("OUTPUT TO FILE");
-    reportSetting("OUTPUT FILE NAME");
+    std::cout << "Benchmark Settings:\n\n";
+    reportSetting("BENCHMARKS");
+    reportSetting("ELEMENT TYPES");
+    reportSetting("MIN DEGREE");
+    reportSetting("MAX DEGREE");
+    reportSetting("VECTOR SIZES");
+    reportSetting("NUMBER OF TESTS");
   }
 }
 
-void SWESettings_t::parseFromFile(platformSettings_t& platformSettings,
-                                  meshSettings_t& meshSettings,
-                                  const std::string filename) {
+void benchmarkSettings_t::parseFromFile(platformSettings_t& platformSettings,
+                                        meshSettings_t& meshSettings,
+                                        const std::string filename) {
   //read all settings from file
   settings_t s(comm);
   s.readSettingsFromFile(filename);
@@ -0,0 +1,72 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "benchmark.hpp"
+
+void benchmark_t::Stream() {
+
+  properties_t kernelInfo = platform.props();
+  kernelInfo["defines/" "p_blockSize"] = 256;
+
+  std::string fileName = DBENCHMARK "okl/benchmarkStream.okl";
+  kernel_t copyKernel  = platform.buildKernel(fileName, "streamCopy",  kernelInfo);
+  kernel_t scaleKernel = platform.buildKernel(fileName, "streamScale", kernelInfo);
+  kernel_t addKernel   = platform.buildKernel(fileName, "streamAdd",   kernelInfo);
+  kernel_t triadKernel = platform.buildKernel(fileName, "streamTriad", kernelInfo);
+
+  ReportHeader("STREAM");
+
+  const dfloat alpha = 3.0;
+  for (const dlong N : vectorSizes) {
+    memory<dfloat> ones(N, 1.0);
+    deviceMemory<dfloat> o_a = platform.malloc<dfloat>(ones);
+    deviceMemory<dfloat> o_b = platform.malloc<dfloat>(ones);
+    deviceMemory<dfloat> o_c = platform.malloc<dfloat>(ones);
+
+    const std::string config = "N=" + std::to_string(N);
+    const double vecBytes = N*sizeof(dfloat);
+
+    double time = Measure([&]() { copyKernel(N, o_a, o_c); });
+    Report("copy", config, N, time, 2*vecBytes, 0.0);
+
+    time = Measure([&]() { scaleKernel(N, alpha, o_c, o_b); });
+    Report("scale", config, N, time, 2*vecBytes, N);
+
+    time = Measure([&]() { addKernel(N, o_a, o_b, o_c); });
+    Report("add", config, N, time, 3*vecBytes, N);
+
+    time = Measure([&]() { triadKernel(N, alpha, o_b, o_c, o_a); });
+    Report("triad", config, N, time, 3*vecBytes, 2.0*N);
+
+    //the best triad over the sweep is the reference bandwidth
+    double triadBytes = 3*vecBytes;
+    comm.Allreduce(triadBytes, Comm::Sum);
+    streamBandwidth = std::max(streamBandwidth, triadBytes/time/1.0e9);
+  }
+
+  if (comm.rank()==0)
+    printf("\nSTREAM triad bandwidth: %.2f GB/s\n", streamBandwidth);
+}
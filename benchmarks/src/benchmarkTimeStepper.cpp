@@ -0,0 +1,72 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "benchmark.hpp"
+
+void benchmark_t::TimeStepper() {
+
+  constexpr int Nstages = 3;
+
+  properties_t kernelInfo = platform.props();
+  kernelInfo["defines/" "p_blockSize"] = 256;
+  kernelInfo["defines/" "p_Nstages"] = Nstages;
+
+  kernel_t abUpdateKernel =
+    platform.buildKernel(LIBP_DIR "/libs/timeStepper/okl/timeStepperAB.okl",
+                         "abUpdate", kernelInfo);
+  kernel_t lserk4UpdateKernel =
+    platform.buildKernel(LIBP_DIR "/libs/timeStepper/okl/timeStepperLSERK4.okl",
+                         "lserk4Update", kernelInfo);
+
+  ReportHeader("timeStepper");
+
+  const dfloat dt = 1.0e-3;
+
+  memory<dfloat> abCoeffs(Nstages, 1.0/Nstages);
+  deviceMemory<dfloat> o_abCoeffs = platform.malloc<dfloat>(abCoeffs);
+
+  for (const dlong N : vectorSizes) {
+    memory<dfloat> ones(Nstages*N, 1.0);
+    deviceMemory<dfloat> o_q    = platform.malloc<dfloat>(N, ones);
+    deviceMemory<dfloat> o_resq = platform.malloc<dfloat>(N, ones);
+    deviceMemory<dfloat> o_rhsq = platform.malloc<dfloat>(Nstages*N, ones);
+
+    const std::string config = "N=" + std::to_string(N);
+    const double vecBytes = N*sizeof(dfloat);
+
+    //AB3: read Nstages rhs, update q
+    double time = Measure([&]() {
+      abUpdateKernel(N, dt, 0, o_abCoeffs, o_rhsq, o_q);
+    });
+    Report("ab3Update", config, N, time, (Nstages+2)*vecBytes, (2.0*Nstages+2)*N);
+
+    //LSERK4: read rhs, update residual and q
+    time = Measure([&]() {
+      lserk4UpdateKernel(N, dt, 0.5, 0.5, o_rhsq, o_resq, o_q);
+    });
+    Report("lserk4Update", config, N, time, 5*vecBytes, 5.0*N);
+  }
+}
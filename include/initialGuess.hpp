@@ -86,7 +86,6 @@ protected:
 
   // temporary buffer for basis inner product output
   dlong        ctmpNblocks;
-  pinnedMemory<dfloat> ctmp;
   deviceMemory<dfloat> o_ctmp;
 
   pinnedMemory<dfloat> alphas;    // Buffers for storing inner products.
@@ -97,7 +96,7 @@ protected:
   kernel_t igScaleKernel;
   kernel_t igUpdateKernel;
 
-  void igBasisInnerProducts(deviceMemory<dfloat>& o_x, deviceMemory<dfloat>& o_Q, deviceMemory<dfloat>& o_c, pinnedMemory<dfloat>& c);
+  void igBasisInnerProducts(deviceMemory<dfloat>& o_x, deviceMemory<dfloat>& o_Q, deviceMemory<dfloat>& o_c);
   void igReconstruct(deviceMemory<dfloat>& o_u, dfloat a, deviceMemory<dfloat>& o_c, deviceMemory<dfloat>& o_Q, deviceMemory<dfloat>& o_unew);
 
 public:
@@ -0,0 +1,85 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#ifndef LIBP_KERNELREGISTRY_HPP
+#define LIBP_KERNELREGISTRY_HPP
+
+#include "core.hpp"
+#include "comm.hpp"
+#include <map>
+
+namespace libp {
+
+/* Persistent record of tuned kernel configurations.
+
+   Each entry is keyed on the device, the kernel's source file and name, and
+   a hash of its kernelInfo defines. It holds the fastest measured launch
+   configuration, its time, and the hash of the compiled binary. The registry
+   lives in the kernel cache directory and only the root rank reads or
+   writes it, so later runs can load a tuned configuration without repeating
+   the search.*/
+class kernelRegistry_t {
+ public:
+  struct entry_t {
+    std::string config;
+    double time=0.0;
+    std::string binaryHash;
+  };
+
+  kernelRegistry_t() = default;
+  kernelRegistry_t(const std::string cacheDir,
+                   const std::string _deviceTag,
+                   comm_t _comm);
+
+  std::string Key(const std::string kernelFileName,
+                  const std::string kernelName,
+                  const properties_t& kernelInfo) const;
+
+  /*Collective. Look up an entry on the root and broadcast it*/
+  bool Find(const std::string key, entry_t& entry);
+
+  /*Collective. Check a found entry against the binary built from its
+    config. If the binary no longer matches the one that was tuned (e.g.
+    the kernel source or compiler changed) the entry is dropped*/
+  bool Verify(const std::string key, const entry_t& entry,
+              const std::string binaryFileName);
+
+  /*Collective. Record an entry and append it to the registry file*/
+  void Record(const std::string key, const entry_t& entry);
+
+ private:
+  comm_t comm;
+  std::string deviceTag;
+  std::string fileName;
+  std::map<std::string, entry_t> entries;
+
+  void Load();
+};
+
+} //namespace libp
+
+#endif
@@ -101,6 +101,9 @@ class linAlg_t {
   // \max o_a
   dfloat max(const dlong N, deviceMemory<dfloat> o_a, comm_t comm);
 
+  // \max o_a, rank-local (no global reduction)
+  dfloat max(const dlong N, deviceMemory<dfloat> o_a);
+
   // \sum o_a
   dfloat sum(const dlong N, deviceMemory<dfloat> o_a, comm_t comm);
 
@@ -119,6 +122,13 @@ class linAlg_t {
   dfloat weightedInnerProd(const dlong N, deviceMemory<dfloat> o_w, deviceMemory<dfloat> o_x,
                             deviceMemory<dfloat> o_y, comm_t comm);
 
+  // o_a[v] = \sum_b o_a[v+Nvec*b], finishes Nvec blocked reductions on device
+  void blockSum(const dlong Nblocks, const int Nvec, deviceMemory<dfloat> o_a);
+
+  // o_a[v] = \sum_b o_a[v+Nvec*b] summed over all ranks, result left in device memory
+  void blockSum(const dlong Nblocks, const int Nvec, deviceMemory<dfloat> o_a,
+                comm_t comm);
+
   static void matrixRightSolve(const int NrowsA, const int NcolsA, const memory<double> A,
                                const int NrowsB, const int NcolsB, const memory<double> B,
                                memory<double> C);
@@ -207,6 +217,7 @@ class linAlg_t {
   kernel_t innerProdKernel2;
   kernel_t weightedInnerProdKernel1;
   kernel_t weightedInnerProdKernel2;
+  kernel_t blockSumKernel;
 };
 
 } //namespace libp
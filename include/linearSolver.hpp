@@ -63,6 +63,14 @@ class linearSolver_t {
             deviceMemory<dfloat>& o_x, deviceMemory<dfloat>& o_rhs,
             const dfloat tol, const int MAXIT, const int verbose);
 
+  /*Solve Nrhs systems with the same operator. The n-th solution/rhs
+    starts at offset n*(N+Nhalo) in o_x/o_rhs. Iteration counts of each
+    system are returned in Niters, the largest is returned.*/
+  int BlockSolve(operator_t& linearOperator, operator_t& precon,
+                 deviceMemory<dfloat>& o_x, deviceMemory<dfloat>& o_rhs,
+                 const int Nrhs, memory<int> Niters,
+                 const dfloat tol, const int MAXIT, const int verbose);
+
  private:
   std::shared_ptr<LinearSolver::linearSolverBase_t> ls=nullptr;
   std::shared_ptr<InitialGuess::initialGuessStrategy_t> ig=nullptr;
@@ -93,6 +101,14 @@ public:
   virtual int Solve(operator_t& linearOperator, operator_t& precon,
                     deviceMemory<dfloat>& o_x, deviceMemory<dfloat>& o_rhs,
                     const dfloat tol, const int MAXIT, const int verbose)=0;
+
+  virtual int BlockSolve(operator_t& linearOperator, operator_t& precon,
+                         deviceMemory<dfloat>& o_x, deviceMemory<dfloat>& o_rhs,
+                         const int Nrhs, memory<int> Niters,
+                         const dfloat tol, const int MAXIT, const int verbose) {
+    LIBP_FORCE_ABORT("Block solve not implemented in this linear solver");
+    return 0;
+  }
 };
 
 //Preconditioned Conjugate Gradient
@@ -213,6 +229,72 @@ public:
             const dfloat tol, const int MAXIT, const int verbose);
 };
 
+//Block Preconditioned Conjugate Gradient
+// Nrhs independent PCG recurrences advanced together, sharing each
+// operator and preconditioner application and each global reduction
+class bpcg: public linearSolverBase_t {
+private:
+  int Nrhs;
+
+  deviceMemory<dfloat> o_p, o_Ap, o_z, o_Ax;
+
+  pinnedMemory<dfloat> dots;
+  deviceMemory<dfloat> o_dots;
+
+  pinnedMemory<dfloat> alphas, betas;
+  deviceMemory<dfloat> o_alphas, o_betas;
+
+  kernel_t dotBPCGKernel;
+  kernel_t updatePBPCGKernel;
+  kernel_t updateBPCGKernel;
+
+  void DotBPCG(deviceMemory<dfloat>& o_a, deviceMemory<dfloat>& o_b, memory<dfloat> adotb);
+  void UpdateBPCG(deviceMemory<dfloat>& o_x, deviceMemory<dfloat>& o_r, memory<dfloat> rdotr);
+
+public:
+  bpcg(dlong _N, dlong _Nhalo,
+       platform_t& _platform, settings_t& _settings, comm_t _comm,
+       const int _Nrhs=1);
+
+  int Solve(operator_t& linearOperator, operator_t& precon,
+            deviceMemory<dfloat>& o_x, deviceMemory<dfloat>& o_rhs,
+            const dfloat tol, const int MAXIT, const int verbose);
+
+  int BlockSolve(operator_t& linearOperator, operator_t& precon,
+                 deviceMemory<dfloat>& o_x, deviceMemory<dfloat>& o_rhs,
+                 const int _Nrhs, memory<int> Niters,
+                 const dfloat tol, const int MAXIT, const int verbose);
+};
+
+//Pipelined Preconditioned Conjugate Gradient
+class pipecg: public linearSolverBase_t {
+private:
+  deviceMemory<dfloat> o_u, o_w, o_m, o_n, o_p, o_s, o_q, o_z, o_Ax;
+
+  pinnedMemory<dfloat> dots;
+  deviceMemory<dfloat> o_dots;
+
+  kernel_t update0PIPECGKernel;
+  kernel_t update1PIPECGKernel;
+
+  //marks the point in the device stream where dots is ready
+  streamTag_t dotsReady;
+  Comm::request_t request;
+
+  void Update0PIPECG(deviceMemory<dfloat>& o_r);
+  void Update1PIPECG(const dfloat alpha, const dfloat beta,
+                     deviceMemory<dfloat>& o_x, deviceMemory<dfloat>& o_r);
+  void ReducePIPECG();
+
+public:
+  pipecg(dlong _N, dlong _Nhalo,
+       platform_t& _platform, settings_t& _settings, comm_t _comm);
+
+  int Solve(operator_t& linearOperator, operator_t& precon,
+            deviceMemory<dfloat>& o_x, deviceMemory<dfloat>& o_rhs,
+            const dfloat tol, const int MAXIT, const int verbose);
+};
+
 } //namespace LinearSolver
 
 } //namespace libp
@@ -85,6 +85,7 @@ class mesh_t {
   memory<int>   EToB;      // element-to-boundary condition type
   deviceMemory<int> o_EToB;
 
+  static constexpr int maxVToE = 10; // max number of elements sharing a vertex
   memory<dlong> EToN;
   memory<dlong> Ncounts;
   memory<dlong> Vcounts;
@@ -349,6 +350,15 @@ class mesh_t {
   deviceMemory<dfloat> o_SEMFEMInterp;
   deviceMemory<dfloat> o_SEMFEMAnterp;
 
+  /*************************/
+  /* Rebalancing           */
+  /*************************/
+  //element migration plan of the last Rebalance
+  memory<dlong> migrateSendIds;   // old local ids of elements to send, grouped by destination rank
+  memory<dlong> migrateRecvIds;   // new local ids of received elements, grouped by source rank
+  memory<int> migrateSendCounts, migrateSendOffsets;
+  memory<int> migrateRecvCounts, migrateRecvOffsets;
+
   kernel_t MassMatrixKernel;
 
   mesh_t() = default;
@@ -361,6 +371,17 @@ class mesh_t {
   void Setup(platform_t& _platform, meshSettings_t& _settings,
              comm_t _comm);
 
+  // repartition elements to balance a per-element cost when the rank
+  // imbalance exceeds tolerance and the new partition lowers it by at
+  // least margin, then rebuild connectivity, halos, gather-scatter, and
+  // geometric factors. Returns true if repartitioned
+  bool Rebalance(memory<dfloat>& cost, const dfloat tolerance,
+                 const dfloat margin);
+
+  // move per-element data (Nentries per element) to the element owners
+  // of the last Rebalance
+  void Migrate(memory<dfloat>& data, const int Nentries);
+
   // setup trace halo
   void HaloRingSetup();
 
@@ -588,6 +609,13 @@ class mesh_t {
   void ReadGmshQuad3D(const std::string fileName);
   void ReadGmshTet3D(const std::string fileName);
   void ReadGmshHex3D(const std::string fileName);
+  void ReadGmshDistributed(const std::string fileName,
+                           const int gmshElementType,
+                           const int gmshFaceType);
+
+  // partitioned binary mesh files
+  void SavePartitioned(const std::string fileName);
+  void LoadPartitioned(const std::string fileName);
 
   // reference nodes and operators
   void ReferenceNodes() {
@@ -617,6 +645,11 @@ class mesh_t {
   // repartition elements
   void Partition();
 
+  // repartition elements, balancing Nconstraints weights per element.
+  // elementIds returns the pre-partition global id of each new element
+  void Partition(const int Nconstraints, memory<dfloat>& weights,
+                 memory<hlong>& elementIds);
+
   /* build parallel face connectivity */
   void Connect();
 
@@ -638,7 +671,7 @@ class mesh_t {
   /* build global gather scatter ops */
   void GatherScatterSetup();
 
-  void SetupVToETri2D();
+  void SetupVToE();
 
   /* compute x,y,z coordinates of each node */
   void PhysicalNodes() {
@@ -1239,5 +1272,7 @@ class mesh_t {
 
 } //namespace libp
 
+#include "mesh/meshVTU.hpp"
+
 #endif
 
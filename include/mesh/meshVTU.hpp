@@ -0,0 +1,177 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef MESH_VTU_HPP
+#define MESH_VTU_HPP 1
+
+#include "mesh.hpp"
+
+namespace libp {
+
+/*
+  Parallel VTU output of nodal fields.
+
+  Fields are interpolated to the mesh plot nodes and written as one
+  UnstructuredGrid piece per rank with all data arrays stored in an
+  appended binary block (raw or base64 encoded, optionally zlib
+  compressed). Rank 0 additionally writes the .pvtu index of each frame
+  and keeps a .pvd time-series file up to date, so the whole run can be
+  opened in ParaView as a single dataset.
+
+  Usage:
+
+    vtuWriter_t vtu(mesh);
+    ...
+    vtu.AddField("Density",  q, Nfields, 0);
+    vtu.AddField("Velocity", q, Nfields, 1, mesh.dim);
+    vtu.Write("SWE", frame, time);
+
+  produces SWE_RRRR_FFFF.vtu on each rank, SWE_FFFF.pvtu and SWE.pvd.
+
+  Fields may also be registered directly from device memory. In that case
+  Write queues copies of them to pinned staging buffers behind the work
+  already on the compute stream, and hands the frame to a background
+  thread which waits for the copies, then performs the plot interpolation
+  and file output while the caller continues time stepping. Write only
+  blocks when more than [OUTPUT QUEUE DEPTH] frames are still waiting to
+  be written. Flush blocks until every queued frame is on disk and
+  rethrows any error from the background writer, so solvers call it at
+  the end of their run.
+
+  The encoding is selected by the mesh settings
+    [OUTPUT FILE FORMAT]  ASCII, BINARY (raw appended) or BASE64
+    [OUTPUT COMPRESSION]  NONE or ZLIB (requires building with zlib=true)
+    [OUTPUT QUEUE DEPTH]  frames in flight (0 writes synchronously)
+*/
+class vtuWriter_t {
+ public:
+  enum Format {
+    ASCII,
+    BINARY,
+    BASE64
+  };
+
+  vtuWriter_t() = default;
+  vtuWriter_t(mesh_t& _mesh) {
+    Setup(_mesh);
+  }
+
+  void Setup(mesh_t& _mesh);
+
+  /*Point the writer at a repartitioned mesh. Queued frames are written
+    first, and the .pvd time series carries on with the new partition*/
+  void Remesh(mesh_t& _mesh);
+
+  /*Register a field for the next Write. Q stores Nfields nodal fields per
+    element and component c of this field is read from
+    Q[e*Np*Nfields + (field+c)*Np + n]*/
+  void AddField(const std::string name,
+                const memory<dfloat> Q,
+                const int Nfields=1,
+                const int field=0,
+                const int Ncomponents=1);
+
+  /*Register a device field. The data is snapshotted when Write is
+    called, so o_Q may be modified as soon as Write returns*/
+  void AddField(const std::string name,
+                const deviceMemory<dfloat> o_Q,
+                const int Nfields=1,
+                const int field=0,
+                const int Ncomponents=1);
+
+  void ClearFields();
+
+  /*Write all registered fields as frame 'frame' at time 'time', then
+    clear the field list*/
+  void Write(const std::string name, const int frame, const dfloat time);
+
+  /*Wait for all queued frames to be written. Errors from the background
+    writer are rethrown here*/
+  void Flush();
+
+ private:
+  struct field_t {
+    std::string name;
+    memory<dfloat> Q;
+    int Nfields;
+    int field;
+    int Ncomponents;
+  };
+
+  struct deviceField_t {
+    std::string name;
+    deviceMemory<dfloat> o_Q;
+    int Nfields;
+    int field;
+    int Ncomponents;
+  };
+
+  mesh_t mesh;
+  Format format=BINARY;
+  bool compress=false;
+
+  std::vector<field_t> fields;
+  std::vector<deviceField_t> deviceFields;
+
+  //background writer, shared between copies of this writer
+  class outputQueue_t;
+  std::shared_ptr<outputQueue_t> queue;
+
+  //time series written so far (rank 0 only)
+  std::vector<std::pair<dfloat, std::string>> series;
+
+  //plot geometry does not change between frames so we encode it once
+  std::string xmlPoints, xmlCells;
+  std::string binPoints, binCells;
+
+  void SetupGeometry();
+
+  void WriteFrame(const std::string name, const int frame, const dfloat time);
+
+  template<typename T>
+  void AddDataArray(const std::string name,
+                    const int Ncomponents,
+                    const memory<T> data,
+                    std::string& xml,
+                    std::string& bin,
+                    const size_t offset);
+
+  std::string EncodeBlock(const char* data, const size_t Nbytes);
+
+  void WritePiece(const std::string fileName);
+  void WritePvtu(const std::string fileName,
+                 const std::string pieceName,
+                 const int frame);
+  void WritePvd(const std::string fileName);
+
+  /*Reload the first Nframes entries of an existing .pvd series, so a run
+    restarted from a checkpoint extends it instead of starting over*/
+  void ReadPvd(const std::string fileName, const int Nframes);
+};
+
+} //namespace libp
+
+#endif
@@ -47,6 +47,12 @@ public:
   deviceMemory<char> o_workspace, o_sendspace;
 
   stream_t dataStream;
+
+  //marks the point in the device stream where the send buffer is ready.
+  // Start tags the stream instead of blocking the host, and Finish waits
+  // on the tag only, so work queued in between keeps running
+  streamTag_t sendReady;
+
   static kernel_t extractKernel[4];
 
 #ifdef GPU_AWARE_MPI
@@ -37,6 +37,17 @@ public:
   virtual void Operator(deviceMemory<dfloat> &o_r, deviceMemory<dfloat> &o_Mr) {
     LIBP_FORCE_ABORT("Operator not implemented in this object");
   };
+
+  //block operator on Nrhs vectors, the n-th one starting at n*offset.
+  // Defaults to applying the operator to each vector in turn
+  virtual void BlockOperator(deviceMemory<dfloat> &o_r, deviceMemory<dfloat> &o_Mr,
+                             const int Nrhs, const dlong offset) {
+    for (int n=0;n<Nrhs;++n) {
+      deviceMemory<dfloat> o_rn  = o_r  + n*offset;
+      deviceMemory<dfloat> o_Mrn = o_Mr + n*offset;
+      Operator(o_rn, o_Mrn);
+    }
+  };
 };
 
 } //namespace libp
@@ -38,6 +38,12 @@ namespace paradogs {
 void AddSettings(settings_t& settings);
 void ReportSettings(settings_t& settings);
 
+/*Partition a mesh over the ranks of comm. Element data are redistributed
+  in place. With Nconstraints>0, weights holds Nconstraints costs per
+  element and each cost is balanced separately, otherwise element
+  counts are balanced. Partitions are assigned to ranks to keep as many
+  elements as possible in place, and elementIds returns the global id
+  each new local element had on input*/
 void MeshPartition(platform_t &platform,
                    settings_t &settings,
                    dlong &Nelements,
@@ -52,6 +58,10 @@ void MeshPartition(platform_t &platform,
                    memory<dfloat>& EX,
                    memory<dfloat>& EY,
                    memory<dfloat>& EZ,
+                   memory<hlong>& elementInfo,
+                   const int Nconstraints,
+                   memory<dfloat>& weights,
+                   memory<hlong>& elementIds,
                    comm_t comm);
 
 } //namespace paradogs
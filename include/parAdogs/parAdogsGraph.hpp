@@ -41,6 +41,7 @@ public:
   static constexpr int MAX_NVERTS=8;
   static constexpr int MAX_NFACES=6;
   static constexpr int MAX_NFACEVERTS=4;
+  static constexpr int MAX_NCONSTRAINTS=8;
 
 private:
   platform_t platform;
@@ -71,11 +72,22 @@ private:
 
     hlong E[MAX_NFACES];   //Global element ids of neighbors
     int F[MAX_NFACES];     //Face ids of neighbors
+
+    hlong info;                 //element type info
+    dfloat W[MAX_NCONSTRAINTS]; //balance constraint weights
+
+    hlong id;              //Global element id before partitioning
   };
   memory<element_t> elements;
 
   int faceVerts[MAX_NFACES*MAX_NFACEVERTS];
 
+  /*Number of weights per element to balance (0 balances element counts)*/
+  int Nconstraints=0;
+
+  /*Global element offsets of each rank before partitioning*/
+  memory<hlong> homeStarts;
+
   /*Multilevel Laplacian (for spectral partitioning)*/
   static constexpr int MAX_LEVELS=100;
   int Nlevels=0;
@@ -97,12 +109,18 @@ public:
           const memory<dfloat>& EX,
           const memory<dfloat>& EY,
           const memory<dfloat>& EZ,
+          const memory<hlong>& elementInfo,
+          const int _Nconstraints,
+          const memory<dfloat>& weights,
           comm_t _comm);
 
   void InertialPartition();
 
   void SpectralPartition();
 
+  /*Permute partitions among ranks to keep elements on their home rank*/
+  void Remap();
+
   void Connect();
 
   void CuthillMckee();
@@ -115,12 +133,20 @@ public:
                    memory<int>& EToF,
                    memory<dfloat>& EX,
                    memory<dfloat>& EY,
-                   memory<dfloat>& EZ);
+                   memory<dfloat>& EZ,
+                   memory<hlong>& elementInfo,
+                   memory<dfloat>& weights,
+                   memory<hlong>& elementIds);
 
 private:
   void InertialBipartition(const dfloat targetFraction[2]);
   void SpectralBipartition(const dfloat targetFraction[2]);
 
+  /*Bipartition by thresholding F to meet targetFraction of each constraint*/
+  void PivotBipartition(memory<dfloat>& F,
+                        const dfloat targetFraction[2],
+                        memory<int>& partition);
+
 
   /*Divide graph into two pieces according to a bisection*/
   void Split(const memory<int>& partition);
@@ -37,6 +37,10 @@ namespace paradogs {
 dfloat ParallelPivot(const dlong N, memory<dfloat>& F,
                      const hlong k, comm_t comm);
 
+dfloat WeightedParallelPivot(const dlong N, memory<dfloat>& F,
+                             memory<dfloat>& W, const dfloat target,
+                             comm_t comm);
+
 } //namespace paradogs
 
 } //namespace libp
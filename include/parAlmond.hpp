@@ -95,7 +95,7 @@ typedef enum {SMOOTHED=0,UNSMOOTHED=1} AggType;
 typedef enum {PCG=0,GMRES=1} KrylovType;
 typedef enum {DAMPED_JACOBI=0,CHEBYSHEV=1} SmoothType;
 typedef enum {RUGESTUBEN=0,SYMMETRIC=1} StrengthType;
-typedef enum {COARSEEXACT=0,COARSEOAS=1} CoarseType;
+typedef enum {COARSEEXACT=0,COARSEOAS=1,COARSEDIRECT=2} CoarseType;
 
 class coarseSolver_t;
 
@@ -117,6 +117,10 @@ public:
   int numLevels=0;
   int baseLevel=0;
   static constexpr int PARALMOND_MAX_LEVELS=100;
+
+  //first level this rank was agglomerated away from. From here down the
+  // levels hold no rows here and run on a sub-communicator without us
+  int idleLevel=PARALMOND_MAX_LEVELS;
   std::shared_ptr<multigridLevel> levels[PARALMOND_MAX_LEVELS];
 
   deviceMemory<dfloat> o_rhs[PARALMOND_MAX_LEVELS];
@@ -220,6 +224,11 @@ public:
                memory<dfloat> nullVector,
                dfloat nullSpacePenalty);
 
+  // Numeric-only AMG re-setup. Keeps the aggregates and the sparsity
+  // patterns of the hierarchy from AMGSetup and recomputes its values
+  //-- A must have the same sparsity pattern and entry ordering as in AMGSetup
+  void AMGUpdate(parCOO& A);
+
   void Operator(deviceMemory<dfloat>& o_rhs, deviceMemory<dfloat>& o_x);
 
   void Report();
@@ -231,6 +240,12 @@ private:
   settings_t settings;
 
   std::shared_ptr<multigrid_t> multigrid=nullptr;
+
+  //AMG setup data reused by AMGUpdate
+  int amgStartLevel=0;
+  bool coarseNullSpace=false;
+  dfloat coarseNullSpacePenalty=0.0;
+  memory<dfloat> coarseNull;
 };
 
 } //namespace parAlmond
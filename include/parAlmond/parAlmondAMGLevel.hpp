@@ -34,11 +34,45 @@ namespace libp {
 
 namespace parAlmond {
 
+//Rows of B exchanged to form a product C=A*B. Recorded on the first
+// numeric product so later ones only exchange values
+class productPlan_t {
+public:
+  bool ready=false;
+
+  memory<dlong> sendRows;   //local rows of B sent, grouped by rank
+  memory<int> sendCounts, sendOffsets; //nonzeros sent to each rank
+  memory<int> recvCounts, recvOffsets; //nonzeros recv'd from each rank
+
+  memory<dlong> recvRowStarts; //recv'd nonzeros of each halo row of B
+  memory<dlong> recvCols;      //columns of C of the recv'd nonzeros
+};
+
+//Entries of A exchanged to form At=A^T. Recorded on the first
+// numeric transpose so later ones only exchange values
+class transposePlan_t {
+public:
+  bool ready=false;
+
+  memory<dlong> diagIds; //location in At.diag of each entry of A.diag
+
+  memory<dlong> sendIds; //entries of A.offd sent, grouped by rank
+  memory<int> sendCounts, sendOffsets;
+  memory<int> recvCounts, recvOffsets;
+  memory<dlong> recvIds; //location in At.offd of each recv'd entry
+};
+
 class amgLevel: public multigridLevel {
 
 public:
   parCSR A, P, R;
 
+  //tentative prolongator and A*P, kept to recompute the values of
+  // P, R, and the coarse operator when the values of A change
+  parCSR T, AP;
+  productPlan_t Tplan, Pplan, APplan;
+  transposePlan_t Rplan;
+
   SmoothType stype;
   dfloat lambda, lambda1, lambda0; //smoothing params
 
@@ -70,6 +70,25 @@ parCSR SpMM(parCSR& A, parCSR& B);
 
 parCSR galerkinProd(parCSR& A, parCSR& P);
 
+//numeric-only versions, reusing the sparsity pattern of the output
+void updateAmgLevel(amgLevel& level, amgLevel& coarseLevel,
+                    AggType aggtype);
+
+void smoothProlongatorNumeric(parCSR& A, parCSR& T, parCSR& P,
+                              productPlan_t& plan);
+
+void transposeNumeric(parCSR& A, parCSR& At, transposePlan_t& plan);
+
+void SpMMNumeric(parCSR& A, parCSR& B, parCSR& C, productPlan_t& plan);
+
+bool agglomerateAmgLevel(amgLevel& level, amgLevel& coarseLevel,
+                         memory<dfloat>& null,
+                         const int agglomerationSize);
+
+parCSR redistribute(parCSR& A,
+                    memory<hlong> newRowStarts,
+                    memory<hlong> newColStarts);
+
 } //namespace parAlmond
 
 } //namespace libp
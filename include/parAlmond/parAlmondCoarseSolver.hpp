@@ -104,6 +104,58 @@ public:
   void solve(deviceMemory<dfloat>& o_rhs, deviceMemory<dfloat>& o_x);
 };
 
+//sparse LDL^T factorization of the coarse operator, gathered onto the
+// first of the ranks holding coarse rows
+class directSolver_t: public coarseSolver_t {
+
+public:
+  parCSR A;
+
+  int N;
+  int coarseTotal=0;
+
+  //ranks holding coarse rows
+  comm_t activeComm;
+  memory<int> coarseCounts;
+  memory<int> coarseOffsets;
+
+  //factors of the fill-reducing permutation of the coarse operator
+  memory<int> perm;
+  memory<hlong> Lstarts;
+  memory<int> Lrows;
+  memory<dfloat> Lvals;
+  memory<dfloat> D;
+
+  //singular operators are factored with one row pinned, and the null
+  // space component is added back after the solve
+  bool nullSpace=false;
+  dfloat nullSpacePenalty=0.0;
+  int pinnedRow=-1;
+  memory<dfloat> nullTotal;
+
+  memory<dfloat> localRhs, localX;
+  memory<dfloat> coarseRhs, coarseX, work;
+
+  directSolver_t(platform_t& _platform, settings_t& _settings,
+                 comm_t _comm):
+    coarseSolver_t(_platform, _settings, _comm) {}
+
+  int getTargetSize();
+
+  void setup(parCSR& A, bool nullSpace,
+             memory<dfloat> nullVector, dfloat nullSpacePenalty);
+
+  void syncToDevice();
+
+  void Report(int lev);
+
+  void solve(deviceMemory<dfloat>& o_rhs, deviceMemory<dfloat>& o_x);
+
+private:
+  void Factor(memory<parCOO::nonZero_t> entries, const int nnz);
+  void HostSolve();
+};
+
 class oasSolver_t: public coarseSolver_t {
 
 public:
@@ -33,6 +33,8 @@ namespace parAlmond {
 
   void buildParAlmondKernels(platform_t& platform);
 
+  void buildParAlmondSingleKernels(platform_t& platform);
+
   void freeParAlmondKernels();
 
   //NC: Hard code these for now. Should be sufficient for GPU devices, but needs attention for CPU
@@ -51,6 +53,18 @@ namespace parAlmond {
   extern kernel_t SmoothChebyshevMCSRKernel;
   extern kernel_t SmoothChebyshevUpdateKernel;
 
+  //variants reading single precision matrix values. The vectors they
+  // smooth and multiply stay dfloat, as does the arithmetic
+  extern kernel_t SpMVcsrSingleKernel1;
+  extern kernel_t SpMVcsrSingleKernel2;
+  extern kernel_t SpMVmcsrSingleKernel;
+
+  extern kernel_t SmoothJacobiCSRSingleKernel;
+  extern kernel_t SmoothJacobiMCSRSingleKernel;
+
+  extern kernel_t SmoothChebyshevCSRSingleKernel;
+  extern kernel_t SmoothChebyshevMCSRSingleKernel;
+
   extern kernel_t vectorAddInnerProdKernel;
   extern kernel_t vectorAddWeightedInnerProdKernel;
   extern kernel_t kcycleCombinedOp1Kernel;
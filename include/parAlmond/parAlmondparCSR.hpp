@@ -52,7 +52,7 @@ public:
     deviceMemory<dlong>  o_blockRowStarts;
     deviceMemory<dlong>  o_rowStarts;
     deviceMemory<dlong>  o_cols;
-    deviceMemory<pfloat> o_vals;
+    deviceMemory<char>   o_vals; //pfloat, or float for single precision
   };
   CSR diag;
 
@@ -73,7 +73,7 @@ public:
     deviceMemory<dlong>  o_mRowStarts;
     deviceMemory<dlong>  o_rows;
     deviceMemory<dlong>  o_cols;
-    deviceMemory<pfloat> o_vals;
+    deviceMemory<char>   o_vals; //pfloat, or float for single precision
   };
   MCSR offd;
 
@@ -94,6 +94,9 @@ public:
   //rho ~= cond(invD * A)
   dfloat rho=0.0;
 
+  //matrix values are stored on the device in float
+  bool singlePrecision=false;
+
   parCSR() = default;
   parCSR(dlong N, dlong M, platform_t& _platform, comm_t _comm):
     platform(_platform), comm(_comm), Nrows(N), Ncols(M) {}
@@ -101,13 +104,20 @@ public:
   //build a parCSR matrix from a distributed COO matrix
   parCSR(parCOO& A);
 
+  //refill the values from a COO matrix with the same sparsity pattern
+  // and entry ordering as the one this matrix was built from
+  void updateValues(parCOO& A);
+
+  //local index of global column id, or -1 if it is not a column here
+  dlong colIndex(const hlong id);
+
   void haloSetup(memory<hlong> colIds);
 
   void diagSetup();
 
   dfloat rhoDinvA();
 
-  void syncToDevice();
+  void syncToDevice(const bool _singlePrecision=false);
 
   void SpMV(const dfloat alpha, memory<dfloat>& x,
             const dfloat beta, memory<dfloat>& y);
@@ -38,6 +38,9 @@ SOFTWARE.
 #include "comm.hpp"
 #include "settings.hpp"
 #include "linAlg.hpp"
+#include "kernelRegistry.hpp"
+#include "profiler.hpp"
+#include <functional>
 
 namespace libp {
 
@@ -53,6 +56,12 @@ class iplatform_t {
 public:
   platformSettings_t settings;
   properties_t props;
+  std::string cacheDir;
+  std::string localCacheDir;
+  kernelRegistry_t registry;
+
+  comm_t nodeComm;     //ranks sharing a node
+  comm_t nodeRootComm; //lowest rank on each node
 
   iplatform_t(platformSettings_t& _settings):
     settings(_settings) {
@@ -98,6 +107,8 @@ public:
     DeviceConfig();
     DeviceProperties();
 
+    Profiler::Setup(settings(), device, comm);
+
     ilinAlg = std::make_shared<linAlg_t>(this);
   }
 
@@ -116,6 +127,15 @@ public:
   kernel_t buildKernel(std::string fileName, std::string kernelName,
                        properties_t& kernelInfo);
 
+  /*Build kernelName with each candidate value of the define, time launch()
+    on each, and return the fastest. The choice is kept in the kernel
+    registry, and later runs build the recorded value directly.*/
+  kernel_t tuneKernel(std::string fileName, std::string kernelName,
+                      properties_t kernelInfo,
+                      const std::string define,
+                      const std::vector<int> candidates,
+                      std::function<void(kernel_t&)> launch);
+
   template <typename T>
   deviceMemory<T> malloc(const size_t count,
                          const properties_t &prop = properties_t()) {
@@ -224,12 +244,24 @@ public:
   }
 
   void setCacheDir(const std::string cacheDir) {
+    iplatform->cacheDir = cacheDir;
     occa::env::setOccaCacheDir(cacheDir);
   }
 
+  const std::string& cacheDir() {
+    assertInitialized();
+    return iplatform->cacheDir;
+  }
+
+  kernelRegistry_t& kernelRegistry() {
+    assertInitialized();
+    return iplatform->registry;
+  }
+
  private:
   void DeviceConfig();
   void DeviceProperties();
+  void BcastKernelCache(kernel_t& kernel);
 };
 
 } //namespace libp
@@ -40,12 +40,28 @@ class precon_t: public operator_t {
     precon->Operator(o_r, o_Mr);
   }
 
+  void BlockOperator(deviceMemory<dfloat> &o_r, deviceMemory<dfloat> &o_Mr,
+                     const int Nrhs, const dlong offset) {
+    assertInitialized();
+    precon->BlockOperator(o_r, o_Mr, Nrhs, offset);
+  }
+
   /*Generic setup. Create a Precon object and wrap it in a shared_ptr*/
   template<class Precon, class... Args>
   void Setup(Args&& ... args) {
     precon = std::make_shared<Precon>(args...);
   }
 
+  /*Access the wrapped preconditioner, which must be a Precon*/
+  template<class Precon>
+  Precon& Get() {
+    assertInitialized();
+    std::shared_ptr<Precon> p = std::dynamic_pointer_cast<Precon>(precon);
+    LIBP_ABORT("Precon is not of the requested type",
+               p==nullptr);
+    return *p;
+  }
+
  private:
   std::shared_ptr<operator_t> precon=nullptr;
 
@@ -0,0 +1,76 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef LIBP_PROFILER_HPP
+#define LIBP_PROFILER_HPP
+
+#include "core.hpp"
+#include "comm.hpp"
+#include "settings.hpp"
+
+namespace libp {
+
+/* Hierarchical named-region profiler.
+
+   Regions nest, and each is timed on the host and between device stream
+   tags. Regions given a byte and flop count report bandwidth and GFLOP/s.
+   MPI exchanges are accumulated under the enclosing region. Each kernel_t
+   launch is timed between stream tags and, if the kernel has a
+   performance model, adds its bytes and flops to the record of the
+   kernel's name. Finalize reduces
+   all records over ranks into a min/avg/max report and, depending on the
+   PROFILER platform setting, a JSON summary and per-rank Chrome trace files.
+   All calls are no-ops unless the profiler is enabled.*/
+namespace Profiler {
+
+/*Enable the profiler if the PROFILER setting asks for it*/
+void Setup(settings_t& settings, device_t& device, comm_t comm);
+
+bool Enabled();
+
+/*Open a region nested in the current one*/
+void Start(const std::string& name);
+
+/*Close the current region, which must be name. Bytes and flops moved in
+  the region are used to report its bandwidth and throughput*/
+void Stop(const std::string& name,
+          const double bytes=0.0,
+          const double flops=0.0);
+
+/*Record an MPI exchange of bytes which waited waitTime seconds*/
+void Exchange(const std::string& name,
+              const double bytes,
+              const double waitTime);
+
+/*Collective. Reduce, report, and write the profile, then disable. Call
+  from main on every rank, before the solver and platform are destroyed*/
+void Finalize();
+
+} //namespace Profiler
+
+} //namespace libp
+
+#endif
@@ -33,12 +33,19 @@ SOFTWARE.
 
 namespace libp {
 
+//forward declare
+class checkpoint_t;
+
 class solver_t: public operator_t {
 public:
   platform_t platform;
   settings_t settings;
   comm_t comm;
 
+  //index of the next output frame. Checkpointed, so a restarted run
+  // continues the output series
+  int outputFrame=0;
+
   solver_t() = default;
 
   solver_t(platform_t& _platform, settings_t& _settings, comm_t _comm):
@@ -53,6 +60,18 @@ public:
     LIBP_FORCE_ABORT("Report not implemented in this solver");
   }
 
+  //Register solver state, beyond the time stepped fields, needed to restart from a checkpoint
+  virtual void SetupCheckpoint(checkpoint_t& checkpoint) {}
+
+  //Non-blocking estimate of the largest stable time step for adaptive time stepping
+  virtual void MaxTimeStepStart(deviceMemory<dfloat>& o_q, const dfloat time) {
+    LIBP_FORCE_ABORT("Adaptive time step control not implemented in this solver");
+  }
+  virtual dfloat MaxTimeStepFinish() {
+    LIBP_FORCE_ABORT("Adaptive time step control not implemented in this solver");
+    return 0.0;
+  }
+
   //Full rhs evaluation of solver in form dq/dt = rhsf(q,t)
   virtual void rhsf(deviceMemory<dfloat>& o_q, deviceMemory<dfloat>& o_rhs, const dfloat time) {
     LIBP_FORCE_ABORT("rhsf not implemented in this solver");
@@ -0,0 +1,67 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef LIBP_SPGEMM_HPP
+#define LIBP_SPGEMM_HPP
+
+#include "core.hpp"
+
+namespace libp {
+
+/*Rows of a distributed sparse matrix held on this rank, in CSR form
+  with global column ids*/
+class csrRows_t {
+public:
+  dlong Nrows=0;
+  dlong nnz=0;
+
+  memory<dlong>  rowStarts;
+  memory<hlong>  cols;
+  memory<dfloat> vals;
+};
+
+/*Host sparse product C = A*B, formed row by row.
+
+  A is split into the local and non-local CSR blocks used by the parCSR
+  matrices of parAlmond and parAdogs, and the column ids of both blocks
+  index the rows of B. C has one row per row of A, and each row of C is
+  sorted by column.
+
+  Rows are formed with per-thread hash accumulators in two passes, one
+  counting the nonzeros of each row of C and one filling them, so the
+  list of all partial products is never stored.*/
+csrRows_t SpGEMM(const dlong Nrows,
+                 const memory<dlong>& diagRowStarts,
+                 const memory<dlong>& diagCols,
+                 const memory<pfloat>& diagVals,
+                 const memory<dlong>& offdRowStarts,
+                 const memory<dlong>& offdCols,
+                 const memory<pfloat>& offdVals,
+                 const csrRows_t& B);
+
+} //namespace libp
+
+#endif
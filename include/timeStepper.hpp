@@ -34,6 +34,74 @@ SOFTWARE.
 
 namespace libp {
 
+/* Checkpoint of time stepper and solver state for restarting runs.
+
+   State is registered as named scalars and device arrays. Each rank
+   writes its part to <name>_S_RRRR.chk, and once every rank is done
+   rank 0 points the manifest <name>.chk at it. Checkpoints alternate
+   between two slots S=0,1, so a job killed while writing still leaves
+   the previous checkpoint intact. Restarting on the same number of
+   ranks and mesh partition continues the run bitwise identically.
+
+   Controlled by the solver settings
+     [CHECKPOINT INTERVAL]      time steps between checkpoints (0 disables)
+     [CHECKPOINT FILE NAME]
+     [RESTART FROM CHECKPOINT]  TRUE or FALSE
+*/
+class checkpoint_t {
+ public:
+  checkpoint_t() = default;
+  checkpoint_t(platform_t& _platform, settings_t& _settings, comm_t _comm) {
+    Setup(_platform, _settings, _comm);
+  }
+
+  void Setup(platform_t& _platform, settings_t& _settings, comm_t _comm);
+
+  void AddScalar(const std::string name, int& value);
+  void AddScalar(const std::string name, dfloat& value);
+
+  /*Fields are stored untyped, without re-typing the caller's buffer*/
+  template<typename T>
+  void AddField(const std::string name, deviceMemory<T> o_q) {
+    fields.push_back({name, static_cast<occa::memory>(o_q), o_q.length()*sizeof(T)});
+  }
+
+  /*Load all registered state if a restart was requested. Returns true
+    if the state was loaded*/
+  bool Restart();
+
+  /*Write all registered state if tstep is a checkpoint step*/
+  void Write(const int tstep);
+
+ private:
+  struct scalar_t {
+    std::string name;
+    int* i;
+    dfloat* d;
+  };
+
+  struct field_t {
+    std::string name;
+    occa::memory o_q;
+    size_t bytes;
+  };
+
+  platform_t platform;
+  comm_t comm;
+
+  std::string baseName;
+  int interval=0;
+  bool restart=false;
+
+  int slot=1;
+  int lastStep=-1;
+
+  std::vector<scalar_t> scalars;
+  std::vector<field_t> fields;
+
+  std::string FileName(const int s, const int r) const;
+};
+
 //forward declare
 namespace TimeStepper { class timeStepperBase_t; }
 
@@ -64,6 +132,9 @@ class timeStepper_t {
 
 namespace TimeStepper {
 
+void AddSettings(settings_t& settings);
+void ReportSettings(settings_t& settings);
+
 //base time stepper class
 class timeStepperBase_t {
 public:
@@ -75,6 +146,8 @@ public:
 
   dfloat dt;
 
+  int dtUpdateInterval=0;
+
   timeStepperBase_t(dlong Nelements, dlong NhaloElements,
                     int Np, int Nfields,
                     platform_t& _platform, comm_t _comm):
@@ -85,10 +158,35 @@ public:
 
   virtual void Run(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat start, dfloat end)=0;
 
+  /*Register stepper state needed to restart from a checkpoint*/
+  virtual void SetupCheckpoint(checkpoint_t& checkpoint) {
+    checkpoint.AddScalar("dt", dt);
+  }
+
+  /*Set up checkpointing of the solution, the Run loop counters, and the
+    stepper and solver state. Returns true if restarting from a checkpoint*/
+  bool Restart(checkpoint_t& checkpoint, solver_t& solver,
+               deviceMemory<dfloat>& o_q,
+               dfloat& time, dfloat& outputTime, int& tstep);
+
   void SetTimeStep(dfloat dt_) {dt = dt_;};
 
   dfloat GetTimeStep() {return dt;};
 
+  /*CFL-adaptive time step control. Every [TIME STEP UPDATE INTERVAL]
+    steps the solver's stable time step estimate is started before the
+    step and applied after it, so its global reduction overlaps the step*/
+  void TimeStepUpdateSetup(solver_t& solver);
+  bool TimeStepUpdateStart(solver_t& solver, deviceMemory<dfloat>& o_q,
+                           const dfloat time, const int tstep);
+  void TimeStepUpdateFinish(solver_t& solver, const bool updating);
+
+  /*Change the time step mid-run. Steppers with history override this*/
+  virtual void UpdateTimeStep(dfloat dt_) {dt = dt_;};
+
+  /*Steppers whose Run loop applies CFL time step updates override this*/
+  virtual bool SupportsTimeStepUpdate() {return false;};
+
   virtual dfloat GetGamma() {
     LIBP_FORCE_ABORT("GetGamma() not available in this Timestepper");
     return 0.0;
@@ -104,18 +202,30 @@ protected:
   memory<dfloat> ab_a;
   deviceMemory<dfloat> o_ab_a;
 
+  //sizes of the previous two steps, and coefficients for variable steps
+  dfloat dtHistory[2];
+  memory<dfloat> ab_v;
+  deviceMemory<dfloat> o_ab_v;
+
   deviceMemory<dfloat> o_rhsq;
 
   kernel_t updateKernel;
 
   virtual void Step(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat time, dfloat dt, int order);
 
+  virtual void SetupCheckpoint(checkpoint_t& checkpoint);
+
+  deviceMemory<dfloat> Coefficients(const int order);
+  void ShiftHistory();
+
 public:
   ab3(dlong Nelements, dlong NhaloElements,
       int Np, int Nfields,
       platform_t& _platform, comm_t _comm);
 
   void Run(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat start, dfloat end);
+
+  bool SupportsTimeStepUpdate() {return true;};
 };
 
 /* Low-Storage Explicit Runge-Kutta, order 4 */
@@ -139,6 +249,8 @@ public:
          platform_t& _platform, comm_t _comm);
 
   void Run(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat start, dfloat end);
+
+  bool SupportsTimeStepUpdate() {return true;};
 };
 
 /* Low-Storage Explicit Runge-Kutta, order 4 */
@@ -163,6 +275,8 @@ public:
          platform_t& _platform, comm_t _comm);
 
   void Run(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat start, dfloat end);
+
+  bool SupportsTimeStepUpdate() {return true;};
 };
 
 
@@ -215,6 +329,8 @@ protected:
 
   virtual void Step(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat time, dfloat dt);
 
+  virtual void SetupCheckpoint(checkpoint_t& checkpoint);
+
   virtual dfloat Estimater(deviceMemory<dfloat>& o_q);
 
 public:
@@ -245,6 +361,8 @@ protected:
 
   virtual void Step(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat time, dfloat dt, int order);
 
+  virtual void SetupCheckpoint(checkpoint_t& checkpoint);
+
   virtual void UpdateCoefficients();
 
 public:
@@ -307,6 +425,8 @@ protected:
 
   virtual void Step(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat time, dfloat dt);
 
+  virtual void SetupCheckpoint(checkpoint_t& checkpoint);
+
   dfloat Estimater(deviceMemory<dfloat>& o_q);
 
   void UpdateCoefficients();
@@ -372,6 +492,8 @@ protected:
 
   virtual void Step(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat time, dfloat dt);
 
+  virtual void SetupCheckpoint(checkpoint_t& checkpoint);
+
   dfloat Estimater(deviceMemory<dfloat>& o_q);
 
   void UpdateCoefficients();
@@ -404,6 +526,8 @@ protected:
 
   virtual void Step(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat time, dfloat dt, int order);
 
+  virtual void SetupCheckpoint(checkpoint_t& checkpoint);
+
 public:
   extbdf3(dlong Nelements, dlong NhaloElements,
       int Np, int Nfields,
@@ -431,6 +555,8 @@ protected:
 
   virtual void Step(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat time, dfloat dt, int order);
 
+  virtual void SetupCheckpoint(checkpoint_t& checkpoint);
+
 public:
   ssbdf3(dlong Nelements, dlong NhaloElements,
       int Np, int Nfields,
@@ -466,6 +592,8 @@ protected:
 
   virtual void Step(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat time, dfloat dt, int order);
 
+  virtual void SetupCheckpoint(checkpoint_t& checkpoint);
+
 public:
   mrab3(dlong _Nelements, dlong _NhaloElements,
          int _Np, int _Nfields,
@@ -501,6 +629,8 @@ protected:
 
   virtual void Step(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat time, dfloat dt, int order);
 
+  virtual void SetupCheckpoint(checkpoint_t& checkpoint);
+
   void UpdateCoefficients();
 
 public:
@@ -528,6 +658,8 @@ private:
 
   void Step(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat time, dfloat dt, int order);
 
+  void SetupCheckpoint(checkpoint_t& checkpoint);
+
 public:
   ab3_pml(dlong Nelements, dlong NpmlElements, dlong NhaloElements,
           int Np, int Nfields, int Npmlfields,
@@ -545,6 +677,8 @@ private:
 
   void Step(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat time, dfloat dt);
 
+  void SetupCheckpoint(checkpoint_t& checkpoint);
+
 public:
   lserk4_pml(dlong Nelements, dlong NpmlElements, dlong NhaloElements,
             int Np, int Nfields, int Npmlfields,
@@ -562,6 +696,8 @@ private:
 
   void Step(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat time, dfloat dt);
 
+  void SetupCheckpoint(checkpoint_t& checkpoint);
+
 public:
   ssprk2_pml(dlong Nelements, dlong NpmlElements, dlong NhaloElements,
             int Np, int Nfields, int Npmlfields,
@@ -589,6 +725,8 @@ private:
 
   void Step(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat time, dfloat dt);
 
+  void SetupCheckpoint(checkpoint_t& checkpoint);
+
 public:
   dopri5_pml(dlong Nelements, dlong NpmlElements, dlong NhaloElements,
             int Np, int Nfields, int Npmlfields,
@@ -611,6 +749,8 @@ private:
 
   void Step(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat time, dfloat dt, int order);
 
+  void SetupCheckpoint(checkpoint_t& checkpoint);
+
 public:
   saab3_pml(dlong Nelements, dlong NpmlElements, dlong NhaloElements,
             int Np, int Nfields, int _Npmlfields,
@@ -643,6 +783,8 @@ private:
 
   void Step(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat time, dfloat dt);
 
+  void SetupCheckpoint(checkpoint_t& checkpoint);
+
 public:
   sark4_pml(dlong Nelements, dlong NpmlElements, dlong NhaloElements,
             int Np, int Nfields, int _Npmlfields,
@@ -674,6 +816,8 @@ private:
 
   void Step(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat time, dfloat dt);
 
+  void SetupCheckpoint(checkpoint_t& checkpoint);
+
 public:
   sark5_pml(dlong Nelements, dlong NpmlElements, dlong NhaloElements,
             int Np, int Nfields, int _Npmlfields,
@@ -694,6 +838,8 @@ private:
 
   void Step(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat time, dfloat dt, int order);
 
+  void SetupCheckpoint(checkpoint_t& checkpoint);
+
 public:
   mrab3_pml(dlong Nelements, dlong NpmlElements, dlong NhaloElements,
             int Np, int Nfields, int _Npmlfields, platform_t& _platform, mesh_t& _mesh);
@@ -717,6 +863,8 @@ private:
 
   void Step(solver_t& solver, deviceMemory<dfloat>& o_q, dfloat time, dfloat dt, int order);
 
+  void SetupCheckpoint(checkpoint_t& checkpoint);
+
 public:
   mrsaab3_pml(dlong Nelements, dlong NpmlElements, dlong NhaloElements,
             int Np, int Nfields, int _Npmlfields,
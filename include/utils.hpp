@@ -35,6 +35,7 @@ SOFTWARE.
 #include <memory>
 #include <algorithm>
 #include <typeinfo>
+#include <type_traits>
 #include <cmath>
 #include <occa.hpp>
 #include "types.h"
@@ -43,8 +44,58 @@ namespace libp {
 
 using properties_t = occa::json;
 using device_t = occa::device;
-using kernel_t = occa::kernel;
 using stream_t = occa::stream;
+using streamTag_t = occa::streamTag;
+
+/*occa::kernel which reports its launches to the profiler*/
+class kernel_t: public occa::kernel {
+ public:
+  kernel_t() = default;
+  kernel_t(const occa::kernel& k): occa::kernel(k) {}
+
+  /*Performance model of one launch: bytes moved and flops done per unit
+    of work, where the work is the launch argument at index workArg,
+    e.g. the element or entry count*/
+  void SetModel(const double bytes, const double flops, const int workArg=0) {
+    bytesPerWork = bytes;
+    flopsPerWork = flops;
+    modelArg = workArg;
+  }
+
+  template<typename... Args>
+  void operator()(const Args&... args) const {
+    if (launchStart) launchStart(*this);
+    occa::kernel::operator()(args...);
+    if (launchEnd) launchEnd(*this, Work(args...));
+  }
+
+  double bytesPerWork=0.0;
+  double flopsPerWork=0.0;
+
+  /*Set by the profiler while it is enabled*/
+  static void (*launchStart)(const kernel_t& k);
+  static void (*launchEnd)(const kernel_t& k, const double work);
+
+ private:
+  int modelArg=0;
+
+  template<typename T>
+  static double WorkValue(const T& arg) {
+    if constexpr (std::is_arithmetic<T>::value) {
+      return static_cast<double>(arg);
+    } else {
+      return 0.0;
+    }
+  }
+
+  template<typename... Args>
+  double Work(const Args&... args) const {
+    double work=0.0;
+    int n=0;
+    ((work = (n++==modelArg) ? WorkValue(args) : work), ...);
+    return work;
+  }
+};
 
 //error codes
 #define LIBP_SUCCESS 0
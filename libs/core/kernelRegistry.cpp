@@ -0,0 +1,141 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "kernelRegistry.hpp"
+
+namespace libp {
+
+namespace {
+
+/*broadcast a string from rank 0*/
+void BcastString(std::string& str, comm_t& comm) {
+  int length = static_cast<int>(str.size());
+  comm.Bcast(length, 0);
+
+  memory<char> buf(length+1);
+  if (comm.rank()==0) std::copy(str.begin(), str.end(), buf.ptr());
+  comm.Bcast(buf, 0, length);
+
+  str = std::string(buf.ptr(), length);
+}
+
+} //namespace
+
+kernelRegistry_t::kernelRegistry_t(const std::string cacheDir,
+                                   const std::string _deviceTag,
+                                   comm_t _comm):
+  comm(_comm), deviceTag(_deviceTag) {
+
+  fileName = cacheDir + "/kernelRegistry.dat";
+
+  if (comm.rank()==0) Load();
+}
+
+/*One entry per line: key|config|time|binaryHash*/
+void kernelRegistry_t::Load() {
+  FILE *fp = fopen(fileName.c_str(), "r");
+  if (!fp) return;
+
+  char line[BUFSIZ];
+  while (fgets(line, BUFSIZ, fp)) {
+    std::string str(line);
+    if (str.size() && str.back()=='\n') str.pop_back();
+
+    size_t p0 = str.find('|');
+    size_t p1 = (p0==std::string::npos) ? p0 : str.find('|', p0+1);
+    size_t p2 = (p1==std::string::npos) ? p1 : str.find('|', p1+1);
+    if (p2==std::string::npos) continue; //malformed line
+
+    entry_t entry;
+    entry.config = str.substr(p0+1, p1-p0-1);
+    entry.time = std::atof(str.substr(p1+1, p2-p1-1).c_str());
+    entry.binaryHash = str.substr(p2+1);
+
+    //later lines replace earlier ones
+    entries[str.substr(0, p0)] = entry;
+  }
+  fclose(fp);
+}
+
+std::string kernelRegistry_t::Key(const std::string kernelFileName,
+                                  const std::string kernelName,
+                                  const properties_t& kernelInfo) const {
+  const std::string definesHash = occa::hash(kernelInfo["defines"].dump(0)).getString();
+  return deviceTag + " " + kernelFileName + ":" + kernelName + " " + definesHash;
+}
+
+bool kernelRegistry_t::Find(const std::string key, entry_t& entry) {
+
+  int found = 0;
+  if (comm.rank()==0) {
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+      entry = it->second;
+      found = 1;
+    }
+  }
+  comm.Bcast(found, 0);
+
+  if (found) {
+    BcastString(entry.config, comm);
+    BcastString(entry.binaryHash, comm);
+    comm.Bcast(entry.time, 0);
+  }
+  return found;
+}
+
+bool kernelRegistry_t::Verify(const std::string key, const entry_t& entry,
+                              const std::string binaryFileName) {
+
+  int valid = 0;
+  if (comm.rank()==0) {
+    valid = (entry.binaryHash.size()
+             && occa::hashFile(binaryFileName).getString()==entry.binaryHash) ? 1 : 0;
+    if (!valid) entries.erase(key);
+  }
+  comm.Bcast(valid, 0);
+
+  return valid;
+}
+
+void kernelRegistry_t::Record(const std::string key, const entry_t& entry) {
+
+  if (comm.rank()==0) {
+    entries[key] = entry;
+
+    FILE *fp = fopen(fileName.c_str(), "a");
+    LIBP_WARNING("Unable to write kernel registry " << fileName, fp==nullptr);
+    if (fp) {
+      fprintf(fp, "%s|%s|%g|%s\n", key.c_str(), entry.config.c_str(),
+              entry.time, entry.binaryHash.c_str());
+      fclose(fp);
+    }
+  }
+  comm.Barrier();
+}
+
+} //namespace libp
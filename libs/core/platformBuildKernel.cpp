@@ -25,6 +25,7 @@ SOFTWARE.
 */
 
 #include "platform.hpp"
+#include <filesystem>
 
 namespace libp {
 
@@ -36,19 +37,112 @@ kernel_t platform_t::buildKernel(std::string fileName,
 
   kernel_t kernel;
 
-  //build on root first
-  if (!rank())
-    kernel = device.buildKernel(fileName, kernelName, kernelInfo);
+  settings_t& Settings = settings();
+  comm_t& nodeComm = iplatform->nodeComm;
 
-  comm.Barrier();
+  if (Settings.compareSetting("KERNEL BUILD", "NODE")) {
+    //one rank per node builds into the node-local cache
+    if (!nodeComm.rank())
+      kernel = device.buildKernel(fileName, kernelName, kernelInfo);
+
+    nodeComm.Barrier();
+
+    if (nodeComm.rank())
+      kernel = device.buildKernel(fileName, kernelName, kernelInfo);
+
+  } else if (Settings.compareSetting("KERNEL BUILD", "BROADCAST")) {
+    //rank 0 builds and ships the binaries to each node's local cache
+    if (!rank())
+      kernel = device.buildKernel(fileName, kernelName, kernelInfo);
+
+    if (!nodeComm.rank())
+      BcastKernelCache(kernel);
+
+    nodeComm.Barrier();
 
-  //remaining ranks find the cached version (ideally)
-  if (rank())
-    kernel = device.buildKernel(fileName, kernelName, kernelInfo);
+    if (rank())
+      kernel = device.buildKernel(fileName, kernelName, kernelInfo);
+
+  } else {
+    //build on root first
+    if (!rank())
+      kernel = device.buildKernel(fileName, kernelName, kernelInfo);
+
+    comm.Barrier();
+
+    //remaining ranks find the cached version (ideally)
+    if (rank())
+      kernel = device.buildKernel(fileName, kernelName, kernelInfo);
+  }
 
   comm.Barrier();
 
   return kernel;
 }
 
+/*Copy the OCCA cache entry of a kernel built on rank 0 into LOCAL CACHE DIR
+  on every node root. Collective over the node roots.*/
+void platform_t::BcastKernelCache(kernel_t& kernel) {
+
+  namespace fs = std::filesystem;
+
+  comm_t& rootComm = iplatform->nodeRootComm;
+
+  //rank 0 lists the files in the kernel's cache entry, relative to its cache dir
+  std::vector<std::string> files;
+  if (!rank()) {
+    const fs::path cachePath = fs::path(cacheDir());
+    const fs::path entryPath = fs::path(kernel.binaryFilename()).parent_path();
+    for (const auto& file : fs::recursive_directory_iterator(entryPath)) {
+      if (file.is_regular_file())
+        files.push_back(fs::relative(file.path(), cachePath).string());
+    }
+  }
+
+  int Nfiles = static_cast<int>(files.size());
+  rootComm.Bcast(Nfiles, 0);
+  files.resize(Nfiles);
+
+  for (int n=0;n<Nfiles;++n) {
+    //file name
+    int nameLength = static_cast<int>(files[n].size());
+    rootComm.Bcast(nameLength, 0);
+
+    memory<char> name(nameLength+1);
+    if (!rank()) std::copy(files[n].begin(), files[n].end(), name.ptr());
+    rootComm.Bcast(name, 0, nameLength);
+    files[n] = std::string(name.ptr(), nameLength);
+
+    //file contents
+    memory<char> contents;
+    int length = 0;
+    if (!rank()) {
+      const std::string path = cacheDir() + "/" + files[n];
+      length = static_cast<int>(fs::file_size(path));
+      contents.malloc(length);
+
+      FILE *fp = fopen(path.c_str(), "rb");
+      LIBP_ABORT("Cannot read kernel binary " << path,
+                 !fp);
+      const size_t Nread = fread(contents.ptr(), 1, length, fp);
+      fclose(fp);
+      LIBP_ABORT("Error reading kernel binary " << path,
+                 Nread!=static_cast<size_t>(length));
+    }
+    rootComm.Bcast(length, 0);
+    if (rank()) contents.malloc(length);
+    rootComm.Bcast(contents, 0, length);
+
+    //write into the node-local cache
+    const fs::path path = fs::path(iplatform->localCacheDir) / files[n];
+    fs::create_directories(path.parent_path());
+
+    FILE *fp = fopen(path.c_str(), "wb");
+    LIBP_ABORT("Cannot write kernel binary " << path.string(),
+               !fp);
+    fwrite(contents.ptr(), 1, length, fp);
+    fclose(fp);
+  }
+}
+
 } //namespace libp
@@ -175,6 +175,34 @@ void platform_t::DeviceConfig(){
   }
   setCacheDir(cacheDir);
 
+  //group ranks by node, keyed on the lowest rank with the same hostname
+  int nodeId = rank();
+  for (int n=0; n<rank(); n++){
+    if (!strcmp(hostname.ptr(), hostnames.ptr()+n*MAX_PROCESSOR_NAME)) {
+      nodeId = n;
+      break;
+    }
+  }
+  iplatform->nodeComm = comm.Split(nodeId, rank());
+  iplatform->nodeRootComm = comm.Split(localRank, rank());
+
+  //keep compiled kernels on node-local storage
+  if (!Settings.compareSetting("KERNEL BUILD", "SHARED")) {
+    Settings.getSetting("LOCAL CACHE DIR", iplatform->localCacheDir);
+
+    //in BROADCAST mode only rank 0 compiles, into the shared cache
+    if (Settings.compareSetting("KERNEL BUILD", "NODE") || rank()!=0)
+      occa::env::setOccaCacheDir(iplatform->localCacheDir);
+  }
+
+  //tuned kernel configurations are recorded per device
+  std::string deviceTag = device.mode();
+  if (device.mode()=="OpenMP")
+    deviceTag += " threads=" + std::to_string(omp_get_max_threads());
+  else if (device.mode()!="Serial")
+    deviceTag += " device=" + std::to_string(device_id);
+  iplatform->registry = kernelRegistry_t(cacheDir, deviceTag, comm);
+
   comm.Barrier();
 }
 
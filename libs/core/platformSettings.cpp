@@ -53,6 +53,34 @@ platformSettings_t::platformSettings_t(comm_t _comm):
   newSetting("CACHE DIR",
              LIBP_DIR "/.occa",
              "Path for OCCA to place kernel cache");
+
+  newSetting("KERNEL BUILD",
+             "SHARED",
+             "Which ranks compile kernels: rank 0 into the shared cache, one rank per node into LOCAL CACHE DIR, or rank 0 broadcasting binaries to LOCAL CACHE DIR",
+             {"SHARED", "NODE", "BROADCAST"});
+
+  newSetting("LOCAL CACHE DIR",
+             "/tmp/libp",
+             "Node-local path for the kernel cache in NODE and BROADCAST kernel builds");
+
+  newSetting("PROFILER",
+             "NONE",
+             "Profile named regions and MPI exchanges, reporting at exit, optionally with a JSON summary and per-rank Chrome traces",
+             {"NONE", "REPORT", "JSON", "TRACE"});
+
+  newSetting("PROFILER OUTPUT FILE",
+             "profile",
+             "Base name of the profiler JSON and trace files");
+
+  newSetting("KERNEL TUNING",
+             "FALSE",
+             "Time kernel variants at setup and record the fastest in the kernel registry",
+             {"TRUE", "FALSE"});
+
+  newSetting("WARM UP",
+             "FALSE",
+             "Build and tune kernels for this problem, then exit without running",
+             {"TRUE", "FALSE"});
 }
 
 void platformSettings_t::report() {
@@ -70,6 +98,21 @@ void platformSettings_t::report() {
         ||compareSetting("THREAD MODEL","HIP")
         ||compareSetting("THREAD MODEL","OpenCL") ))
       reportSetting("DEVICE NUMBER");
+
+    reportSetting("KERNEL BUILD");
+
+    if (!compareSetting("KERNEL BUILD","SHARED"))
+      reportSetting("LOCAL CACHE DIR");
+
+    reportSetting("KERNEL TUNING");
+
+    reportSetting("PROFILER");
+
+    if (compareSetting("PROFILER","JSON") || compareSetting("PROFILER","TRACE"))
+      reportSetting("PROFILER OUTPUT FILE");
+
+    if (compareSetting("WARM UP","TRUE"))
+      reportSetting("WARM UP");
   }
 }
 
@@ -0,0 +1,97 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "platform.hpp"
+#include "timer.hpp"
+
+namespace libp {
+
+kernel_t platform_t::tuneKernel(std::string fileName,
+                                std::string kernelName,
+                                properties_t kernelInfo,
+                                const std::string define,
+                                const std::vector<int> candidates,
+                                std::function<void(kernel_t&)> launch){
+
+  assertInitialized();
+
+  LIBP_ABORT("No candidate values of " << define << " given to tune " << kernelName,
+             candidates.size()==0);
+
+  kernelRegistry_t& registry = kernelRegistry();
+  const std::string key = registry.Key(fileName, kernelName, kernelInfo);
+
+  //reuse an earlier tuning result, unless its binary has since changed
+  kernelRegistry_t::entry_t entry;
+  if (registry.Find(key, entry)) {
+    const size_t split = entry.config.find('=');
+    if (split!=std::string::npos && entry.config.substr(0, split)==define) {
+      properties_t tunedInfo = kernelInfo;
+      tunedInfo["defines/" + define] = std::stoi(entry.config.substr(split+1));
+      kernel_t kernel = buildKernel(fileName, kernelName, tunedInfo);
+      if (registry.Verify(key, entry, kernel.binaryFilename()))
+        return kernel;
+    }
+  }
+
+  constexpr int Ntests = 10;
+
+  const int Ncandidates = static_cast<int>(candidates.size());
+  std::vector<kernel_t> kernels(Ncandidates);
+  memory<double> times(Ncandidates);
+
+  for (int n=0;n<Ncandidates;++n) {
+    kernelInfo["defines/" + define] = candidates[n];
+    kernels[n] = buildKernel(fileName, kernelName, kernelInfo);
+
+    launch(kernels[n]); //warm up
+
+    timePoint_t start = PlatformTime(*this);
+    for (int t=0;t<Ntests;++t) launch(kernels[n]);
+    timePoint_t end = PlatformTime(*this);
+
+    times[n] = ElapsedTime(start, end)/Ntests;
+  }
+
+  //the slowest rank decides
+  comm.Allreduce(times, Comm::Max);
+
+  int best = 0;
+  for (int n=1;n<Ncandidates;++n) {
+    if (times[n] < times[best]) best = n;
+  }
+
+  entry.config = define + "=" + std::to_string(candidates[best]);
+  entry.time = times[best];
+  if (rank()==0)
+    entry.binaryHash = occa::hashFile(kernels[best].binaryFilename()).getString();
+  registry.Record(key, entry);
+
+  return kernels[best];
+}
+
+} //namespace libp
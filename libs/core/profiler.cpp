@@ -0,0 +1,546 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "profiler.hpp"
+#include "timer.hpp"
+#include <map>
+#include <set>
+#include <limits>
+
+namespace libp {
+
+void (*kernel_t::launchStart)(const kernel_t& k) = nullptr;
+void (*kernel_t::launchEnd)(const kernel_t& k, const double work) = nullptr;
+
+namespace Profiler {
+
+namespace {
+
+struct region_t {
+  long long int count=0;
+  double hostTime=0.0;
+  double deviceTime=0.0;
+  double bytes=0.0;
+  double flops=0.0;
+};
+
+struct launches_t {
+  long long int count=0;
+  double deviceTime=0.0;
+  double bytes=0.0;
+  double flops=0.0;
+};
+
+struct exchange_t {
+  long long int count=0;
+  double bytes=0.0;
+  double waitTime=0.0;
+};
+
+struct open_t {
+  std::string path;
+  timePoint_t start;
+  streamTag_t tag;
+};
+
+struct pending_t {
+  std::string path;
+  streamTag_t start, end;
+};
+
+struct pendingLaunch_t {
+  std::string name;
+  streamTag_t start, end;
+};
+
+struct event_t {
+  std::string name;
+  double start, duration;
+};
+
+/*device tags are resolved in batches to avoid syncing at each region*/
+constexpr size_t maxPending = 256;
+constexpr size_t maxEvents = 1000000;
+
+struct state_t {
+  bool enabled=false;
+  bool writeJson=false;
+  bool writeTrace=false;
+  std::string fileName;
+
+  device_t device;
+  comm_t comm;
+  timePoint_t epoch;
+
+  std::vector<open_t> stack;
+  std::vector<pending_t> pending;
+  std::vector<pendingLaunch_t> pendingLaunches;
+  streamTag_t launchTag;
+  std::vector<event_t> events;
+  size_t droppedEvents=0;
+
+  std::map<std::string, region_t> regions;
+  std::map<std::string, exchange_t> exchanges;
+  std::map<std::string, launches_t> launches;
+};
+
+state_t state;
+
+void ResolvePending() {
+  for (auto& p : state.pending) {
+    state.regions[p.path].deviceTime += state.device.timeBetween(p.start, p.end);
+  }
+  state.pending.clear();
+
+  for (auto& p : state.pendingLaunches) {
+    state.launches[p.name].deviceTime += state.device.timeBetween(p.start, p.end);
+  }
+  state.pendingLaunches.clear();
+}
+
+void LaunchStart(const kernel_t& /*kernel*/) {
+  state.launchTag = state.device.tagStream();
+}
+
+/*Each launch is timed between stream tags placed around it, and its
+  model scaled by the launch's work*/
+void LaunchEnd(const kernel_t& kernel, const double work) {
+  const std::string name = kernel.name();
+
+  launches_t& record = state.launches[name];
+  record.count++;
+  record.bytes += kernel.bytesPerWork*work;
+  record.flops += kernel.flopsPerWork*work;
+
+  state.pendingLaunches.push_back({name, state.launchTag, state.device.tagStream()});
+  if (state.pendingLaunches.size() >= maxPending) ResolvePending();
+}
+
+/*Union of the keys of every rank, ordered, on every rank*/
+template<typename T>
+std::vector<std::string> GlobalKeys(const std::map<std::string, T>& records) {
+  comm_t& comm = state.comm;
+
+  std::string keys;
+  for (auto& r : records) keys += r.first + '\n';
+
+  int length = static_cast<int>(keys.size());
+  memory<int> lengths(comm.size());
+  comm.Gather(length, lengths, 0);
+
+  memory<int> offsets(comm.size()+1);
+  offsets[0] = 0;
+  for (int r=0;r<comm.size();++r) offsets[r+1] = offsets[r] + lengths[r];
+
+  memory<char> sendKeys(length+1);
+  std::copy(keys.begin(), keys.end(), sendKeys.ptr());
+  memory<char> recvKeys(offsets[comm.size()]+1);
+  comm.Gatherv(sendKeys, length, recvKeys, lengths, offsets, 0);
+
+  std::string allKeys;
+  if (comm.rank()==0) {
+    std::set<std::string> keySet;
+    std::string all(recvKeys.ptr(), offsets[comm.size()]);
+    size_t pos=0, next;
+    while ((next=all.find('\n', pos))!=std::string::npos) {
+      keySet.insert(all.substr(pos, next-pos));
+      pos = next+1;
+    }
+    for (auto& k : keySet) allKeys += k + '\n';
+  }
+
+  int allLength = static_cast<int>(allKeys.size());
+  comm.Bcast(allLength, 0);
+  memory<char> buf(allLength+1);
+  if (comm.rank()==0) std::copy(allKeys.begin(), allKeys.end(), buf.ptr());
+  comm.Bcast(buf, 0, allLength);
+  allKeys = std::string(buf.ptr(), allLength);
+
+  std::vector<std::string> result;
+  size_t pos=0, next;
+  while ((next=allKeys.find('\n', pos))!=std::string::npos) {
+    result.push_back(allKeys.substr(pos, next-pos));
+    pos = next+1;
+  }
+  return result;
+}
+
+/*Reduce Nvals values per key into min, max, and sum over the ranks holding
+  the key. Missing keys are skipped in the min and max.*/
+void ReduceValues(memory<double> vals, const int Nvals,
+                  memory<double> minVals, memory<double> maxVals,
+                  memory<double> sumVals, memory<double> Nranks,
+                  memory<double> present) {
+  comm_t& comm = state.comm;
+  const size_t N = vals.length();
+  const double huge = std::numeric_limits<double>::max();
+
+  for (size_t n=0;n<N;++n) {
+    const bool has = present[n/Nvals] > 0.0;
+    minVals[n] = has ? vals[n] :  huge;
+    maxVals[n] = has ? vals[n] : -huge;
+    sumVals[n] = vals[n];
+  }
+  comm.Reduce(minVals, 0, Comm::Min);
+  comm.Reduce(maxVals, 0, Comm::Max);
+  comm.Reduce(sumVals, 0, Comm::Sum);
+
+  Nranks.copyFrom(present);
+  comm.Reduce(Nranks, 0, Comm::Sum);
+}
+
+int Depth(const std::string& path) {
+  return static_cast<int>(std::count(path.begin(), path.end(), '/'));
+}
+
+std::string Leaf(const std::string& path) {
+  const size_t pos = path.rfind('/');
+  return (pos==std::string::npos) ? path : path.substr(pos+1);
+}
+
+} //namespace
+
+void Setup(settings_t& settings, device_t& device, comm_t comm) {
+  if (state.enabled || settings.compareSetting("PROFILER", "NONE")) return;
+
+  state.enabled = true;
+  state.writeJson  = settings.compareSetting("PROFILER", "JSON")
+                  || settings.compareSetting("PROFILER", "TRACE");
+  state.writeTrace = settings.compareSetting("PROFILER", "TRACE");
+  settings.getSetting("PROFILER OUTPUT FILE", state.fileName);
+
+  state.device = device;
+  state.comm = comm;
+  state.epoch = Time();
+
+  kernel_t::launchStart = LaunchStart;
+  kernel_t::launchEnd = LaunchEnd;
+}
+
+bool Enabled() {
+  return state.enabled;
+}
+
+void Start(const std::string& name) {
+  if (!state.enabled) return;
+
+  open_t region;
+  region.path = state.stack.size() ? state.stack.back().path + "/" + name : name;
+  region.tag = state.device.tagStream();
+  region.start = Time();
+  state.stack.push_back(region);
+}
+
+void Stop(const std::string& name,
+          const double bytes,
+          const double flops) {
+  if (!state.enabled) return;
+
+  const timePoint_t end = Time();
+
+  LIBP_ABORT("Profiler region " << name << " stopped without being started",
+             state.stack.size()==0);
+
+  open_t& region = state.stack.back();
+
+  LIBP_ABORT("Profiler region " << name << " stopped inside region " << region.path,
+             Leaf(region.path)!=name);
+
+  region_t& record = state.regions[region.path];
+  record.count++;
+  record.hostTime += ElapsedTime(region.start, end);
+  record.bytes += bytes;
+  record.flops += flops;
+
+  state.pending.push_back({region.path, region.tag, state.device.tagStream()});
+  if (state.pending.size() >= maxPending) ResolvePending();
+
+  if (state.writeTrace) {
+    if (state.events.size() < maxEvents) {
+      state.events.push_back({region.path,
+                              ElapsedTime(state.epoch, region.start),
+                              ElapsedTime(region.start, end)});
+    } else {
+      state.droppedEvents++;
+    }
+  }
+
+  state.stack.pop_back();
+}
+
+void Exchange(const std::string& name,
+              const double bytes,
+              const double waitTime) {
+  if (!state.enabled) return;
+
+  const std::string key = (state.stack.size() ? state.stack.back().path : std::string("(none)"))
+                          + "|" + name;
+
+  exchange_t& record = state.exchanges[key];
+  record.count++;
+  record.bytes += bytes;
+  record.waitTime += waitTime;
+}
+
+void Finalize() {
+  if (!state.enabled) return;
+
+  LIBP_WARNING("Profiler finalized with region " << state.stack.back().path << " still open",
+               state.stack.size()>0);
+
+  ResolvePending();
+
+  comm_t& comm = state.comm;
+  const int rank = comm.rank();
+  const int size = comm.size();
+
+  /*Regions*/
+  constexpr int NregionVals = 5;
+  std::vector<std::string> regionKeys = GlobalKeys(state.regions);
+  const int Nregions = static_cast<int>(regionKeys.size());
+
+  memory<double> vals(Nregions*NregionVals, 0.0);
+  memory<double> present(Nregions, 0.0);
+  for (int n=0;n<Nregions;++n) {
+    auto it = state.regions.find(regionKeys[n]);
+    if (it==state.regions.end()) continue;
+    present[n] = 1.0;
+    vals[n*NregionVals+0] = it->second.count;
+    vals[n*NregionVals+1] = it->second.hostTime;
+    vals[n*NregionVals+2] = it->second.deviceTime;
+    vals[n*NregionVals+3] = it->second.bytes;
+    vals[n*NregionVals+4] = it->second.flops;
+  }
+
+  memory<double> rMin(Nregions*NregionVals);
+  memory<double> rMax(Nregions*NregionVals);
+  memory<double> rSum(Nregions*NregionVals);
+  memory<double> rNranks(Nregions);
+  ReduceValues(vals, NregionVals, rMin, rMax, rSum, rNranks, present);
+
+  /*Exchanges*/
+  constexpr int NexchangeVals = 3;
+  std::vector<std::string> exchangeKeys = GlobalKeys(state.exchanges);
+  const int Nexchanges = static_cast<int>(exchangeKeys.size());
+
+  memory<double> xvals(Nexchanges*NexchangeVals, 0.0);
+  memory<double> xpresent(Nexchanges, 0.0);
+  for (int n=0;n<Nexchanges;++n) {
+    auto it = state.exchanges.find(exchangeKeys[n]);
+    if (it==state.exchanges.end()) continue;
+    xpresent[n] = 1.0;
+    xvals[n*NexchangeVals+0] = it->second.count;
+    xvals[n*NexchangeVals+1] = it->second.bytes;
+    xvals[n*NexchangeVals+2] = it->second.waitTime;
+  }
+
+  memory<double> xMin(Nexchanges*NexchangeVals);
+  memory<double> xMax(Nexchanges*NexchangeVals);
+  memory<double> xSum(Nexchanges*NexchangeVals);
+  memory<double> xNranks(Nexchanges);
+  ReduceValues(xvals, NexchangeVals, xMin, xMax, xSum, xNranks, xpresent);
+
+  /*Kernel launches*/
+  constexpr int NkernelVals = 4;
+  std::vector<std::string> kernelKeys = GlobalKeys(state.launches);
+  const int Nkernels = static_cast<int>(kernelKeys.size());
+
+  memory<double> kvals(Nkernels*NkernelVals, 0.0);
+  memory<double> kpresent(Nkernels, 0.0);
+  for (int n=0;n<Nkernels;++n) {
+    auto it = state.launches.find(kernelKeys[n]);
+    if (it==state.launches.end()) continue;
+    kpresent[n] = 1.0;
+    kvals[n*NkernelVals+0] = it->second.count;
+    kvals[n*NkernelVals+1] = it->second.deviceTime;
+    kvals[n*NkernelVals+2] = it->second.bytes;
+    kvals[n*NkernelVals+3] = it->second.flops;
+  }
+
+  memory<double> kMin(Nkernels*NkernelVals);
+  memory<double> kMax(Nkernels*NkernelVals);
+  memory<double> kSum(Nkernels*NkernelVals);
+  memory<double> kNranks(Nkernels);
+  ReduceValues(kvals, NkernelVals, kMin, kMax, kSum, kNranks, kpresent);
+
+  if (rank==0) {
+    printf("\nProfile over %d rank%s (min/avg/max across ranks)\n\n", size, (size>1) ? "s" : "");
+    printf("%-40s %10s %33s %12s %10s %10s\n",
+           "Region", "Calls", "Host time [s]", "Device [s]", "GB/s", "GFLOP/s");
+
+    for (int n=0;n<Nregions;++n) {
+      const double Nr = rNranks[n];
+      const double* mn = rMin.ptr() + n*NregionVals;
+      const double* mx = rMax.ptr() + n*NregionVals;
+      const double* sm = rSum.ptr() + n*NregionVals;
+
+      //rates use device time when the region enqueued device work
+      const double time = (sm[2]>0.0) ? sm[2]/Nr : sm[1]/Nr;
+      const double gbs    = (time>0.0) ? sm[3]/Nr/time/1.0e9 : 0.0;
+      const double gflops = (time>0.0) ? sm[4]/Nr/time/1.0e9 : 0.0;
+
+      const std::string name = std::string(2*Depth(regionKeys[n]), ' ') + Leaf(regionKeys[n]);
+      printf("%-40s %10lld %10.4e/%10.4e/%10.4e %12.4e %10.2f %10.2f\n",
+             name.c_str(), static_cast<long long int>(sm[0]/Nr),
+             mn[1], sm[1]/Nr, mx[1], sm[2]/Nr, gbs, gflops);
+    }
+
+    if (Nexchanges) {
+      printf("\n%-40s %10s %33s %33s\n",
+             "Exchange", "Calls", "MB", "Wait time [s]");
+      for (int n=0;n<Nexchanges;++n) {
+        const double Nr = xNranks[n];
+        const double* mn = xMin.ptr() + n*NexchangeVals;
+        const double* mx = xMax.ptr() + n*NexchangeVals;
+        const double* sm = xSum.ptr() + n*NexchangeVals;
+
+        const std::string& key = exchangeKeys[n];
+        const size_t split = key.find('|');
+        const std::string name = key.substr(0, split) + ": " + key.substr(split+1);
+        printf("%-40s %10lld %10.4e/%10.4e/%10.4e %10.4e/%10.4e/%10.4e\n",
+               name.c_str(), static_cast<long long int>(sm[0]/Nr),
+               mn[1]/1.0e6, sm[1]/Nr/1.0e6, mx[1]/1.0e6,
+               mn[2], sm[2]/Nr, mx[2]);
+      }
+    }
+
+    if (Nkernels) {
+      printf("\n%-40s %33s %33s %10s %10s\n",
+             "Kernel", "Launches", "Device time [s]", "GB/s", "GFLOP/s");
+      for (int n=0;n<Nkernels;++n) {
+        const double Nr = kNranks[n];
+        const double* mn = kMin.ptr() + n*NkernelVals;
+        const double* mx = kMax.ptr() + n*NkernelVals;
+        const double* sm = kSum.ptr() + n*NkernelVals;
+
+        const double time   = sm[1]/Nr;
+        const double gbs    = (time>0.0) ? sm[2]/Nr/time/1.0e9 : 0.0;
+        const double gflops = (time>0.0) ? sm[3]/Nr/time/1.0e9 : 0.0;
+
+        printf("%-40s %10lld/%10lld/%10lld %10.4e/%10.4e/%10.4e %10.2f %10.2f\n",
+               kernelKeys[n].c_str(),
+               static_cast<long long int>(mn[0]),
+               static_cast<long long int>(sm[0]/Nr),
+               static_cast<long long int>(mx[0]),
+               mn[1], time, mx[1], gbs, gflops);
+      }
+    }
+    printf("\n");
+
+    if (state.writeJson) {
+      std::string jsonFileName = state.fileName + ".json";
+      FILE *fp = fopen(jsonFileName.c_str(), "w");
+      LIBP_ABORT("Cannot open profile file " << jsonFileName,
+                 !fp);
+
+      fprintf(fp, "{\n  \"ranks\": %d,\n  \"regions\": [", size);
+      for (int n=0;n<Nregions;++n) {
+        const double Nr = rNranks[n];
+        const double* mn = rMin.ptr() + n*NregionVals;
+        const double* mx = rMax.ptr() + n*NregionVals;
+        const double* sm = rSum.ptr() + n*NregionVals;
+        fprintf(fp, "%s\n    {\"name\": \"%s\", \"ranks\": %d, \"calls\": %lld,"
+                    " \"hostTime\": {\"min\": %g, \"avg\": %g, \"max\": %g},"
+                    " \"deviceTime\": {\"min\": %g, \"avg\": %g, \"max\": %g},"
+                    " \"bytes\": %g, \"flops\": %g}",
+                (n==0) ? "" : ",",
+                regionKeys[n].c_str(), static_cast<int>(Nr),
+                static_cast<long long int>(sm[0]/Nr),
+                mn[1], sm[1]/Nr, mx[1],
+                mn[2], sm[2]/Nr, mx[2],
+                sm[3]/Nr, sm[4]/Nr);
+      }
+      fprintf(fp, "\n  ],\n  \"exchanges\": [");
+      for (int n=0;n<Nexchanges;++n) {
+        const double Nr = xNranks[n];
+        const double* mn = xMin.ptr() + n*NexchangeVals;
+        const double* mx = xMax.ptr() + n*NexchangeVals;
+        const double* sm = xSum.ptr() + n*NexchangeVals;
+
+        const std::string& key = exchangeKeys[n];
+        const size_t split = key.find('|');
+        fprintf(fp, "%s\n    {\"region\": \"%s\", \"name\": \"%s\", \"ranks\": %d, \"calls\": %lld,"
+                    " \"bytes\": {\"min\": %g, \"avg\": %g, \"max\": %g},"
+                    " \"waitTime\": {\"min\": %g, \"avg\": %g, \"max\": %g}}",
+                (n==0) ? "" : ",",
+                key.substr(0, split).c_str(), key.substr(split+1).c_str(),
+                static_cast<int>(Nr), static_cast<long long int>(sm[0]/Nr),
+                mn[1], sm[1]/Nr, mx[1],
+                mn[2], sm[2]/Nr, mx[2]);
+      }
+      fprintf(fp, "\n  ],\n  \"kernels\": [");
+      for (int n=0;n<Nkernels;++n) {
+        const double Nr = kNranks[n];
+        const double* mn = kMin.ptr() + n*NkernelVals;
+        const double* mx = kMax.ptr() + n*NkernelVals;
+        const double* sm = kSum.ptr() + n*NkernelVals;
+        fprintf(fp, "%s\n    {\"name\": \"%s\", \"ranks\": %d,"
+                    " \"launches\": {\"min\": %lld, \"avg\": %g, \"max\": %lld},"
+                    " \"deviceTime\": {\"min\": %g, \"avg\": %g, \"max\": %g},"
+                    " \"bytes\": %g, \"flops\": %g}",
+                (n==0) ? "" : ",",
+                kernelKeys[n].c_str(), static_cast<int>(Nr),
+                static_cast<long long int>(mn[0]), sm[0]/Nr,
+                static_cast<long long int>(mx[0]),
+                mn[1], sm[1]/Nr, mx[1],
+                sm[2]/Nr, sm[3]/Nr);
+      }
+      fprintf(fp, "\n  ]\n}\n");
+      fclose(fp);
+    }
+  }
+
+  /*Each rank writes its own trace, loadable in chrome://tracing or Perfetto*/
+  if (state.writeTrace) {
+    LIBP_WARNING("Profiler trace on rank " << rank << " dropped " << state.droppedEvents << " events",
+                 state.droppedEvents>0);
+
+    std::string traceFileName = state.fileName + "_" + std::to_string(rank) + ".trace.json";
+    FILE *fp = fopen(traceFileName.c_str(), "w");
+    LIBP_ABORT("Cannot open trace file " << traceFileName,
+               !fp);
+
+    fprintf(fp, "{\"traceEvents\": [");
+    for (size_t n=0;n<state.events.size();++n) {
+      const event_t& event = state.events[n];
+      fprintf(fp, "%s\n  {\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", \"pid\": %d, \"tid\": 0,"
+                  " \"ts\": %.3f, \"dur\": %.3f}",
+              (n==0) ? "" : ",",
+              Leaf(event.name).c_str(), event.name.c_str(), rank,
+              event.start*1.0e6, event.duration*1.0e6);
+    }
+    fprintf(fp, "\n]}\n");
+    fclose(fp);
+  }
+
+  kernel_t::launchStart = nullptr;
+  kernel_t::launchEnd = nullptr;
+  state = state_t();
+}
+
+} //namespace Profiler
+
+} //namespace libp
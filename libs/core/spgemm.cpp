@@ -0,0 +1,177 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "spgemm.hpp"
+
+namespace libp {
+
+//smallest power of two holding n entries at most half full
+static dlong hashTableSize(const dlong n) {
+  dlong size = 1;
+  while (size < 2*n) size *= 2;
+  return size;
+}
+
+//multiplicative hash of a global column id into a table of mask+1 slots
+static inline dlong hashSlot(const hlong col, const dlong mask) {
+  const uint64_t h = static_cast<uint64_t>(col)*0x9E3779B97F4A7C15ULL;
+  return static_cast<dlong>(h >> 32) & mask;
+}
+
+csrRows_t SpGEMM(const dlong Nrows,
+                 const memory<dlong>& diagRowStarts,
+                 const memory<dlong>& diagCols,
+                 const memory<pfloat>& diagVals,
+                 const memory<dlong>& offdRowStarts,
+                 const memory<dlong>& offdCols,
+                 const memory<pfloat>& offdVals,
+                 const csrRows_t& B) {
+
+  csrRows_t C;
+  C.Nrows = Nrows;
+  C.rowStarts.malloc(Nrows+1);
+  C.rowStarts[0] = 0;
+
+  //apply f(col, val) to each partial product A(i,k)*B(k,col) in row i of C
+  auto forEachProduct = [&](const dlong i, auto&& f) {
+    for (dlong j=diagRowStarts[i];j<diagRowStarts[i+1];j++) {
+      const dlong k = diagCols[j];
+      const dfloat Aval = diagVals[j];
+      for (dlong jj=B.rowStarts[k];jj<B.rowStarts[k+1];jj++)
+        f(B.cols[jj], Aval*B.vals[jj]);
+    }
+    for (dlong j=offdRowStarts[i];j<offdRowStarts[i+1];j++) {
+      const dlong k = offdCols[j];
+      const dfloat Aval = offdVals[j];
+      for (dlong jj=B.rowStarts[k];jj<B.rowStarts[k+1];jj++)
+        f(B.cols[jj], Aval*B.vals[jj]);
+    }
+  };
+
+  //count the partial products in each row to size the hash tables
+  memory<dlong> rowProducts(Nrows);
+  dlong maxProducts = 0;
+
+  #pragma omp parallel for reduction(max:maxProducts)
+  for (dlong i=0;i<Nrows;i++) {
+    dlong n = 0;
+    for (dlong j=diagRowStarts[i];j<diagRowStarts[i+1];j++) {
+      const dlong k = diagCols[j];
+      n += B.rowStarts[k+1]-B.rowStarts[k];
+    }
+    for (dlong j=offdRowStarts[i];j<offdRowStarts[i+1];j++) {
+      const dlong k = offdCols[j];
+      n += B.rowStarts[k+1]-B.rowStarts[k];
+    }
+    rowProducts[i] = n;
+    maxProducts = std::max(maxProducts, n);
+  }
+
+  const dlong Ntable = hashTableSize(maxProducts);
+
+  //symbolic pass, count the distinct columns in each row of C
+  #pragma omp parallel
+  {
+    std::vector<hlong> keys(Ntable, -1);
+    std::vector<dlong> slots;
+
+    #pragma omp for schedule(dynamic, 64)
+    for (dlong i=0;i<Nrows;i++) {
+      const dlong mask = hashTableSize(rowProducts[i])-1;
+
+      forEachProduct(i, [&](const hlong col, const dfloat) {
+        dlong s = hashSlot(col, mask);
+        while (keys[s]!=-1 && keys[s]!=col) s = (s+1) & mask;
+        if (keys[s]==-1) {
+          keys[s] = col;
+          slots.push_back(s);
+        }
+      });
+
+      C.rowStarts[i+1] = static_cast<dlong>(slots.size());
+
+      for (const dlong s : slots) keys[s] = -1;
+      slots.clear();
+    }
+  }
+
+  for (dlong i=0;i<Nrows;i++)
+    C.rowStarts[i+1] += C.rowStarts[i];
+
+  C.nnz = C.rowStarts[Nrows];
+  C.cols.malloc(C.nnz);
+  C.vals.malloc(C.nnz);
+
+  //numeric pass, accumulate each row and write it sorted by column
+  #pragma omp parallel
+  {
+    std::vector<hlong> keys(Ntable, -1);
+    std::vector<dfloat> vals(Ntable, 0.0);
+    std::vector<dlong> slots;
+    std::vector<std::pair<hlong, dfloat>> row;
+
+    #pragma omp for schedule(dynamic, 64)
+    for (dlong i=0;i<Nrows;i++) {
+      const dlong mask = hashTableSize(rowProducts[i])-1;
+
+      forEachProduct(i, [&](const hlong col, const dfloat val) {
+        dlong s = hashSlot(col, mask);
+        while (keys[s]!=-1 && keys[s]!=col) s = (s+1) & mask;
+        if (keys[s]==-1) {
+          keys[s] = col;
+          slots.push_back(s);
+        }
+        vals[s] += val;
+      });
+
+      for (const dlong s : slots) {
+        row.push_back({keys[s], vals[s]});
+        keys[s] = -1;
+        vals[s] = 0.0;
+      }
+      slots.clear();
+
+      std::sort(row.begin(), row.end(),
+                [](const std::pair<hlong, dfloat>& a,
+                   const std::pair<hlong, dfloat>& b) {
+                  return a.first < b.first;
+                });
+
+      dlong cnt = C.rowStarts[i];
+      for (const auto& entry : row) {
+        C.cols[cnt] = entry.first;
+        C.vals[cnt] = entry.second;
+        cnt++;
+      }
+      row.clear();
+    }
+  }
+
+  return C;
+}
+
+} //namespace libp
@@ -119,6 +119,14 @@ dfloat linAlg_t::min(const dlong N, deviceMemory<dfloat> o_a, comm_t comm) {
 
 // \max o_a
 dfloat linAlg_t::max(const dlong N, deviceMemory<dfloat> o_a, comm_t comm) {
+  dfloat globalmax = max(N, o_a);
+  comm.Allreduce(globalmax, Comm::Max);
+
+  return globalmax;
+}
+
+// \max o_a, rank-local
+dfloat linAlg_t::max(const dlong N, deviceMemory<dfloat> o_a) {
   int Nblock = (N+blocksize-1)/blocksize;
   Nblock = (Nblock>blocksize) ? blocksize : Nblock; //limit to blocksize entries
 
@@ -128,10 +136,7 @@ dfloat linAlg_t::max(const dlong N, deviceMemory<dfloat> o_a, comm_t comm) {
   h_scratch.copyFrom(o_scratch, 1, 0, properties_t("async", true));
   platform->finish();
 
-  dfloat globalmax = h_scratch[0];
-  comm.Allreduce(globalmax, Comm::Max);
-
-  return globalmax;
+  return h_scratch[0];
 }
 
 // \sum o_a
@@ -223,4 +228,25 @@ dfloat linAlg_t::weightedNorm2(const dlong N, deviceMemory<dfloat> o_w,
   return sqrt(globalnorm);
 }
 
+// o_a[v] = \sum_b o_a[v+Nvec*b]
+void linAlg_t::blockSum(const dlong Nblocks, const int Nvec, deviceMemory<dfloat> o_a) {
+  blockSumKernel(Nblocks, Nvec, o_a);
+}
+
+// o_a[v] = \sum_b o_a[v+Nvec*b] summed over all ranks
+void linAlg_t::blockSum(const dlong Nblocks, const int Nvec, deviceMemory<dfloat> o_a,
+                        comm_t comm) {
+  blockSumKernel(Nblocks, Nvec, o_a);
+
+  if (comm.size()>1) {
+    LIBP_ABORT("linAlg blockSum can reduce at most " << blocksize << " values across ranks",
+               Nvec>blocksize);
+
+    //the global sum has to be staged through the host
+    h_scratch.copyFrom(o_a, Nvec);
+    comm.Allreduce(h_scratch, Comm::Sum, Nvec);
+    o_a.copyFrom(h_scratch, Nvec);
+  }
+}
+
 } //namespace libp
@@ -195,10 +195,46 @@ void linAlg_t::InitKernels(std::vector<std::string> kernels) {
                                         "weightedInnerProd2",
                                         kernelInfo);
       }
+    } else if (name=="blockSum") {
+      if (blockSumKernel.isInitialized()==false)
+        blockSumKernel = platform->buildKernel(LINALG_DIR "/okl/"
+                                        "linAlgBlockSum.okl",
+                                        "blockSum",
+                                        kernelInfo);
     } else {
       LIBP_FORCE_ABORT("Requested linAlg routine \"" << name << "\" not found");
     }
   }
+
+  //bytes and flops per entry, for the profiler. The first pass of each
+  // reduction works on the N entries passed after the block count, the
+  // second pass on the block partial results
+  const double b = sizeof(dfloat);
+  setKernel.SetModel(1*b, 0);
+  addKernel.SetModel(2*b, 1);
+  scaleKernel.SetModel(2*b, 1);
+  axpyKernel.SetModel(3*b, 3);
+  zaxpyKernel.SetModel(3*b, 3);
+  amxKernel.SetModel(3*b, 2);
+  amxpyKernel.SetModel(4*b, 4);
+  zamxpyKernel.SetModel(4*b, 4);
+  adxKernel.SetModel(3*b, 2);
+  adxpyKernel.SetModel(4*b, 4);
+  zadxpyKernel.SetModel(4*b, 4);
+  minKernel1.SetModel(1*b, 1, 1);
+  maxKernel1.SetModel(1*b, 1, 1);
+  sumKernel1.SetModel(1*b, 1, 1);
+  norm2Kernel1.SetModel(1*b, 2, 1);
+  weightedNorm2Kernel1.SetModel(2*b, 3, 1);
+  innerProdKernel1.SetModel(2*b, 2, 1);
+  weightedInnerProdKernel1.SetModel(3*b, 3, 1);
+  minKernel2.SetModel(1*b, 1);
+  maxKernel2.SetModel(1*b, 1);
+  sumKernel2.SetModel(1*b, 1);
+  norm2Kernel2.SetModel(1*b, 1);
+  weightedNorm2Kernel2.SetModel(1*b, 1);
+  innerProdKernel2.SetModel(1*b, 1);
+  weightedInnerProdKernel2.SetModel(1*b, 1);
 }
 
 } //namespace libp
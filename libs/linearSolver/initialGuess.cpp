@@ -99,11 +99,10 @@ Projection::Projection(dlong _N, platform_t& _platform, settings_t& _settings, c
   o_alphas = platform.malloc<dfloat>(maxDim);
 
   ctmpNblocks = (Ntotal + IG_BLOCKSIZE - 1)/IG_BLOCKSIZE;
-  ctmp = platform.hostMalloc<dfloat>(ctmpNblocks*maxDim);
   o_ctmp = platform.malloc<dfloat>(ctmpNblocks*maxDim);
 
   // Build kernels.
-  platform.linAlg().InitKernels({"set"});
+  platform.linAlg().InitKernels({"set", "blockSum"});
 
   properties_t kernelInfo = platform.props();
   kernelInfo["defines/" "p_igNhist"] = maxDim;
@@ -117,27 +116,19 @@ Projection::Projection(dlong _N, platform_t& _platform, settings_t& _settings, c
 void Projection::FormInitialGuess(deviceMemory<dfloat>& o_x, deviceMemory<dfloat>& o_rhs)
 {
   if (curDim > 0) {
-    igBasisInnerProducts(o_rhs, o_Btilde, o_alphas, alphas);
+    igBasisInnerProducts(o_rhs, o_Btilde, o_alphas);
     platform.linAlg().set(Ntotal, 0.0, o_x);
     igReconstruct(o_x, 1.0, o_alphas, o_Xtilde, o_x);
   }
 }
 
-void Projection::igBasisInnerProducts(deviceMemory<dfloat>& o_x, deviceMemory<dfloat>& o_Q, deviceMemory<dfloat>& o_c, pinnedMemory<dfloat>& c)
+void Projection::igBasisInnerProducts(deviceMemory<dfloat>& o_x, deviceMemory<dfloat>& o_Q, deviceMemory<dfloat>& o_c)
 {
   igBasisInnerProductsKernel(Ntotal, ctmpNblocks, curDim, o_x, o_Q, o_ctmp);
 
-  ctmp.copyFrom(o_ctmp, ctmpNblocks*curDim);
-
-  for (int m = 0; m < curDim; ++m) {
-    c[m] = 0;
-    for (int n = 0; n < ctmpNblocks; ++n) {
-      c[m] += ctmp[m*ctmpNblocks + n];
-    }
-  }
-
-  comm.Allreduce(c, Comm::Sum, curDim);
-  c.copyTo(o_c, curDim);
+  // Finish the sums on device, the coefficients never visit the host on one rank.
+  platform.linAlg().blockSum(ctmpNblocks, curDim, o_ctmp, comm);
+  o_c.copyFrom(o_ctmp, curDim);
 }
 
 void Projection::igReconstruct(deviceMemory<dfloat>& o_u, dfloat a, deviceMemory<dfloat>& o_c, deviceMemory<dfloat>& o_Q, deviceMemory<dfloat>& o_unew)
@@ -177,7 +168,7 @@ void ClassicProjection::Update(operator_t &linearOperator, deviceMemory<dfloat>&
 
     // Orthogonalize new RHS against previous ones.
     for (int n = 0; n < Nreorth; n++) {
-      igBasisInnerProducts(o_btilde, o_Btilde, o_alphas, alphas);
+      igBasisInnerProducts(o_btilde, o_Btilde, o_alphas);
       igReconstruct(o_btilde, -1.0, o_alphas, o_Btilde, o_btilde);
       igReconstruct(o_xtilde, -1.0, o_alphas, o_Xtilde, o_xtilde);
     }
@@ -292,10 +283,11 @@ void RollingQRProjection::Update(operator_t &linearOperator, deviceMemory<dfloat
 
     // Orthogonalize new RHS against previous ones.
     for (int n = 0; n < Nreorth; n++) {
-      igBasisInnerProducts(o_btilde, o_Btilde, o_alphas, alphas);
+      igBasisInnerProducts(o_btilde, o_Btilde, o_alphas);
       igReconstruct(o_btilde, (dfloat)(-1.0), o_alphas, o_Btilde, o_btilde);
       igReconstruct(o_xtilde, (dfloat)(-1.0), o_alphas, o_Xtilde, o_xtilde);
 
+      alphas.copyFrom(o_alphas, curDim);
       for (int i = 0; i < curDim; i++)
         R[i*maxDim + curDim] += alphas[i];
     }
@@ -43,6 +43,42 @@ int linearSolver_t::Solve(operator_t& linearOperator,
   return iters;
 }
 
+int linearSolver_t::BlockSolve(operator_t& linearOperator,
+                               operator_t& precon,
+                               deviceMemory<dfloat>& o_x,
+                               deviceMemory<dfloat>& o_rhs,
+                               const int Nrhs,
+                               memory<int> Niters,
+                               const dfloat tol,
+                               const int MAXIT,
+                               const int verbose) {
+  assertInitialized();
+
+  //a single history space can't be shared between right-hand sides
+  LIBP_ABORT("Block solves require the NONE or ZERO initial guess strategy",
+             Nrhs>1
+             && std::dynamic_pointer_cast<InitialGuess::Default>(ig)==nullptr
+             && std::dynamic_pointer_cast<InitialGuess::Zero>(ig)==nullptr);
+
+  const dlong offset = ls->N + ls->Nhalo;
+  for (int n=0;n<Nrhs;++n) {
+    deviceMemory<dfloat> o_xn   = o_x   + n*offset;
+    deviceMemory<dfloat> o_rhsn = o_rhs + n*offset;
+    ig->FormInitialGuess(o_xn, o_rhsn);
+  }
+
+  int iters = ls->BlockSolve(linearOperator, precon, o_x, o_rhs,
+                             Nrhs, Niters, tol, MAXIT, verbose);
+
+  for (int n=0;n<Nrhs;++n) {
+    deviceMemory<dfloat> o_xn   = o_x   + n*offset;
+    deviceMemory<dfloat> o_rhsn = o_rhs + n*offset;
+    ig->Update(linearOperator, o_xn, o_rhsn);
+  }
+
+  return iters;
+}
+
 void linearSolver_t::MakeDefaultInitialGuessStrategy() {
   ig = std::make_shared<InitialGuess::Default>(ls->N, ls->platform,
                                                ls->settings, ls->comm);
@@ -0,0 +1,251 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "linearSolver.hpp"
+
+namespace libp {
+
+namespace LinearSolver {
+
+#define BPCG_BLOCKSIZE 512
+
+bpcg::bpcg(dlong _N, dlong _Nhalo,
+           platform_t& _platform, settings_t& _settings, comm_t _comm,
+           const int _Nrhs):
+  linearSolverBase_t(_N, _Nhalo, _platform, _settings, _comm),
+  Nrhs(_Nrhs) {
+
+  LIBP_ABORT("BPCG supports at most " << BPCG_BLOCKSIZE << " right-hand sides",
+             Nrhs<1 || Nrhs>BPCG_BLOCKSIZE);
+
+  platform.linAlg().InitKernels({"axpy", "blockSum"});
+
+  dlong Ntotal = N + Nhalo;
+
+  /*aux variables */
+  memory<dfloat> dummy(Nrhs*Ntotal, 0.0); //need this to avoid uninitialized memory warnings
+  o_p  = platform.malloc<dfloat>(dummy);
+  o_z  = platform.malloc<dfloat>(dummy);
+  o_Ax = platform.malloc<dfloat>(dummy);
+  o_Ap = platform.malloc<dfloat>(dummy);
+
+  //pinned tmp buffer for reductions
+  dots = platform.hostMalloc<dfloat>(Nrhs*BPCG_BLOCKSIZE);
+  o_dots = platform.malloc<dfloat>(Nrhs*BPCG_BLOCKSIZE);
+
+  //per-rhs step lengths
+  alphas = platform.hostMalloc<dfloat>(Nrhs);
+  betas  = platform.hostMalloc<dfloat>(Nrhs);
+  o_alphas = platform.malloc<dfloat>(Nrhs);
+  o_betas  = platform.malloc<dfloat>(Nrhs);
+
+  /* build kernels */
+  properties_t kernelInfo = platform.props(); //copy base properties
+
+  //add defines
+  kernelInfo["defines/" "p_blockSize"] = (int)BPCG_BLOCKSIZE;
+  kernelInfo["defines/" "p_Nrhs"] = Nrhs;
+
+  // block dot, p update, and combined PCG update and r.r kernels
+  dotBPCGKernel = platform.buildKernel(LINEARSOLVER_DIR "/okl/linearSolverUpdateBPCG.okl",
+                                "dotBPCG", kernelInfo);
+  updatePBPCGKernel = platform.buildKernel(LINEARSOLVER_DIR "/okl/linearSolverUpdateBPCG.okl",
+                                "updatePBPCG", kernelInfo);
+  updateBPCGKernel = platform.buildKernel(LINEARSOLVER_DIR "/okl/linearSolverUpdateBPCG.okl",
+                                "updateBPCG", kernelInfo);
+}
+
+int bpcg::Solve(operator_t& linearOperator, operator_t& precon,
+                deviceMemory<dfloat>& o_x, deviceMemory<dfloat>& o_r,
+                const dfloat tol, const int MAXIT, const int verbose) {
+  memory<int> Niters(1);
+  return BlockSolve(linearOperator, precon, o_x, o_r, 1, Niters, tol, MAXIT, verbose);
+}
+
+int bpcg::BlockSolve(operator_t& linearOperator, operator_t& precon,
+                     deviceMemory<dfloat>& o_x, deviceMemory<dfloat>& o_r,
+                     const int _Nrhs, memory<int> Niters,
+                     const dfloat tol, const int MAXIT, const int verbose) {
+
+  LIBP_ABORT("BPCG was setup for " << Nrhs << " right-hand sides, but called with " << _Nrhs,
+             _Nrhs!=Nrhs);
+
+  int rank = comm.rank();
+  linAlg_t &linAlg = platform.linAlg();
+
+  dlong Ntotal = N + Nhalo;
+
+  // per-rhs scalars
+  memory<dfloat> rdotz1(Nrhs, 0.0);
+  memory<dfloat> rdotz2(Nrhs, 0.0);
+  memory<dfloat> rdotr0(Nrhs, 0.0);
+  memory<dfloat> pAp(Nrhs, 0.0);
+  memory<dfloat> TOL(Nrhs, 0.0);
+  memory<int> converged(Nrhs, 0);
+
+  // Compute norm of RHS (for stopping tolerance).
+  if (settings.compareSetting("LINEAR SOLVER STOPPING CRITERION", "ABS/REL-RHS-2NORM")) {
+    DotBPCG(o_r, o_r, rdotr0);
+    for (int n=0;n<Nrhs;++n) {
+      TOL[n] = std::max(tol*tol*rdotr0[n], tol*tol);
+    }
+  }
+
+  // compute A*x
+  linearOperator.BlockOperator(o_x, o_Ax, Nrhs, Ntotal);
+
+  // subtract r = r - A*x
+  for (int n=0;n<Nrhs;++n) {
+    deviceMemory<dfloat> o_Axn = o_Ax + n*Ntotal;
+    deviceMemory<dfloat> o_rn  = o_r  + n*Ntotal;
+    linAlg.axpy(N, -1.f, o_Axn, 1.f, o_rn);
+  }
+
+  DotBPCG(o_r, o_r, rdotr0);
+
+  if (settings.compareSetting("LINEAR SOLVER STOPPING CRITERION", "ABS/REL-INITRESID")) {
+    for (int n=0;n<Nrhs;++n) {
+      TOL[n] = std::max(tol*tol*rdotr0[n],tol*tol);
+    }
+  }
+
+  if (verbose&&(rank==0)) {
+    for (int n=0;n<Nrhs;++n) {
+      printf("BPCG: rhs %d, initial res norm %12.12f \n", n, sqrt(rdotr0[n]));
+    }
+  }
+
+  int iter;
+  for(iter=0;iter<MAXIT;++iter){
+
+    // Freeze each system once its tolerance is reached, taking at least one step.
+    int Nconverged = 0;
+    for (int n=0;n<Nrhs;++n) {
+      if (!converged[n]
+          && (((iter == 0) && (rdotr0[n] == 0.0)) ||
+              ((iter > 0) && (rdotr0[n] <= TOL[n])))) {
+        converged[n] = 1;
+        Niters[n] = iter;
+      }
+      Nconverged += converged[n];
+    }
+
+    // Exit once all systems are converged
+    if (Nconverged==Nrhs) break;
+
+    // z = Precon^{-1} r
+    precon.BlockOperator(o_r, o_z, Nrhs, Ntotal);
+
+    // r.z
+    rdotz2.copyFrom(rdotz1);
+    DotBPCG(o_r, o_z, rdotz1);
+
+    // p = z + beta*p
+    for (int n=0;n<Nrhs;++n) {
+      betas[n] = (iter==0 || converged[n]) ? 0.0 : rdotz1[n]/rdotz2[n];
+    }
+    betas.copyTo(o_betas, Nrhs);
+
+    updatePBPCGKernel(N, Ntotal, o_z, o_betas, o_p);
+
+    // A*p
+    linearOperator.BlockOperator(o_p, o_Ap, Nrhs, Ntotal);
+
+    // p.Ap
+    DotBPCG(o_p, o_Ap, pAp);
+
+    // converged systems take a zero step
+    for (int n=0;n<Nrhs;++n) {
+      alphas[n] = converged[n] ? 0.0 : rdotz1[n]/pAp[n];
+    }
+
+    //  x <= x + alpha*p
+    //  r <= r - alpha*A*p
+    //  dot(r,r)
+    UpdateBPCG(o_x, o_r, rdotr0);
+
+    if (verbose&&(rank==0)) {
+      for (int n=0;n<Nrhs;++n) {
+        if (converged[n]) continue;
+
+        if(rdotr0[n]<0)
+          printf("WARNING BPCG: rhs %d, rdotr = %17.15lf\n", n, rdotr0[n]);
+
+        printf("BPCG: rhs %d, it %d, r norm %12.12le, alpha = %le \n",
+               n, iter+1, sqrt(rdotr0[n]), alphas[n]);
+      }
+    }
+  }
+
+  for (int n=0;n<Nrhs;++n) {
+    if (!converged[n]) Niters[n] = iter;
+  }
+
+  return iter;
+}
+
+void bpcg::DotBPCG(deviceMemory<dfloat>& o_a, deviceMemory<dfloat>& o_b,
+                   memory<dfloat> adotb){
+
+  int Nblocks = (N+BPCG_BLOCKSIZE-1)/BPCG_BLOCKSIZE;
+  Nblocks = std::min(Nblocks, BPCG_BLOCKSIZE); //limit to BPCG_BLOCKSIZE entries
+
+  dotBPCGKernel(N, Nblocks, N+Nhalo, o_a, o_b, o_dots);
+
+  //finish the reductions on device, only the Nrhs totals come back to the host
+  platform.linAlg().blockSum(Nblocks, Nrhs, o_dots);
+  dots.copyFrom(o_dots, Nrhs);
+
+  //one global reduction for all right-hand sides
+  comm.Allreduce(dots, Comm::Sum, Nrhs);
+  for (int n=0;n<Nrhs;++n) adotb[n] = dots[n];
+}
+
+void bpcg::UpdateBPCG(deviceMemory<dfloat>& o_x, deviceMemory<dfloat>& o_r,
+                      memory<dfloat> rdotr){
+
+  // x <= x + alpha*p
+  // r <= r - alpha*A*p
+  // dot(r,r)
+  int Nblocks = (N+BPCG_BLOCKSIZE-1)/BPCG_BLOCKSIZE;
+  Nblocks = std::min(Nblocks, BPCG_BLOCKSIZE); //limit to BPCG_BLOCKSIZE entries
+
+  alphas.copyTo(o_alphas, Nrhs);
+
+  updateBPCGKernel(N, Nblocks, N+Nhalo, o_p, o_Ap, o_alphas, o_x, o_r, o_dots);
+
+  //finish the reductions on device, only the Nrhs totals come back to the host
+  platform.linAlg().blockSum(Nblocks, Nrhs, o_dots);
+  dots.copyFrom(o_dots, Nrhs);
+
+  comm.Allreduce(dots, Comm::Sum, Nrhs);
+  for (int n=0;n<Nrhs;++n) rdotr[n] = dots[n];
+}
+
+} //namespace LinearSolver
+
+} //namespace libp
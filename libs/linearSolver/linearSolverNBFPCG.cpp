@@ -36,7 +36,7 @@ nbfpcg::nbfpcg(dlong _N, dlong _Nhalo,
          platform_t& _platform, settings_t& _settings, comm_t _comm):
   linearSolverBase_t(_N, _Nhalo, _platform, _settings, _comm) {
 
-  platform.linAlg().InitKernels({"axpy", "zaxpy"});
+  platform.linAlg().InitKernels({"axpy", "zaxpy", "blockSum"});
 
   dlong Ntotal = N + Nhalo;
 
@@ -197,19 +197,9 @@ void nbfpcg::Update0NBFPCG(deviceMemory<dfloat>& o_r){
 
   update0NBFPCGKernel(N, Nblocks, o_u, o_r, o_w, o_dots);
 
-  if (Nblocks>0) {
-    dots.copyFrom(o_dots, 3*Nblocks);
-  } else {
-    dots[0] = 0.0;
-    dots[1] = 0.0;
-    dots[2] = 0.0;
-  }
-
-  for(int n=1;n<Nblocks;++n) {
-    dots[0] += dots[0+3*n];
-    dots[1] += dots[1+3*n];
-    dots[2] += dots[2+3*n];
-  }
+  //finish the reductions on device, only the totals come back to the host
+  platform.linAlg().blockSum(Nblocks, 3, o_dots);
+  dots.copyFrom(o_dots, 3);
   comm.Iallreduce(dots, Comm::Sum, 3, request);
 }
 
@@ -223,21 +213,9 @@ void nbfpcg::Update1NBFPCG(const dfloat alpha, deviceMemory<dfloat>& o_x, device
 
   update1NBFPCGKernel(N, Nblocks, o_p, o_s, o_q, o_z, alpha, o_x, o_r, o_u, o_w, o_dots);
 
-  if (Nblocks>0) {
-    dots.copyFrom(o_dots, 4*Nblocks);
-  } else {
-    dots[0] = 0.0;
-    dots[1] = 0.0;
-    dots[2] = 0.0;
-    dots[3] = 0.0;
-  }
-
-  for(int n=1;n<Nblocks;++n) {
-    dots[0] += dots[0+4*n];
-    dots[1] += dots[1+4*n];
-    dots[2] += dots[2+4*n];
-    dots[3] += dots[3+4*n];
-  }
+  //finish the reductions on device, only the totals come back to the host
+  platform.linAlg().blockSum(Nblocks, 4, o_dots);
+  dots.copyFrom(o_dots, 4);
   comm.Iallreduce(dots, Comm::Sum, 4, request);
 }
 
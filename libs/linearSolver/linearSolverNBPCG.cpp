@@ -36,7 +36,7 @@ nbpcg::nbpcg(dlong _N, dlong _Nhalo,
          platform_t& _platform, settings_t& _settings, comm_t _comm):
   linearSolverBase_t(_N, _Nhalo, _platform, _settings, _comm) {
 
-  platform.linAlg().InitKernels({"axpy"});
+  platform.linAlg().InitKernels({"axpy", "blockSum"});
 
   dlong Ntotal = N + Nhalo;
 
@@ -177,14 +177,9 @@ void nbpcg::Update1NBPCG(const dfloat beta){
 
   update1NBPCGKernel(N, Nblocks, o_z, o_Z, beta, o_p, o_s, o_dots);
 
-  if (Nblocks>0) {
-    dots.copyFrom(o_dots, Nblocks);
-  } else {
-    dots[0] = 0.0;
-  }
-
-  for(int n=1;n<Nblocks;++n)
-    dots[0] += dots[n];
+  //finish the reduction on device, only the total comes back to the host
+  platform.linAlg().blockSum(Nblocks, 1, o_dots);
+  dots.copyFrom(o_dots, 1);
 
   comm.Iallreduce(dots, Comm::Sum, 1, request);
 }
@@ -201,19 +196,9 @@ void nbpcg::Update2NBPCG(const dfloat alpha, deviceMemory<dfloat>& o_r){
 
   update2NBPCGKernel(N, Nblocks, o_s, o_S, alpha, o_r, o_z, o_dots);
 
-  if (Nblocks>0) {
-    dots.copyFrom(o_dots, 3*Nblocks);
-  } else {
-    dots[0] = 0.0;
-    dots[1] = 0.0;
-    dots[2] = 0.0;
-  }
-
-  for(int n=1;n<Nblocks;++n) {
-    dots[0] += dots[0+3*n];
-    dots[1] += dots[1+3*n];
-    dots[2] += dots[2+3*n];
-  }
+  //finish the reductions on device, only the totals come back to the host
+  platform.linAlg().blockSum(Nblocks, 3, o_dots);
+  dots.copyFrom(o_dots, 3);
   comm.Iallreduce(dots, Comm::Sum, 3, request);
 }
 
@@ -36,7 +36,7 @@ pcg::pcg(dlong _N, dlong _Nhalo,
          platform_t& _platform, settings_t& _settings, comm_t _comm):
   linearSolverBase_t(_N, _Nhalo, _platform, _settings, _comm) {
 
-  platform.linAlg().InitKernels({"axpy", "innerProd", "norm2"});
+  platform.linAlg().InitKernels({"axpy", "innerProd", "norm2", "blockSum"});
 
   dlong Ntotal = N + Nhalo;
 
@@ -160,11 +160,11 @@ dfloat pcg::UpdatePCG(const dfloat alpha, deviceMemory<dfloat>& o_x, deviceMemor
 
   updatePCGKernel(N, Nblocks, o_p, o_Ap, alpha, o_x, o_r, o_rdotr);
 
-  rdotr.copyFrom(o_rdotr, Nblocks);
+  //finish the reduction on device, only the total comes back to the host
+  platform.linAlg().blockSum(Nblocks, 1, o_rdotr);
+  rdotr.copyFrom(o_rdotr, 1);
 
-  dfloat rdotr1 = 0;
-  for(int n=0;n<Nblocks;++n)
-    rdotr1 += rdotr[n];
+  dfloat rdotr1 = rdotr[0];
 
   comm.Allreduce(rdotr1);
   return rdotr1;
@@ -0,0 +1,227 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "linearSolver.hpp"
+
+namespace libp {
+
+namespace LinearSolver {
+
+#define PIPECG_BLOCKSIZE 512
+
+pipecg::pipecg(dlong _N, dlong _Nhalo,
+         platform_t& _platform, settings_t& _settings, comm_t _comm):
+  linearSolverBase_t(_N, _Nhalo, _platform, _settings, _comm) {
+
+  platform.linAlg().InitKernels({"axpy", "blockSum"});
+
+  dlong Ntotal = N + Nhalo;
+
+  memory<dfloat> dummy(Ntotal, 0.0);
+
+  /*aux variables */
+  o_u  = platform.malloc<dfloat>(Ntotal);
+  o_w  = platform.malloc<dfloat>(Ntotal);
+  o_m  = platform.malloc<dfloat>(Ntotal);
+  o_n  = platform.malloc<dfloat>(Ntotal);
+  o_p  = platform.malloc<dfloat>(Ntotal, dummy);
+  o_s  = platform.malloc<dfloat>(Ntotal, dummy);
+  o_q  = platform.malloc<dfloat>(Ntotal, dummy);
+  o_z  = platform.malloc<dfloat>(Ntotal, dummy);
+  o_Ax = platform.malloc<dfloat>(Ntotal);
+
+  //pinned tmp buffer for reductions
+  dots = platform.hostMalloc<dfloat>(3*PIPECG_BLOCKSIZE);
+  o_dots = platform.malloc<dfloat>(3*PIPECG_BLOCKSIZE);
+
+  /* build kernels */
+  properties_t kernelInfo = platform.props(); //copy base properties
+
+  //add defines
+  kernelInfo["defines/" "p_blockSize"] = (int)PIPECG_BLOCKSIZE;
+
+  // combined PIPECG update kernels
+  update0PIPECGKernel = platform.buildKernel(LINEARSOLVER_DIR "/okl/linearSolverUpdatePIPECG.okl",
+                                "update0PIPECG", kernelInfo);
+  update1PIPECGKernel = platform.buildKernel(LINEARSOLVER_DIR "/okl/linearSolverUpdatePIPECG.okl",
+                                "update1PIPECG", kernelInfo);
+}
+
+int pipecg::Solve(operator_t& linearOperator, operator_t& precon,
+                  deviceMemory<dfloat>& o_x, deviceMemory<dfloat>& o_r,
+                  const dfloat tol, const int MAXIT, const int verbose) {
+
+  int rank = comm.rank();
+  linAlg_t &linAlg = platform.linAlg();
+
+  // register scalars
+  dfloat alpha0 = 0;
+  dfloat beta0  = 0;
+  dfloat gamma0 = 0;
+  dfloat delta0 = 0;
+  dfloat rdotr0 = 0;
+
+  dfloat alpha1 = 0; // history alpha
+  dfloat gamma1 = 0; // history gamma
+
+  // compute A*x
+  linearOperator.Operator(o_x, o_Ax);
+
+  // subtract r = r - A*x
+  linAlg.axpy(N, -1.f, o_Ax, 1.f, o_r);
+
+  // u = M*r [ Ghysels notation ]
+  precon.Operator(o_r, o_u);
+
+  // w = A*u
+  linearOperator.Operator(o_u, o_w);
+
+  // gamma = u.r
+  // delta = u.w
+  Update0PIPECG(o_r);
+
+  // m = M*w
+  precon.Operator(o_w, o_m);
+
+  // start the global reduction of gamma and delta
+  ReducePIPECG();
+
+  // n = A*m
+  linearOperator.Operator(o_m, o_n);
+
+  comm.Wait(request);
+  gamma0 = dots[0]; // udotr
+  delta0 = dots[1]; // udotw
+  rdotr0 = dots[2]; // rdotr
+
+  dfloat TOL = std::max(tol*tol*rdotr0,tol*tol);
+
+  if (verbose&&(rank==0))
+    printf("PIPECG: initial res norm %12.12f \n", sqrt(rdotr0));
+
+  int iter;
+  for(iter=0;iter<MAXIT;++iter){
+
+    //exit if tolerance is reached
+    if(rdotr0<=TOL) break;
+
+    if (iter==0) {
+      beta0  = 0;
+      alpha0 = gamma0/delta0;
+    } else {
+      beta0  = gamma0/gamma1;
+      alpha0 = gamma0/(delta0 - beta0*gamma0/alpha1);
+    }
+
+    // z <= n + beta*z
+    // q <= m + beta*q
+    // s <= w + beta*s
+    // p <= u + beta*p
+    // x <= x + alpha*p
+    // r <= r - alpha*s
+    // u <= u - alpha*q
+    // w <= w - alpha*z
+    // gamma <= u.r
+    // delta <= u.w
+    Update1PIPECG(alpha0, beta0, o_x, o_r);
+
+    // m = M*w
+    precon.Operator(o_w, o_m);
+
+    // start the global reduction of gamma and delta
+    ReducePIPECG();
+
+    // n = A*m
+    linearOperator.Operator(o_m, o_n);
+
+    // block for gamma and delta
+    comm.Wait(request);
+    alpha1 = alpha0;
+    gamma1 = gamma0;
+    gamma0 = dots[0]; // u.r
+    delta0 = dots[1]; // u.w
+    rdotr0 = dots[2]; // r.r
+
+    if (verbose&&(rank==0)) {
+      if(rdotr0<0)
+        printf("WARNING PIPECG: rdotr = %17.15lf\n", rdotr0);
+
+      printf("PIPECG: it %d, r norm %12.12le, alpha = %le beta = %le "
+             "gamma = %le delta = %le \n", iter+1, sqrt(rdotr0), alpha0, beta0, gamma0, delta0);
+    }
+  }
+
+  return iter;
+}
+
+void pipecg::Update0PIPECG(deviceMemory<dfloat>& o_r){
+
+  // (u.r)
+  // (u.w)
+  // (r.r)
+  int Nblocks = (N+PIPECG_BLOCKSIZE-1)/PIPECG_BLOCKSIZE;
+  Nblocks = std::min(Nblocks, PIPECG_BLOCKSIZE); //limit to PIPECG_BLOCKSIZE entries
+
+  update0PIPECGKernel(N, Nblocks, o_u, o_r, o_w, o_dots);
+
+  //finish the reductions on device, only the totals come back to the host
+  platform.linAlg().blockSum(Nblocks, 3, o_dots);
+  dots.copyFrom(o_dots, 3, 0, properties_t("async", true));
+
+  //mark when the host buffer is ready, without blocking the host
+  dotsReady = platform.device.tagStream();
+}
+
+void pipecg::Update1PIPECG(const dfloat alpha, const dfloat beta,
+                           deviceMemory<dfloat>& o_x, deviceMemory<dfloat>& o_r){
+
+  // all eight recurrences and the three dot products
+  // for the next iteration are fused into one pass
+  int Nblocks = (N+PIPECG_BLOCKSIZE-1)/PIPECG_BLOCKSIZE;
+  Nblocks = std::min(Nblocks, PIPECG_BLOCKSIZE); //limit to PIPECG_BLOCKSIZE entries
+
+  update1PIPECGKernel(N, Nblocks, o_m, o_n, alpha, beta,
+                      o_p, o_s, o_q, o_z, o_x, o_r, o_u, o_w, o_dots);
+
+  //finish the reductions on device, only the totals come back to the host
+  platform.linAlg().blockSum(Nblocks, 3, o_dots);
+  dots.copyFrom(o_dots, 3, 0, properties_t("async", true));
+
+  //mark when the host buffer is ready, without blocking the host
+  dotsReady = platform.device.tagStream();
+}
+
+void pipecg::ReducePIPECG(){
+
+  //wait for the copy to host, but not for the preconditioner queued after it
+  platform.device.waitFor(dotsReady);
+
+  comm.Iallreduce(dots, Comm::Sum, 3, request);
+}
+
+} //namespace LinearSolver
+
+} //namespace libp
@@ -33,6 +33,9 @@ void mesh_t::PhysicalNodesTri2DCurv(){
   x.malloc(Nelements*Np);
   y.malloc(Nelements*Np);
 
+  elementInfo2.malloc(Nelements);
+  elementInfo3.malloc(Nelements);
+
   mapCurv.malloc(Nelements);
   Ncurv=0;
 
@@ -49,6 +52,20 @@ void mesh_t::PhysicalNodesTri2DCurv(){
     dfloat ye2 = EY[id+1];
     dfloat ye3 = EY[id+2];
 
+    dfloat xavg=(xe1+xe2+xe3)/3.0;
+    dfloat yavg=(ye1+ye2+ye3)/3.0;
+    if( xavg <= 105) {
+      elementInfo2[e]=1;
+    } else {
+      elementInfo2[e]=0;
+    }
+
+    if( xavg*xavg+yavg*yavg <= 2.5*2.5) {
+      elementInfo3[e]=1;
+    } else {
+      elementInfo3[e]=0;
+    }
+
     for(int n=0;n<Np;++n){ /* for each node */
 
       /* (r,s) coordinates of interpolation nodes*/
@@ -177,6 +194,8 @@ void mesh_t::PhysicalNodesTri2DCurv(){
   o_mapCurv = platform.malloc<dlong>(mapCurv);
   o_x = platform.malloc<dfloat>(x);
   o_y = platform.malloc<dfloat>(y);
+  o_elementInfo=platform.malloc<dlong>(elementInfo2);
+  o_elementInfo2=platform.malloc<dlong>(elementInfo3);
 }
 
 } //namespace libp
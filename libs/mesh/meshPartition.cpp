@@ -31,6 +31,29 @@ namespace libp {
 
 void mesh_t::Partition(){
 
+  /*Optionally balance interior and PML elements separately*/
+  int Nconstraints=0;
+  memory<dfloat> weights;
+  if (settings.compareSetting("PARTITION CONSTRAINTS", "PML")) {
+    Nconstraints=2;
+    weights.malloc(Nelements*Nconstraints);
+    for (dlong e=0;e<Nelements;++e) {
+      const hlong type = elementInfo[e];
+      const bool pml = (type==100)||(type==200)||(type==300)||
+                       (type==400)||(type==500)||(type==600)||
+                       (type==700);
+      weights[0+e*Nconstraints] = pml ? 0.0 : 1.0;
+      weights[1+e*Nconstraints] = pml ? 1.0 : 0.0;
+    }
+  }
+
+  memory<hlong> elementIds;
+  Partition(Nconstraints, weights, elementIds);
+}
+
+void mesh_t::Partition(const int Nconstraints, memory<dfloat>& weights,
+                       memory<hlong>& elementIds){
+
   paradogs::MeshPartition(platform,
                           settings,
                           Nelements,
@@ -45,6 +68,10 @@ void mesh_t::Partition(){
                           EX,
                           EY,
                           EZ,
+                          elementInfo,
+                          Nconstraints,
+                          weights,
+                          elementIds,
                           comm);
 }
 
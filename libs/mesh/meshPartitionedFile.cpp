@@ -0,0 +1,344 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "mesh.hpp"
+#include <cstdint>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace libp {
+
+/*
+  A partitioned mesh is stored as a file set:
+    <name>.pmsh       small text manifest (rank count, dimension, element type)
+    <name>_RRRR.pmsh  binary partition for rank RRRR
+
+  Each rank file holds
+    magic, int32 header, int64 counts,
+    then the arrays below, each as (uint64 bytes, data) padded to 8 bytes,
+  all in native byte order so that a rank can map its file and copy the
+  arrays out directly. globalIds and mapB depend on the polynomial degree
+  and are only reused when it matches.
+*/
+
+namespace {
+
+constexpr char pmshMagic[8] = {'L','I','B','P','M','S','H','1'};
+
+enum pmshHeader {
+  hRank=0, hSize, hDim, hElementType, hNverts, hNfaces, hN,
+  hHlong, hDlong, hDfloat, hNheader
+};
+
+enum pmshCount {
+  cNelements=0, cNelementsGlobal, cNnodes, cTotalHaloPairs,
+  cNhaloElements, cNinternalElements, cNcount
+};
+
+std::string pmshBaseName(const std::string fileName) {
+  const std::string ext = ".pmsh";
+  if (fileName.size()>ext.size()
+      && fileName.compare(fileName.size()-ext.size(), ext.size(), ext)==0)
+    return fileName.substr(0, fileName.size()-ext.size());
+  return fileName;
+}
+
+std::string pmshRankFileName(const std::string baseName, const int r) {
+  char fname[BUFSIZ];
+  sprintf(fname, "%s_%04d.pmsh", baseName.c_str(), r);
+  return std::string(fname);
+}
+
+void pmshPad(FILE* fp) {
+  const char zeros[8] = {0};
+  const long int pad = (8 - ftell(fp)%8)%8;
+  fwrite(zeros, 1, pad, fp);
+}
+
+template<typename T>
+void pmshWrite(FILE* fp, const memory<T> a, const size_t n) {
+  const uint64_t bytes = n*sizeof(T);
+  fwrite(&bytes, sizeof(uint64_t), 1, fp);
+  if (n) fwrite(a.ptr(), sizeof(T), n, fp);
+  pmshPad(fp);
+}
+
+/* walks through a mapped rank file */
+class pmshReader_t {
+ public:
+  const char* ptr;
+  size_t left;
+  std::string fileName;
+
+  void Skip(const size_t bytes) {
+    const size_t padded = bytes + (8 - bytes%8)%8;
+    LIBP_ABORT("Partitioned mesh file " << fileName << " is truncated.",
+               padded>left);
+    ptr += padded;
+    left -= padded;
+  }
+
+  template<typename T>
+  void Read(memory<T>& a, const size_t n) {
+    uint64_t bytes;
+    LIBP_ABORT("Partitioned mesh file " << fileName << " is truncated.",
+               left<sizeof(uint64_t));
+    std::memcpy(&bytes, ptr, sizeof(uint64_t));
+    Skip(sizeof(uint64_t));
+
+    LIBP_ABORT("Partitioned mesh file " << fileName << " has an array of "
+               << bytes << " bytes, expected " << n*sizeof(T),
+               bytes!=n*sizeof(T));
+    LIBP_ABORT("Partitioned mesh file " << fileName << " is truncated.",
+               bytes>left);
+
+    a.malloc(n);
+    if (n) a.copyFrom(reinterpret_cast<const T*>(ptr), n);
+    Skip(bytes);
+  }
+};
+
+} //namespace
+
+void mesh_t::SavePartitioned(const std::string fileName){
+
+  const std::string baseName = pmshBaseName(fileName);
+
+  /*global ids of the local and halo elements, as used to set up the halo*/
+  memory<hlong> globalOffset(size+1, 0);
+  hlong localNelements = Nelements;
+  comm.Allgather(localNelements, globalOffset+1);
+  for(int rr=0;rr<size;++rr)
+    globalOffset[rr+1] = globalOffset[rr]+globalOffset[rr+1];
+
+  memory<hlong> haloIds(Nelements+totalHaloPairs);
+  for(dlong e=0;e<Nelements;++e)
+    haloIds[e] = e + globalOffset[rank] + 1;
+  halo.Exchange(haloIds, 1);
+  for(dlong e=Nelements;e<Nelements+totalHaloPairs;++e)
+    haloIds[e] = -haloIds[e];
+
+  const std::string rankFileName = pmshRankFileName(baseName, rank);
+  FILE *fp = fopen(rankFileName.c_str(), "wb");
+
+  int ok = (fp!=nullptr);
+  if (ok) {
+    int32_t header[hNheader];
+    header[hRank] = rank;
+    header[hSize] = size;
+    header[hDim] = dim;
+    header[hElementType] = static_cast<int32_t>(elementType);
+    header[hNverts] = Nverts;
+    header[hNfaces] = Nfaces;
+    header[hN] = N;
+    header[hHlong] = sizeof(hlong);
+    header[hDlong] = sizeof(dlong);
+    header[hDfloat] = sizeof(dfloat);
+
+    int64_t sizes[cNcount];
+    sizes[cNelements] = Nelements;
+    sizes[cNelementsGlobal] = NelementsGlobal;
+    sizes[cNnodes] = Nnodes;
+    sizes[cTotalHaloPairs] = totalHaloPairs;
+    sizes[cNhaloElements] = NhaloElements;
+    sizes[cNinternalElements] = NinternalElements;
+
+    fwrite(pmshMagic, 1, sizeof(pmshMagic), fp);
+    fwrite(header, sizeof(int32_t), hNheader, fp);
+    pmshPad(fp);
+    fwrite(sizes, sizeof(int64_t), cNcount, fp);
+
+    const dlong NallElements = Nelements+totalHaloPairs;
+
+    pmshWrite(fp, EX, Nelements*Nverts);
+    pmshWrite(fp, EY, Nelements*Nverts);
+    if (dim==3) pmshWrite(fp, EZ, Nelements*Nverts);
+    pmshWrite(fp, EToV, Nelements*Nverts);
+    pmshWrite(fp, elementInfo, Nelements);
+    pmshWrite(fp, EToE, Nelements*Nfaces);
+    pmshWrite(fp, EToF, Nelements*Nfaces);
+    pmshWrite(fp, EToP, Nelements*Nfaces);
+    pmshWrite(fp, EToB, Nelements*Nfaces);
+    pmshWrite(fp, internalElementIds, NinternalElements);
+    pmshWrite(fp, haloElementIds, NhaloElements);
+    pmshWrite(fp, haloIds, NallElements);
+    pmshWrite(fp, globalIds, NallElements*Np);
+    pmshWrite(fp, mapB, NallElements*Np);
+
+    ok = !ferror(fp);
+    ok = (fclose(fp)==0) && ok;
+  }
+
+  comm.Allreduce(ok, Comm::Min);
+  LIBP_ABORT("Failed to write partitioned mesh " << baseName << ".pmsh",
+             !ok);
+
+  //write the manifest once every rank has its part on disk
+  if (rank==0) {
+    const std::string manifest = baseName + ".pmsh";
+    fp = fopen(manifest.c_str(), "w");
+    LIBP_ABORT("Failed to open " << manifest << " for writing.",
+               fp==nullptr);
+    fprintf(fp, "libParanumal partitioned mesh\n");
+    fprintf(fp, "ranks %d\n", size);
+    fprintf(fp, "dim %d\n", dim);
+    fprintf(fp, "element type %d\n", static_cast<int>(elementType));
+    fclose(fp);
+
+    printf("Saved partitioned mesh %s (%d ranks, " hlongFormat " elements)\n",
+           manifest.c_str(), size, NelementsGlobal);
+  }
+}
+
+/*
+  purpose: map in a partitioned mesh written by SavePartitioned. Replaces
+  ReadGmsh, Partition, Connect, ConnectBoundary, and HaloSetup, and
+  ConnectNodes if the polynomial degree matches.
+*/
+void mesh_t::LoadPartitioned(const std::string fileName){
+
+  const std::string baseName = pmshBaseName(fileName);
+
+  //read the manifest on rank 0 and share it
+  int info[3] = {-1, -1, -1}; //ranks, dim, element type
+  if (rank==0) {
+    const std::string manifest = baseName + ".pmsh";
+    FILE *fp = fopen(manifest.c_str(), "r");
+    if (fp) {
+      if (fscanf(fp, "libParanumal partitioned mesh ranks %d dim %d element type %d",
+                 info+0, info+1, info+2)!=3) {
+        info[0] = -1;
+      }
+      fclose(fp);
+    }
+  }
+  memory<int> h_info(3);
+  h_info.copyFrom(info);
+  comm.Bcast(h_info, 0);
+
+  LIBP_ABORT("Unable to read partitioned mesh manifest " << baseName << ".pmsh",
+             h_info[0]<0);
+  LIBP_ABORT("Partitioned mesh " << baseName << ".pmsh was written for " << h_info[0]
+             << " ranks, but running with " << size << " ranks.",
+             h_info[0]!=size);
+  LIBP_ABORT("Partitioned mesh " << baseName << ".pmsh has dimension " << h_info[1]
+             << " and element type " << h_info[2] << ", which does not match the settings.",
+             h_info[1]!=dim || h_info[2]!=static_cast<int>(elementType));
+
+  /*map this rank's file*/
+  const std::string rankFileName = pmshRankFileName(baseName, rank);
+  int fd = open(rankFileName.c_str(), O_RDONLY);
+  LIBP_ABORT("Failed to open partitioned mesh file " << rankFileName,
+             fd<0);
+
+  struct stat fileStat;
+  LIBP_ABORT("Failed to stat partitioned mesh file " << rankFileName,
+             fstat(fd, &fileStat));
+  const size_t fileSize = fileStat.st_size;
+
+  void *mapped = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  LIBP_ABORT("Failed to map partitioned mesh file " << rankFileName,
+             mapped==MAP_FAILED);
+
+  pmshReader_t reader;
+  reader.ptr = static_cast<const char*>(mapped);
+  reader.left = fileSize;
+  reader.fileName = rankFileName;
+
+  int32_t header[hNheader];
+  LIBP_ABORT("Partitioned mesh file " << rankFileName << " is corrupt.",
+             fileSize<sizeof(pmshMagic)+sizeof(header)
+             || std::memcmp(reader.ptr, pmshMagic, sizeof(pmshMagic)));
+  std::memcpy(header, reader.ptr+sizeof(pmshMagic), sizeof(header));
+  reader.Skip(sizeof(pmshMagic)+sizeof(header));
+
+  LIBP_ABORT("Partitioned mesh file " << rankFileName << " does not match the manifest.",
+             header[hRank]!=rank || header[hSize]!=size
+             || header[hDim]!=dim || header[hElementType]!=static_cast<int>(elementType)
+             || header[hNverts]!=Nverts || header[hNfaces]!=Nfaces);
+  LIBP_ABORT("Partitioned mesh file " << rankFileName << " was written with different "
+             << "hlong/dlong/dfloat types.",
+             header[hHlong]!=sizeof(hlong) || header[hDlong]!=sizeof(dlong)
+             || header[hDfloat]!=sizeof(dfloat));
+
+  int64_t sizes[cNcount];
+  LIBP_ABORT("Partitioned mesh file " << rankFileName << " is truncated.",
+             reader.left<sizeof(sizes));
+  std::memcpy(sizes, reader.ptr, sizeof(sizes));
+  reader.Skip(sizeof(sizes));
+
+  Nelements         = sizes[cNelements];
+  NelementsGlobal   = sizes[cNelementsGlobal];
+  Nnodes            = sizes[cNnodes];
+  totalHaloPairs    = sizes[cTotalHaloPairs];
+  NhaloElements     = sizes[cNhaloElements];
+  NinternalElements = sizes[cNinternalElements];
+
+  const dlong NallElements = Nelements+totalHaloPairs;
+  const int savedN = header[hN];
+
+  memory<hlong> haloIds;
+
+  reader.Read(EX, Nelements*Nverts);
+  reader.Read(EY, Nelements*Nverts);
+  if (dim==3) reader.Read(EZ, Nelements*Nverts);
+  reader.Read(EToV, Nelements*Nverts);
+  reader.Read(elementInfo, Nelements);
+  reader.Read(EToE, Nelements*Nfaces);
+  reader.Read(EToF, Nelements*Nfaces);
+  reader.Read(EToP, Nelements*Nfaces);
+  reader.Read(EToB, Nelements*Nfaces);
+  reader.Read(internalElementIds, NinternalElements);
+  reader.Read(haloElementIds, NhaloElements);
+  reader.Read(haloIds, NallElements);
+
+  //node numbering is only valid for the degree it was built with
+  if (savedN==N) {
+    reader.Read(globalIds, NallElements*Np);
+    reader.Read(mapB, NallElements*Np);
+  }
+
+  munmap(mapped, fileSize);
+
+  NboundaryFaces = 0;
+  boundaryInfo.free();
+
+  o_EToB = platform.malloc<int>(EToB);
+  o_internalElementIds = platform.malloc<dlong>(internalElementIds);
+  o_haloElementIds = platform.malloc<dlong>(haloElementIds);
+  if (savedN==N) o_mapB = platform.malloc<int>(mapB);
+
+  //make a halo exchange op
+  bool verbose = false;
+  halo.Setup(NallElements,
+             haloIds, comm,
+             ogs::Pairwise, verbose, platform);
+}
+
+} //namespace libp
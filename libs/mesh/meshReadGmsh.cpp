@@ -0,0 +1,717 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "mesh.hpp"
+#include <map>
+
+namespace libp {
+
+/*
+   Distributed Gmsh reader.
+
+   Every rank reads only a byte range of the file. Section markers are located
+   by a parallel scan, node and element records are parsed from each rank's
+   chunk, elements are shipped to their owning rank, and vertex coordinates
+   are fetched through a distributed directory where global vertex v lives on
+   rank v%size. No rank ever holds the full node list.
+
+   Supported formats: 2.2 ASCII and 4.1 binary.
+*/
+
+static constexpr int gmshMaxName = 24;
+
+// location of a "$Section" line in the file
+typedef struct {
+  long int offset;
+  char name[gmshMaxName];
+} gmshMarker_t;
+
+// contiguous run of node or element records in a 4.1 binary section
+typedef struct {
+  long int offset; // byte offset of the block's first record
+  hlong count;     // number of records in block
+  hlong start;     // index of first record among all blocks of this kind
+  int type;        // element type (or parametric coordinates per node)
+  int physical;    // physical tag of the block's entity
+} gmshBlock_t;
+
+// vertex coordinates keyed by global vertex id
+typedef struct {
+  hlong id;
+  dfloat x[3];
+} gmshNode_t;
+
+// records read from this rank's chunk of the file
+struct gmshChunk_t {
+  std::vector<hlong> elements; // (physical tag, vertex ids) per element
+  std::vector<hlong> faces;    // (physical tag, vertex ids) per boundary face
+  std::vector<gmshNode_t> nodes;
+};
+
+// number of nodes for Gmsh element types 1-31
+static const int gmshNodesPerElement[32] = { 0,
+   2,  3,  4,  4,  8,  6,  5,  3,  6,  9, 10, 27, 18, 14,  1,
+   8, 20, 15, 13,  9, 10, 12, 15, 15, 21,  4,  5,  6, 20, 35, 56};
+
+// split N records evenly over ranks and return the range owned by rank r
+static void gmshChunkRange(const hlong N, const int r, const int size,
+                           hlong& start, hlong& end) {
+  const hlong chunk = N/size;
+  const int remainder = (int) (N - chunk*size);
+  start = r*chunk + std::min(r, remainder);
+  end   = start + chunk + (r<remainder);
+}
+
+static void gmshRead(FILE* fp, void* ptr, const size_t bytes,
+                     const std::string& fileName) {
+  LIBP_ABORT("Error reading mesh file: " << fileName,
+             bytes && fread(ptr, bytes, 1, fp)!=1);
+}
+
+static int gmshReadInt(FILE* fp, const std::string& fileName) {
+  int val;
+  gmshRead(fp, &val, sizeof(int), fileName);
+  return val;
+}
+
+static hlong gmshReadSize(FILE* fp, const int dataSize,
+                          const std::string& fileName) {
+  if (dataSize==8) {
+    uint64_t val;
+    gmshRead(fp, &val, 8, fileName);
+    return static_cast<hlong>(val);
+  } else {
+    uint32_t val;
+    gmshRead(fp, &val, 4, fileName);
+    return static_cast<hlong>(val);
+  }
+}
+
+// skip the rest of the current line
+static void gmshSkipLine(FILE* fp, const std::string& fileName) {
+  char buf[BUFSIZ];
+  do {
+    LIBP_ABORT("Error reading mesh file: " << fileName,
+               !fgets(buf, BUFSIZ, fp));
+  } while (!strchr(buf, '\n'));
+}
+
+/* each rank scans its byte range for lines starting with '$' and the
+   markers found are shared with all ranks, ordered by offset */
+static memory<gmshMarker_t> gmshFindSections(FILE* fp, const comm_t& comm) {
+
+  const int rank = comm.rank();
+  const int size = comm.size();
+
+  fseek(fp, 0, SEEK_END);
+  const long int fileSize = ftell(fp);
+
+  const long int begin = (fileSize*rank)/size;
+  const long int end   = (fileSize*(rank+1))/size;
+
+  constexpr long int blockSize = 1<<20;
+  memory<char> buf(blockSize + gmshMaxName + 1);
+
+  std::vector<gmshMarker_t> found;
+  for (long int pos=begin; pos<end; pos+=blockSize) {
+    // read one byte before the block to see if it starts a line, and
+    // enough past the end to hold a marker name straddling the boundary
+    const long int first = std::max(pos-1, 0L);
+    const long int last  = std::min(pos+blockSize+gmshMaxName, fileSize);
+    fseek(fp, first, SEEK_SET);
+    const size_t Nread = fread(buf.ptr(), 1, last-first, fp);
+
+    const long int blockEnd = std::min(pos+blockSize, end);
+    for (long int i=pos;i<blockEnd;++i) {
+      const char *c = buf.ptr() + (i-first);
+      if (*c!='$' || (i>0 && *(c-1)!='\n')) continue;
+
+      gmshMarker_t marker;
+      marker.offset = i;
+      int n=0;
+      while (n<gmshMaxName-1 && (i-first)+n<(long int)Nread
+             && c[n]!='\n' && c[n]!='\r' && c[n]!=' ') {
+        marker.name[n] = c[n];
+        ++n;
+      }
+      marker.name[n] = '\0';
+      found.push_back(marker);
+    }
+  }
+
+  int Nfound = static_cast<int>(found.size());
+  memory<int> counts(size);
+  memory<int> offsets(size, 0);
+  comm.Allgather(Nfound, counts);
+  for (int r=1;r<size;++r) offsets[r] = offsets[r-1] + counts[r-1];
+
+  memory<gmshMarker_t> localMarkers(Nfound);
+  localMarkers.copyFrom(found.data(), Nfound);
+
+  memory<gmshMarker_t> markers(offsets[size-1]+counts[size-1]);
+  comm.Allgatherv(localMarkers, Nfound, markers, counts, offsets);
+  return markers;
+}
+
+// offset of the first marker called name found after the given offset, or -1
+static long int gmshFindMarker(const memory<gmshMarker_t> markers,
+                               const char* name, const long int after) {
+  for (size_t m=0;m<markers.length();++m) {
+    if (markers[m].offset>after && !strcmp(markers[m].name, name))
+      return markers[m].offset;
+  }
+  return -1;
+}
+
+// first line start at or after rank r's nominal offset in [begin, end)
+static long int gmshLineStart(FILE* fp, const long int begin, const long int end,
+                              const int r, const int size) {
+  if (r==0) return begin;
+  if (r==size) return end;
+
+  long int pos = begin + ((end-begin)*r)/size;
+  fseek(fp, pos-1, SEEK_SET);
+  for (int c=fgetc(fp); c!='\n' && c!=EOF && pos<end; c=fgetc(fp)) ++pos;
+  return std::min(pos, end);
+}
+
+// call parse on each line starting in this rank's share of [begin, end)
+template<typename Parser>
+static void gmshReadLines(FILE* fp, const std::string& fileName,
+                          const long int begin, const long int end,
+                          const comm_t& comm, Parser parse) {
+  const long int lo = gmshLineStart(fp, begin, end, comm.rank(),   comm.size());
+  const long int hi = gmshLineStart(fp, begin, end, comm.rank()+1, comm.size());
+
+  char buf[BUFSIZ];
+  fseek(fp, lo, SEEK_SET);
+  for (long int pos=lo; pos<hi; ) {
+    LIBP_ABORT("Error reading mesh file: " << fileName,
+               !fgets(buf, BUFSIZ, fp));
+    pos += strlen(buf);
+    parse(buf);
+  }
+}
+
+// byte offset of the body of the section starting at marker,
+// skipping Nheader lines after the marker line
+static long int gmshSectionBody(FILE* fp, const std::string& fileName,
+                                const long int marker, const int Nheader) {
+  fseek(fp, marker, SEEK_SET);
+  for (int n=0;n<=Nheader;++n) gmshSkipLine(fp, fileName);
+  return ftell(fp);
+}
+
+static void gmshReadAscii22(FILE* fp, const std::string& fileName,
+                            const memory<gmshMarker_t> markers,
+                            const comm_t& comm,
+                            const int elementType, const int Nverts,
+                            const int faceType, const int NfaceVertices,
+                            gmshChunk_t& chunk) {
+
+  const long int nodes    = gmshFindMarker(markers, "$Nodes", -1);
+  const long int endNodes = gmshFindMarker(markers, "$EndNodes", nodes);
+  const long int elements    = gmshFindMarker(markers, "$Elements", endNodes);
+  const long int endElements = gmshFindMarker(markers, "$EndElements", elements);
+  LIBP_ABORT("Error finding $Nodes/$Elements sections in mesh file: " << fileName,
+             nodes<0 || endNodes<0 || elements<0 || endElements<0);
+
+  /* node lines: id x y z */
+  gmshReadLines(fp, fileName,
+                gmshSectionBody(fp, fileName, nodes, 1), endNodes, comm,
+                [&](const char* buf) {
+    gmshNode_t node;
+    node.x[2] = 0.0;
+    sscanf(buf, hlongFormat dfloatFormat dfloatFormat dfloatFormat,
+           &node.id, node.x+0, node.x+1, node.x+2);
+    node.id -= 1;
+    chunk.nodes.push_back(node);
+  });
+
+  /* element lines: id type Ntags tag_1 ... tag_Ntags v_1 ... v_Nv */
+  gmshReadLines(fp, fileName,
+                gmshSectionBody(fp, fileName, elements, 1), endElements, comm,
+                [&](const char* buf) {
+    char *p = const_cast<char*>(buf);
+    std::strtoll(p, &p, 10); // element number
+    const int type = static_cast<int>(std::strtol(p, &p, 10));
+    if (type!=elementType && type!=faceType) return;
+
+    // first tag is the physical tag
+    const int Ntags = static_cast<int>(std::strtol(p, &p, 10));
+    hlong tag = 0;
+    for (int t=0;t<Ntags;++t) {
+      const hlong val = static_cast<hlong>(std::strtoll(p, &p, 10));
+      if (t==0) tag = val;
+    }
+
+    std::vector<hlong>& list = (type==elementType) ? chunk.elements : chunk.faces;
+    const int Nv = (type==elementType) ? Nverts : NfaceVertices;
+    list.push_back(tag);
+    for (int n=0;n<Nv;++n)
+      list.push_back(static_cast<hlong>(std::strtoll(p, &p, 10)) - 1);
+  });
+}
+
+// read n size_t-type values starting at the current file position
+static void gmshReadSizes(FILE* fp, const int dataSize, const hlong n,
+                          std::vector<hlong>& vals, const std::string& fileName) {
+  vals.resize(n);
+  if (dataSize==8) {
+    std::vector<uint64_t> raw(n);
+    gmshRead(fp, raw.data(), n*8, fileName);
+    for (hlong i=0;i<n;++i) vals[i] = static_cast<hlong>(raw[i]);
+  } else {
+    std::vector<uint32_t> raw(n);
+    gmshRead(fp, raw.data(), n*4, fileName);
+    for (hlong i=0;i<n;++i) vals[i] = static_cast<hlong>(raw[i]);
+  }
+}
+
+// read this rank's share of the records in a list of element blocks
+static void gmshReadElementBlocks(FILE* fp, const std::string& fileName,
+                                  const int dataSize,
+                                  const std::vector<gmshBlock_t>& blocks,
+                                  const hlong Ntotal, const int Nv,
+                                  const comm_t& comm,
+                                  std::vector<hlong>& list) {
+  hlong start, end;
+  gmshChunkRange(Ntotal, comm.rank(), comm.size(), start, end);
+
+  std::vector<hlong> vals;
+  for (const gmshBlock_t& block : blocks) {
+    const hlong lo = std::max(start, block.start);
+    const hlong hi = std::min(end, block.start+block.count);
+    if (lo>=hi) continue;
+
+    // records are (element tag, node tags)
+    const int stride = 1+gmshNodesPerElement[block.type];
+    fseek(fp, block.offset + (lo-block.start)*stride*dataSize, SEEK_SET);
+    gmshReadSizes(fp, dataSize, (hi-lo)*stride, vals, fileName);
+
+    for (hlong e=0;e<hi-lo;++e) {
+      list.push_back(block.physical);
+      for (int n=0;n<Nv;++n)
+        list.push_back(vals[e*stride+1+n] - 1);
+    }
+  }
+}
+
+static void gmshBcastBlocks(std::vector<gmshBlock_t>& blocks, const comm_t& comm) {
+  int Nblocks = static_cast<int>(blocks.size());
+  comm.Bcast(Nblocks, 0);
+
+  memory<gmshBlock_t> buf(Nblocks);
+  if (comm.rank()==0) buf.copyFrom(blocks.data(), Nblocks);
+  comm.Bcast(buf, 0);
+  blocks.assign(buf.ptr(), buf.ptr()+Nblocks);
+}
+
+static void gmshReadBinary41(FILE* fp, const std::string& fileName,
+                             const memory<gmshMarker_t> markers,
+                             const comm_t& comm, const int dataSize,
+                             const int elementType, const int Nverts,
+                             const int faceType, const int NfaceVertices,
+                             gmshChunk_t& chunk) {
+
+  const long int entities = gmshFindMarker(markers, "$Entities", -1);
+  const long int nodes    = gmshFindMarker(markers, "$Nodes", -1);
+  const long int elements = gmshFindMarker(markers, "$Elements", nodes);
+  LIBP_ABORT("Error finding $Nodes/$Elements sections in mesh file: " << fileName,
+             nodes<0 || elements<0);
+
+  LIBP_ABORT("Gmsh element type " << elementType << " has "
+             << gmshNodesPerElement[elementType] << " nodes, expected " << Nverts,
+             gmshNodesPerElement[elementType]!=Nverts);
+
+  /* rank 0 indexes the blocks of the $Nodes and $Elements sections by
+     hopping from block header to block header, then shares the index */
+  std::vector<gmshBlock_t> nodeBlocks, elementBlocks, faceBlocks;
+
+  if (comm.rank()==0) {
+    // physical tag of each (dim, entity tag)
+    std::map<std::pair<int,int>, int> physical;
+    if (entities>=0) {
+      gmshSectionBody(fp, fileName, entities, 0);
+      hlong Nentities[4];
+      for (int d=0;d<4;++d) Nentities[d] = gmshReadSize(fp, dataSize, fileName);
+
+      for (int d=0;d<4;++d) {
+        for (hlong i=0;i<Nentities[d];++i) {
+          const int tag = gmshReadInt(fp, fileName);
+          // point coordinates or bounding box
+          fseek(fp, (d==0 ? 3 : 6)*sizeof(double), SEEK_CUR);
+
+          const hlong Nphysical = gmshReadSize(fp, dataSize, fileName);
+          int first = 0;
+          for (hlong p=0;p<Nphysical;++p) {
+            const int phys = gmshReadInt(fp, fileName);
+            if (p==0) first = phys;
+          }
+          physical[{d, tag}] = first;
+
+          if (d>0) {
+            const hlong Nbounding = gmshReadSize(fp, dataSize, fileName);
+            fseek(fp, Nbounding*sizeof(int), SEEK_CUR);
+          }
+        }
+      }
+    }
+
+    /* $Nodes: blocks of (dim tag parametric count) headers followed by
+       count node tags and count (x y z [u v w]) coordinate tuples */
+    gmshSectionBody(fp, fileName, nodes, 0);
+    const hlong NnodeBlocks = gmshReadSize(fp, dataSize, fileName);
+    for (int n=0;n<3;++n) gmshReadSize(fp, dataSize, fileName);
+
+    hlong Nnodes = 0;
+    for (hlong b=0;b<NnodeBlocks;++b) {
+      const int dim        = gmshReadInt(fp, fileName);
+      /*entity tag*/         gmshReadInt(fp, fileName);
+      const int parametric = gmshReadInt(fp, fileName);
+
+      gmshBlock_t block;
+      block.count  = gmshReadSize(fp, dataSize, fileName);
+      block.offset = ftell(fp);
+      block.start  = Nnodes;
+      block.type   = parametric ? dim : 0;
+      block.physical = 0;
+      nodeBlocks.push_back(block);
+
+      Nnodes += block.count;
+      fseek(fp, block.count*(dataSize + (3+block.type)*sizeof(double)), SEEK_CUR);
+    }
+
+    /* $Elements: blocks of (dim tag type count) headers followed by
+       count (element tag, node tags) records */
+    gmshSectionBody(fp, fileName, elements, 0);
+    const hlong NelementBlocks = gmshReadSize(fp, dataSize, fileName);
+    for (int n=0;n<3;++n) gmshReadSize(fp, dataSize, fileName);
+
+    hlong Nelements = 0, Nfaces = 0;
+    for (hlong b=0;b<NelementBlocks;++b) {
+      const int dim = gmshReadInt(fp, fileName);
+      const int tag = gmshReadInt(fp, fileName);
+
+      gmshBlock_t block;
+      block.type   = gmshReadInt(fp, fileName);
+      block.count  = gmshReadSize(fp, dataSize, fileName);
+      block.offset = ftell(fp);
+      block.physical = physical.count({dim, tag}) ? physical[{dim, tag}] : 0;
+
+      LIBP_ABORT("Unsupported Gmsh element type " << block.type
+                 << " in mesh file: " << fileName,
+                 block.type<1 || block.type>31);
+
+      if (block.type==elementType) {
+        block.start = Nelements;
+        Nelements += block.count;
+        elementBlocks.push_back(block);
+      } else if (block.type==faceType) {
+        block.start = Nfaces;
+        Nfaces += block.count;
+        faceBlocks.push_back(block);
+      }
+
+      fseek(fp, block.count*(1+gmshNodesPerElement[block.type])*dataSize, SEEK_CUR);
+    }
+  }
+
+  gmshBcastBlocks(nodeBlocks, comm);
+  gmshBcastBlocks(elementBlocks, comm);
+  gmshBcastBlocks(faceBlocks, comm);
+
+  /* read this rank's share of nodes */
+  const hlong Nnodes = nodeBlocks.size()
+                       ? nodeBlocks.back().start + nodeBlocks.back().count : 0;
+  hlong start, end;
+  gmshChunkRange(Nnodes, comm.rank(), comm.size(), start, end);
+
+  std::vector<hlong> tags;
+  std::vector<double> coords;
+  for (const gmshBlock_t& block : nodeBlocks) {
+    const hlong lo = std::max(start, block.start);
+    const hlong hi = std::min(end, block.start+block.count);
+    if (lo>=hi) continue;
+
+    fseek(fp, block.offset + (lo-block.start)*dataSize, SEEK_SET);
+    gmshReadSizes(fp, dataSize, hi-lo, tags, fileName);
+
+    const int stride = 3 + block.type;
+    coords.resize((hi-lo)*stride);
+    fseek(fp, block.offset + block.count*dataSize
+              + (lo-block.start)*stride*sizeof(double), SEEK_SET);
+    gmshRead(fp, coords.data(), coords.size()*sizeof(double), fileName);
+
+    for (hlong n=0;n<hi-lo;++n) {
+      gmshNode_t node;
+      node.id = tags[n]-1;
+      for (int d=0;d<3;++d) node.x[d] = static_cast<dfloat>(coords[n*stride+d]);
+      chunk.nodes.push_back(node);
+    }
+  }
+
+  /* read this rank's share of elements and boundary faces */
+  const hlong Nelements = elementBlocks.size()
+                          ? elementBlocks.back().start + elementBlocks.back().count : 0;
+  const hlong Nfaces = faceBlocks.size()
+                       ? faceBlocks.back().start + faceBlocks.back().count : 0;
+
+  gmshReadElementBlocks(fp, fileName, dataSize, elementBlocks, Nelements,
+                        Nverts, comm, chunk.elements);
+  gmshReadElementBlocks(fp, fileName, dataSize, faceBlocks, Nfaces,
+                        NfaceVertices, comm, chunk.faces);
+}
+
+/*
+   purpose: read this rank's share of the Gmsh elements of type
+   gmshElementType, all boundary faces of type gmshFaceType, and the
+   coordinates of the vertices of the local elements
+*/
+void mesh_t::ReadGmshDistributed(const std::string fileName,
+                                 const int gmshElementType,
+                                 const int gmshFaceType){
+
+  FILE *fp = fopen(fileName.c_str(), "rb");
+  LIBP_ABORT("Cannot open file: " << fileName,
+             fp==NULL);
+
+  memory<gmshMarker_t> markers = gmshFindSections(fp, comm);
+
+  /* read mesh format */
+  const long int format = gmshFindMarker(markers, "$MeshFormat", -1);
+  LIBP_ABORT("Error finding $MeshFormat in mesh file: " << fileName,
+             format<0);
+
+  char buf[BUFSIZ];
+  fseek(fp, format, SEEK_SET);
+  gmshSkipLine(fp, fileName);
+  LIBP_ABORT("Error reading mesh file: " << fileName,
+             !fgets(buf, BUFSIZ, fp));
+
+  double version=0;
+  int fileType=0, dataSize=0;
+  sscanf(buf, "%lf %d %d", &version, &fileType, &dataSize);
+
+  gmshChunk_t chunk;
+  if (fileType==0 && version<3.0) {
+    gmshReadAscii22(fp, fileName, markers, comm,
+                    gmshElementType, Nverts, gmshFaceType, NfaceVertices, chunk);
+  } else if (fileType==1 && version>=4.1) {
+    LIBP_ABORT("Unsupported data size " << dataSize << " in mesh file: " << fileName,
+               dataSize!=4 && dataSize!=8);
+    LIBP_ABORT("Mesh file " << fileName << " was written with a different endianness",
+               gmshReadInt(fp, fileName)!=1);
+    gmshReadBinary41(fp, fileName, markers, comm, dataSize,
+                     gmshElementType, Nverts, gmshFaceType, NfaceVertices, chunk);
+  } else {
+    LIBP_FORCE_ABORT("Unsupported Gmsh format " << version
+                     << (fileType ? " binary" : " ASCII")
+                     << " in mesh file: " << fileName
+                     << ". Supported formats are 2.2 ASCII and 4.1 binary.");
+  }
+  fclose(fp);
+
+  /*****************************
+   * Element ownership
+   *****************************/
+  /* ship elements so rank r owns the r-th contiguous chunk of
+     elements in file order */
+  const int stride = Nverts+1;
+  const hlong NelementsRead = chunk.elements.size()/stride;
+
+  hlong firstRead = NelementsRead;
+  comm.Scan(NelementsRead, firstRead);
+  firstRead -= NelementsRead;
+
+  hlong gNelements = NelementsRead;
+  comm.Allreduce(gNelements);
+
+  memory<int> Nsend(size, 0);
+  memory<int> Nrecv(size, 0);
+  memory<int> sendOffsets(size, 0);
+  memory<int> recvOffsets(size, 0);
+
+  for (int rr=0;rr<size;++rr) {
+    hlong start, end;
+    gmshChunkRange(gNelements, rr, size, start, end);
+    const hlong lo = std::max(start, firstRead);
+    const hlong hi = std::min(end, firstRead+NelementsRead);
+    if (lo<hi) Nsend[rr] = static_cast<int>((hi-lo)*stride);
+  }
+  comm.Alltoall(Nsend, Nrecv);
+
+  for (int rr=1;rr<size;++rr) {
+    sendOffsets[rr] = sendOffsets[rr-1] + Nsend[rr-1];
+    recvOffsets[rr] = recvOffsets[rr-1] + Nrecv[rr-1];
+  }
+  const dlong Nrecvd = recvOffsets[size-1] + Nrecv[size-1];
+
+  memory<hlong> sendElements(chunk.elements.size());
+  sendElements.copyFrom(chunk.elements.data(), chunk.elements.size());
+  chunk.elements.clear();
+
+  memory<hlong> recvElements(Nrecvd);
+  comm.Alltoallv(sendElements, Nsend, sendOffsets,
+                 recvElements, Nrecv, recvOffsets);
+  sendElements.free();
+
+  Nelements = Nrecvd/stride;
+  EToV.malloc(Nelements*Nverts);
+  elementInfo.malloc(Nelements);
+  for (dlong e=0;e<Nelements;++e) {
+    elementInfo[e] = recvElements[e*stride];
+    for (int n=0;n<Nverts;++n)
+      EToV[e*Nverts+n] = recvElements[e*stride+1+n];
+  }
+  recvElements.free();
+
+  /*****************************
+   * Boundary faces
+   *****************************/
+  /* every rank keeps the full list of boundary faces */
+  const int faceStride = NfaceVertices+1;
+  int NfaceData = static_cast<int>(chunk.faces.size());
+  memory<int> faceCounts(size);
+  memory<int> faceOffsets(size, 0);
+  comm.Allgather(NfaceData, faceCounts);
+  for (int rr=1;rr<size;++rr) faceOffsets[rr] = faceOffsets[rr-1] + faceCounts[rr-1];
+
+  memory<hlong> localFaces(NfaceData);
+  localFaces.copyFrom(chunk.faces.data(), NfaceData);
+  chunk.faces.clear();
+
+  boundaryInfo.malloc(faceOffsets[size-1] + faceCounts[size-1]);
+  comm.Allgatherv(localFaces, NfaceData, boundaryInfo, faceCounts, faceOffsets);
+  NboundaryFaces = boundaryInfo.length()/faceStride;
+
+  /*****************************
+   * Vertex coordinates
+   *****************************/
+  /* vertex v is held by rank v%size in slot v/size */
+  hlong maxId = -1;
+  for (const gmshNode_t& node : chunk.nodes) maxId = std::max(maxId, node.id);
+  comm.Allreduce(maxId, Comm::Max);
+  Nnodes = maxId+1;
+
+  const hlong Nslots = (Nnodes+size-1)/size;
+
+  for (int rr=0;rr<size;++rr) Nsend[rr] = 0;
+  for (const gmshNode_t& node : chunk.nodes) ++Nsend[node.id%size];
+  comm.Alltoall(Nsend, Nrecv);
+  for (int rr=1;rr<size;++rr) {
+    sendOffsets[rr] = sendOffsets[rr-1] + Nsend[rr-1];
+    recvOffsets[rr] = recvOffsets[rr-1] + Nrecv[rr-1];
+  }
+
+  memory<gmshNode_t> sendNodes(chunk.nodes.size());
+  for (int rr=0;rr<size;++rr) Nsend[rr] = 0;
+  for (const gmshNode_t& node : chunk.nodes) {
+    const int rr = static_cast<int>(node.id%size);
+    sendNodes[sendOffsets[rr] + Nsend[rr]++] = node;
+  }
+  chunk.nodes.clear();
+
+  dlong NrecvNodes = recvOffsets[size-1] + Nrecv[size-1];
+  memory<gmshNode_t> recvNodes(NrecvNodes);
+  comm.Alltoallv(sendNodes, Nsend, sendOffsets,
+                 recvNodes, Nrecv, recvOffsets);
+  sendNodes.free();
+
+  memory<dfloat> directory(3*Nslots);
+  memory<int> inDirectory(Nslots, 0);
+  for (dlong n=0;n<NrecvNodes;++n) {
+    const hlong slot = recvNodes[n].id/size;
+    for (int d=0;d<3;++d) directory[3*slot+d] = recvNodes[n].x[d];
+    inDirectory[slot] = 1;
+  }
+  recvNodes.free();
+
+  /* request the coordinates of the vertices of the local elements */
+  std::vector<hlong> vertexIds(EToV.ptr(), EToV.ptr()+Nelements*Nverts);
+  std::sort(vertexIds.begin(), vertexIds.end());
+  vertexIds.erase(std::unique(vertexIds.begin(), vertexIds.end()), vertexIds.end());
+  const dlong Nvertices = vertexIds.size();
+
+  for (int rr=0;rr<size;++rr) Nsend[rr] = 0;
+  for (const hlong v : vertexIds) ++Nsend[v%size];
+  comm.Alltoall(Nsend, Nrecv);
+  for (int rr=1;rr<size;++rr) {
+    sendOffsets[rr] = sendOffsets[rr-1] + Nsend[rr-1];
+    recvOffsets[rr] = recvOffsets[rr-1] + Nrecv[rr-1];
+  }
+
+  memory<hlong> sendIds(Nvertices);
+  for (int rr=0;rr<size;++rr) Nsend[rr] = 0;
+  for (const hlong v : vertexIds) {
+    const int rr = static_cast<int>(v%size);
+    sendIds[sendOffsets[rr] + Nsend[rr]++] = v;
+  }
+
+  const dlong Nrequests = recvOffsets[size-1] + Nrecv[size-1];
+  memory<hlong> recvIds(Nrequests);
+  comm.Alltoallv(sendIds, Nsend, sendOffsets,
+                 recvIds, Nrecv, recvOffsets);
+
+  /* answer requests, then return them along the reverse route */
+  memory<gmshNode_t> replies(Nrequests);
+  for (dlong n=0;n<Nrequests;++n) {
+    const hlong slot = recvIds[n]/size;
+    LIBP_ABORT("Vertex " << recvIds[n]+1 << " not found in mesh file: " << fileName,
+               slot>=Nslots || !inDirectory[slot]);
+    replies[n].id = recvIds[n];
+    for (int d=0;d<3;++d) replies[n].x[d] = directory[3*slot+d];
+  }
+  directory.free();
+
+  memory<gmshNode_t> vertices(Nvertices);
+  comm.Alltoallv(replies, Nrecv, recvOffsets,
+                 vertices, Nsend, sendOffsets);
+
+  std::sort(vertices.ptr(), vertices.ptr()+Nvertices,
+            [](const gmshNode_t& a, const gmshNode_t& b) {
+              return a.id < b.id;
+            });
+
+  /* collect vertices for each element */
+  EX.malloc(Nverts*Nelements);
+  EY.malloc(Nverts*Nelements);
+  if (dim==3) EZ.malloc(Nverts*Nelements);
+  for(dlong e=0;e<Nelements;++e){
+    for(int n=0;n<Nverts;++n){
+      const hlong vid = EToV[e*Nverts+n];
+      const gmshNode_t* node = std::lower_bound(vertices.ptr(), vertices.ptr()+Nvertices, vid,
+                                                [](const gmshNode_t& a, const hlong id) {
+                                                  return a.id < id;
+                                                });
+      EX[e*Nverts+n] = node->x[0];
+      EY[e*Nverts+n] = node->x[1];
+      if (dim==3) EZ[e*Nverts+n] = node->x[2];
+    }
+  }
+}
+
+} //namespace libp
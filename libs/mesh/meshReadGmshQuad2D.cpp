@@ -33,142 +33,18 @@ namespace libp {
 */
 void mesh_t::ReadGmshQuad2D(const std::string fileName){
 
-  FILE *fp = fopen(fileName.c_str(), "r");
-  LIBP_ABORT("Cannot open file: " << fileName,
-             fp==NULL);
+  /* read this rank's quadrilaterals (code 3) and all boundary lines (code 1) */
+  ReadGmshDistributed(fileName, 3, 1);
 
-  char buf[BUFSIZ];
-  do{
-    //read to end of line
-    LIBP_ABORT("Error reading mesh file: " << fileName,
-               !fgets(buf, BUFSIZ, fp));
-  }while(!strstr(buf, "$Nodes"));
-
-  /* read number of nodes in mesh */
-  //read to end of line
-  LIBP_ABORT("Error reading mesh file: " << fileName,
-             !fgets(buf, BUFSIZ, fp));
-  sscanf(buf, hlongFormat, &(Nnodes));
-
-  /* allocate space for node coordinates */
-  memory<dfloat> VX(Nnodes);
-  memory<dfloat> VY(Nnodes);
-
-  /* load nodes */
-  for(hlong n=0;n<Nnodes;++n){
-    //read to end of line
-    LIBP_ABORT("Error reading mesh file: " << fileName,
-               !fgets(buf, BUFSIZ, fp));
-    sscanf(buf, "%*d" dfloatFormat dfloatFormat, VX.ptr()+n, VY.ptr()+n);
-  }
-
-  /* look for section with Element node data */
-  do{
-    //read to end of line
-    LIBP_ABORT("Error reading mesh file: " << fileName,
-               !fgets(buf, BUFSIZ, fp));
-  }while(!strstr(buf, "$Elements"));
-
-  /* read number of nodes in mesh */
-  hlong gNelements;
-  //read to end of line
-  LIBP_ABORT("Error reading mesh file: " << fileName,
-             !fgets(buf, BUFSIZ, fp));
-  sscanf(buf, hlongFormat, &gNelements);
-
-  /* find # of quadrilaterals */
-  fpos_t fpos;
-  fgetpos(fp, &fpos);
-  hlong Nquadrilaterals = 0;
-  hlong gNboundaryFaces = 0;
-
-  for(hlong n=0;n<gNelements;++n){
-    int ElementType;
-    //read to end of line
-    LIBP_ABORT("Error reading mesh file: " << fileName,
-               !fgets(buf, BUFSIZ, fp));
-    sscanf(buf, "%*d%d", &ElementType);
-    if(ElementType==1) ++gNboundaryFaces;
-    if(ElementType==3) ++Nquadrilaterals;
-  }
-  // rewind to start of elements
-  fsetpos(fp, &fpos);
-
-  hlong chunk = (hlong) Nquadrilaterals/size;
-  int remainder = (int) (Nquadrilaterals - chunk*size);
-
-  hlong NquadrilateralsLocal = chunk + (rank<remainder);
-
-  /* where do these elements start ? */
-  hlong start = rank*chunk + std::min(rank, remainder);
-  hlong end = start + NquadrilateralsLocal-1;
-
-  /* allocate space for Element node index data */
-  EToV.malloc(NquadrilateralsLocal*Nverts);
-  elementInfo.malloc(NquadrilateralsLocal);
-
-  /* scan through file looking for quadrilateral elements */
-  hlong cnt=0, bcnt=0;
-  Nquadrilaterals = 0;
-
-  boundaryInfo.malloc(gNboundaryFaces*3);
-  for(hlong n=0;n<gNelements;++n){
-    int ElementType;
-    hlong v1, v2, v3, v4;
-    //read to end of line
-    LIBP_ABORT("Error reading mesh file: " << fileName,
-               !fgets(buf, BUFSIZ, fp));
-    sscanf(buf, "%*d%d", &ElementType);
-
-    if(ElementType==1){ // boundary face
-      sscanf(buf, "%*d%*d %*d" hlongFormat "%*d" hlongFormat hlongFormat,
-             boundaryInfo.ptr()+bcnt*3, &v1, &v2);
-      boundaryInfo[bcnt*3+1] = v1-1;
-      boundaryInfo[bcnt*3+2] = v2-1;
-      ++bcnt;
-    }
-
-    if(ElementType==3){  // quadrilateral
-      if(start<=Nquadrilaterals && Nquadrilaterals<=end){
-        sscanf(buf, "%*d%*d%*d " hlongFormat " %*d" hlongFormat hlongFormat hlongFormat hlongFormat,
-               elementInfo.ptr()+cnt, &v1, &v2, &v3, &v4);
-
-        // check orientation
-        dfloat xe1 = VX[v1-1], xe2 = VX[v2-1], xe4 = VX[v4-1];
-        dfloat ye1 = VY[v1-1], ye2 = VY[v2-1], ye4 = VY[v4-1];
-        dfloat J = 0.25*((xe2-xe1)*(ye4-ye1) - (xe4-xe1)*(ye2-ye1));
-        if(J<0){
-          hlong v4tmp = v4;
-          v4 = v2;
-          v2 = v4tmp;
-          //      printf("unwarping element\n");
-        }
-
-        /* read vertex triplet for trianngle */
-        EToV[cnt*Nverts+0] = v1-1;
-        EToV[cnt*Nverts+1] = v2-1;
-        EToV[cnt*Nverts+2] = v3-1;
-        EToV[cnt*Nverts+3] = v4-1;
-        ++cnt;
-      }
-      ++Nquadrilaterals;
-    }
-  }
-  fclose(fp);
-
-  /* record number of boundary faces found */
-  NboundaryFaces = bcnt;
-
-  /* record number of found quadrilaterals */
-  Nelements = (dlong) NquadrilateralsLocal;
-
-  /* collect vertices for each element */
-  EX.malloc(Nverts*Nelements);
-  EY.malloc(Nverts*Nelements);
+  /* check orientation */
   for(dlong e=0;e<Nelements;++e){
-    for(int n=0;n<Nverts;++n){
-      EX[e*Nverts+n] = VX[EToV[e*Nverts+n]];
-      EY[e*Nverts+n] = VY[EToV[e*Nverts+n]];
+    dfloat xe1 = EX[e*Nverts+0], xe2 = EX[e*Nverts+1], xe4 = EX[e*Nverts+3];
+    dfloat ye1 = EY[e*Nverts+0], ye2 = EY[e*Nverts+1], ye4 = EY[e*Nverts+3];
+    dfloat J = 0.25*((xe2-xe1)*(ye4-ye1) - (xe4-xe1)*(ye2-ye1));
+    if(J<0){
+      std::swap(EToV[e*Nverts+1], EToV[e*Nverts+3]);
+      std::swap(EX[e*Nverts+1], EX[e*Nverts+3]);
+      std::swap(EY[e*Nverts+1], EY[e*Nverts+3]);
     }
   }
 }
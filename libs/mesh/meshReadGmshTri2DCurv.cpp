@@ -33,164 +33,41 @@ namespace libp {
 */
 void mesh_t::ReadGmshTri2DCurv(const std::string fileName){
 
-  FILE *fp = fopen(fileName.c_str(), "r");
-  LIBP_ABORT("Cannot open file: " << fileName,
-             fp==NULL);
-
-  char buf[BUFSIZ];
-
-  // look for Nodes section
-  do{
-    //read to end of line
-    LIBP_ABORT("Error reading mesh file: " << fileName,
-               !fgets(buf, BUFSIZ, fp));
-  }while(!strstr(buf, "$Nodes"));
-
-  /* read number of nodes in mesh */
-  //read to end of line
-  LIBP_ABORT("Error reading mesh file: " << fileName,
-             !fgets(buf, BUFSIZ, fp));
-  sscanf(buf, hlongFormat, &(Nnodes));
-
-  /* allocate space for node coordinates */
-  memory<dfloat> VX(Nnodes);
-  memory<dfloat> VY(Nnodes);
-
-  /* load nodes */
-  for(hlong n=0;n<Nnodes;++n){
-    //read to end of line
-    LIBP_ABORT("Error reading mesh file: " << fileName,
-               !fgets(buf, BUFSIZ, fp));
-    sscanf(buf, "%*d" dfloatFormat dfloatFormat, VX.ptr()+n, VY.ptr()+n);
-  }
-
-  /* look for section with Element node data */
-  do{
-    //read to end of line
-    LIBP_ABORT("Error reading mesh file: " << fileName,
-               !fgets(buf, BUFSIZ, fp));
-  }while(!strstr(buf, "$Elements"));
-
-  /* read number of elements in mesh */
-  hlong gNelements;
-  //read to end of line
-  LIBP_ABORT("Error reading mesh file: " << fileName,
-             !fgets(buf, BUFSIZ, fp));
-  sscanf(buf, hlongFormat, &gNelements);
-
-  /* find # of triangles */
-  fpos_t fpos;
-  fgetpos(fp, &fpos);
-  hlong Ntriangles = 0;
-  hlong gNboundaryFaces = 0;
-  for(hlong n=0;n<gNelements;++n){
-    int ElementType;
-    //read to end of line
-    LIBP_ABORT("Error reading mesh file: " << fileName,
-               !fgets(buf, BUFSIZ, fp));
-    sscanf(buf, "%*d%d", &ElementType);
-    if(ElementType==1) ++gNboundaryFaces;
-    if(ElementType==2) ++Ntriangles;
-  }
-  // rewind to start of elements
-  fsetpos(fp, &fpos);
-
-  hlong chunk = (hlong) Ntriangles/size;
-  int remainder = (int) (Ntriangles - chunk*size);
-
-  hlong NtrianglesLocal = chunk + (rank<remainder);
-
-  /* where do these elements start ? */
-  hlong start = rank*chunk + std::min(rank, remainder);
-  hlong end   = start + NtrianglesLocal-1;
-
-  /* allocate space for Element node index data */
-  EToV.malloc(NtrianglesLocal*Nverts);
-  elementInfo.malloc(NtrianglesLocal);
-
-  /* scan through file looking for triangle elements */
-  hlong cnt=0, bcnt=0;
-  Ntriangles = 0;
-
-  boundaryInfo.malloc(gNboundaryFaces*3);
-  for(hlong n=0;n<gNelements;++n){
-    int ElementType;
-    hlong v1, v2, v3;
-    //read to end of line
-    LIBP_ABORT("Error reading mesh file: " << fileName,
-               !fgets(buf, BUFSIZ, fp));
-    sscanf(buf, "%*d%d", &ElementType);
-    if(ElementType==1){ // boundary face
-      sscanf(buf, "%*d%*d %*d" hlongFormat "%*d" hlongFormat hlongFormat,
-             boundaryInfo.ptr()+bcnt*3, &v1, &v2);
-      boundaryInfo[bcnt*3+1] = v1-1;
-      boundaryInfo[bcnt*3+2] = v2-1;
-
-      if(boundaryInfo[bcnt*3]==5) {
-        dfloat xe1 = VX[v1-1], xe2 = VX[v2-1];
-        dfloat ye1 = VY[v1-1], ye2 = VY[v2-1];
-
-        dfloat theta1 = atan2(ye1-0.0,xe1-0.0); 
-        dfloat theta2 = atan2(ye2-0.0,xe2-0.0);
-
-        VX[v1-1] = 0.0 + 1.0*cos(theta1); VY[v1-1] = 0.0 + 1.0*sin(theta1);
-        VX[v2-1] = 0.0 + 1.0*cos(theta2); VY[v2-1] = 0.0 + 1.0*sin(theta2);
-      }  
-      ++bcnt;
-    }
-    if(ElementType==2){  // triangle
-      if(start<=Ntriangles && Ntriangles<=end){
-        sscanf(buf, "%*d%*d%*d " hlongFormat " %*d" hlongFormat hlongFormat hlongFormat,
-               elementInfo.ptr()+cnt, &v1, &v2, &v3);
-
-        // check orientation
-        dfloat xe1 = VX[v1-1], xe2 = VX[v2-1], xe3 = VX[v3-1];
-        dfloat ye1 = VY[v1-1], ye2 = VY[v2-1], ye3 = VY[v3-1];
-        dfloat J = 0.25*((xe2-xe1)*(ye3-ye1) - (xe3-xe1)*(ye2-ye1));
-        if(J<0){
-          hlong v3tmp = v3;
-          v3 = v2;
-          v2 = v3tmp;
-          //      printf("unwarping element\n");
-        }
-
-        /* read vertex triplet for trianngle */
-        EToV[cnt*Nverts+0] = v1-1;
-        EToV[cnt*Nverts+1] = v2-1;
-        EToV[cnt*Nverts+2] = v3-1;
-
-        ++cnt;
-      }
-      ++Ntriangles;
+  /* read this rank's triangles (code 2) and all boundary lines (code 1) */
+  ReadGmshDistributed(fileName, 2, 1);
+
+  /* vertices on boundary faces with tag 5 are snapped to the unit circle */
+  std::vector<hlong> circleVertices;
+  for(hlong b=0;b<NboundaryFaces;++b){
+    if(boundaryInfo[b*3]==5) {
+      circleVertices.push_back(boundaryInfo[b*3+1]);
+      circleVertices.push_back(boundaryInfo[b*3+2]);
     }
   }
-  fclose(fp);
-
-  /* record number of boundary faces found */
-  NboundaryFaces = bcnt;
+  std::sort(circleVertices.begin(), circleVertices.end());
 
-  /* record number of found triangles */
-  Nelements = (dlong) NtrianglesLocal;
-
-  /* collect vertices for each element */
-  EX.malloc(Nverts*Nelements);
-  EY.malloc(Nverts*Nelements);
   for(dlong e=0;e<Nelements;++e){
     for(int n=0;n<Nverts;++n){
-      EX[e*Nverts+n] = VX[EToV[e*Nverts+n]];
-      EY[e*Nverts+n] = VY[EToV[e*Nverts+n]];
-      //printf("EX=%.15lf e=%d",EX[e*Nverts+n],e);
-      //printf("EY=%.15lf e=%d\n",EY[e*Nverts+n],e);
+      const dlong id = e*Nverts+n;
+      if(std::binary_search(circleVertices.begin(), circleVertices.end(), EToV[id])){
+        dfloat theta = atan2(EY[id]-0.0,EX[id]-0.0);
+        EX[id] = 0.0 + 1.0*cos(theta);
+        EY[id] = 0.0 + 1.0*sin(theta);
+      }
     }
   }
 
-  /*
-   for(int n=0;n<Nnodes;++n){
-    printf("VX=%.15lf i=%d ",VX[n],n);
-    printf("VY=%.15lf i=%d\n",VY[n],n);
+  /* check orientation */
+  for(dlong e=0;e<Nelements;++e){
+    dfloat xe1 = EX[e*Nverts+0], xe2 = EX[e*Nverts+1], xe3 = EX[e*Nverts+2];
+    dfloat ye1 = EY[e*Nverts+0], ye2 = EY[e*Nverts+1], ye3 = EY[e*Nverts+2];
+    dfloat J = 0.25*((xe2-xe1)*(ye3-ye1) - (xe3-xe1)*(ye2-ye1));
+    if(J<0){
+      std::swap(EToV[e*Nverts+1], EToV[e*Nverts+2]);
+      std::swap(EX[e*Nverts+1], EX[e*Nverts+2]);
+      std::swap(EY[e*Nverts+1], EY[e*Nverts+2]);
+    }
   }
-  */
-
 }
 
 } //namespace libp
@@ -0,0 +1,215 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "mesh.hpp"
+#include <algorithm>
+
+namespace libp {
+
+bool mesh_t::Rebalance(memory<dfloat>& cost, const dfloat tolerance,
+                       const dfloat margin){
+
+  std::string fileName;
+  settings.getSetting("MESH FILE", fileName);
+  const bool partitioned = fileName.size()>5
+                           && fileName.compare(fileName.size()-5, 5, ".pmsh")==0;
+
+  //a loaded .pmsh mesh carries no boundary face list to reconnect with
+  LIBP_ABORT("Rebalancing is not supported for meshes loaded from a partitioned mesh file",
+             partitioned);
+
+  if (settings.compareSetting("PARADOGS PARTITIONING", "NONE")) return false;
+
+  //measure the rank imbalance
+  dfloat localCost=0.0;
+  for(dlong e=0;e<Nelements;++e) localCost += cost[e];
+
+  dfloat totalCost = localCost;
+  dfloat maxCost   = localCost;
+  comm.Allreduce(totalCost);
+  comm.Allreduce(maxCost, Comm::Max);
+
+  const dfloat avgCost = totalCost/size;
+  const dfloat imbalance = (avgCost>0.0) ? maxCost/avgCost : 1.0;
+
+  if (imbalance<=tolerance) return false;
+
+  //element offsets before repartitioning
+  memory<hlong> oldStarts(size+1);
+  oldStarts[0]=0;
+  hlong localNelements = Nelements;
+  comm.Allgather(localNelements, oldStarts+1);
+  for(int rr=0;rr<size;++rr) oldStarts[rr+1] += oldStarts[rr];
+
+  //keep the current partition, in case the new one is not worth moving to
+  const dlong oldNelements = Nelements;
+  memory<hlong>  oldEToV = EToV;
+  memory<hlong>  oldEToE = EToE;
+  memory<int>    oldEToF = EToF;
+  memory<dfloat> oldEX = EX;
+  memory<dfloat> oldEY = EY;
+  memory<dfloat> oldEZ = EZ;
+  memory<hlong>  oldElementInfo = elementInfo;
+
+  //repartition, balancing the cost
+  memory<dfloat> weights(Nelements);
+  weights.copyFrom(cost, Nelements);
+
+  memory<hlong> elementIds;
+  Partition(1, weights, elementIds);
+
+  //the partitioner carries the cost with each element, which predicts
+  // the imbalance after migration
+  dfloat newCost=0.0;
+  for(dlong e=0;e<Nelements;++e) newCost += weights[e];
+  comm.Allreduce(newCost, Comm::Max);
+  const dfloat newImbalance = (avgCost>0.0) ? newCost/avgCost : 1.0;
+
+  if (rank==0)
+    printf("Rebalancing mesh, cost imbalance (max/avg) = %5.3f, predicted = %5.3f\n",
+           imbalance, newImbalance);
+
+  //hysteresis: moving elements costs a full rebuild of the mesh and
+  // solver, so only migrate when it buys a clear improvement
+  if (imbalance-newImbalance<margin) {
+    Nelements = oldNelements;
+    EToV = oldEToV;
+    EToE = oldEToE;
+    EToF = oldEToF;
+    EX = oldEX;
+    EY = oldEY;
+    EZ = oldEZ;
+    elementInfo = oldElementInfo;
+
+    if (rank==0)
+      printf("Rebalancing skipped, improvement below margin %5.3f\n", margin);
+    return false;
+  }
+
+  //request each new element from its old owner
+  migrateRecvCounts.malloc(size);
+  migrateRecvOffsets.malloc(size+1);
+  migrateSendCounts.malloc(size);
+  migrateSendOffsets.malloc(size+1);
+
+  memory<int> owner(Nelements);
+  for(int rr=0;rr<size;++rr) migrateRecvCounts[rr]=0;
+  for(dlong e=0;e<Nelements;++e){
+    owner[e] = static_cast<int>(std::upper_bound(oldStarts.ptr(),
+                                                 oldStarts.ptr()+size+1,
+                                                 elementIds[e]) - oldStarts.ptr()) - 1;
+    migrateRecvCounts[owner[e]]++;
+  }
+
+  comm.Alltoall(migrateRecvCounts, migrateSendCounts);
+
+  migrateRecvOffsets[0]=0;
+  migrateSendOffsets[0]=0;
+  for(int rr=0;rr<size;++rr){
+    migrateRecvOffsets[rr+1] = migrateRecvOffsets[rr]+migrateRecvCounts[rr];
+    migrateSendOffsets[rr+1] = migrateSendOffsets[rr]+migrateSendCounts[rr];
+  }
+
+  memory<hlong> recvGlobalIds(Nelements);
+  migrateRecvIds.malloc(Nelements);
+  for(int rr=0;rr<size;++rr) migrateRecvCounts[rr]=0;
+  for(dlong e=0;e<Nelements;++e){
+    const int rr = owner[e];
+    const dlong id = migrateRecvOffsets[rr] + migrateRecvCounts[rr]++;
+    recvGlobalIds[id] = elementIds[e];
+    migrateRecvIds[id] = e;
+  }
+
+  const dlong NmigrateSend = migrateSendOffsets[size];
+  memory<hlong> sendGlobalIds(NmigrateSend);
+  comm.Alltoallv(recvGlobalIds, migrateRecvCounts, migrateRecvOffsets,
+                 sendGlobalIds, migrateSendCounts, migrateSendOffsets);
+
+  migrateSendIds.malloc(NmigrateSend);
+  for(dlong n=0;n<NmigrateSend;++n){
+    migrateSendIds[n] = static_cast<dlong>(sendGlobalIds[n]-oldStarts[rank]);
+  }
+
+  //report how much of the mesh moved
+  hlong Nmoved = Nelements - migrateRecvCounts[rank];
+  comm.Allreduce(Nmoved);
+  if (rank==0)
+    printf("Rebalancing migrated %lld of %lld elements\n",
+           static_cast<long long int>(Nmoved),
+           static_cast<long long int>(oldStarts[size]));
+
+  //rebuild the mesh on the new partition
+  Connect();
+  ConnectBoundary();
+  HaloSetup();
+  ConnectFaceVertices();
+  ConnectFaceNodes();
+  ConnectNodes();
+  PhysicalNodes();
+  GeometricFactors();
+  SurfaceGeometricFactors();
+  GatherScatterSetup();
+
+  return true;
+}
+
+void mesh_t::Migrate(memory<dfloat>& data, const int Nentries){
+
+  memory<int> sendCounts(size), sendOffsets(size);
+  memory<int> recvCounts(size), recvOffsets(size);
+  for(int rr=0;rr<size;++rr){
+    sendCounts[rr]  = migrateSendCounts[rr]*Nentries;
+    sendOffsets[rr] = migrateSendOffsets[rr]*Nentries;
+    recvCounts[rr]  = migrateRecvCounts[rr]*Nentries;
+    recvOffsets[rr] = migrateRecvOffsets[rr]*Nentries;
+  }
+
+  const dlong NmigrateSend = migrateSendOffsets[size];
+  const dlong NmigrateRecv = migrateRecvOffsets[size];
+
+  memory<dfloat> sendBuffer(NmigrateSend*Nentries);
+  for(dlong n=0;n<NmigrateSend;++n){
+    const dlong e = migrateSendIds[n];
+    for(int i=0;i<Nentries;++i){
+      sendBuffer[n*Nentries+i] = data[e*Nentries+i];
+    }
+  }
+
+  memory<dfloat> recvBuffer(NmigrateRecv*Nentries);
+  comm.Alltoallv(sendBuffer, sendCounts, sendOffsets,
+                 recvBuffer, recvCounts, recvOffsets);
+
+  data.malloc(NmigrateRecv*Nentries);
+  for(dlong n=0;n<NmigrateRecv;++n){
+    const dlong e = migrateRecvIds[n];
+    for(int i=0;i<Nentries;++i){
+      data[e*Nentries+i] = recvBuffer[n*Nentries+i];
+    }
+  }
+}
+
+} //namespace libp
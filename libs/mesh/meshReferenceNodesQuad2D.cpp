@@ -50,6 +50,45 @@ void mesh_t::ReferenceNodesQuad2D(){
   Dmatrix1D(N, gllz, gllz, D);
   o_D = platform.malloc<dfloat>(D);
 
+  /* 1D modal data on each face, for the artificial viscosity sensor.
+     Face nodes are GLL nodes on every face, so the faces share them */
+  memory<dfloat> V1D, MM1D;
+  Vandermonde1D(N, gllz, V1D);
+  MassMatrix1D(Nfp, V1D, MM1D);
+  linAlg_t::matrixInverse(Nfp, V1D);
+
+  invV1DsT.malloc(Nfaces*Nfp*Nfp);
+  MM1DsT.malloc(Nfaces*Nfp*Nfp);
+  for (int f=0;f<Nfaces;f++) {
+    memory<dfloat> invV1DfT = invV1DsT + f*Nfp*Nfp;
+    memory<dfloat> MM1DfT = MM1DsT + f*Nfp*Nfp;
+    linAlg_t::matrixTranspose(Nfp, Nfp, V1D, Nfp, invV1DfT, Nfp);
+    linAlg_t::matrixTranspose(Nfp, Nfp, MM1D, Nfp, MM1DfT, Nfp);
+  }
+  o_invV1Ds = platform.malloc<dfloat>(invV1DsT);
+  o_MM1Ds = platform.malloc<dfloat>(MM1DsT);
+
+  perfectDecayTri2D(N, perfectDecay2); //1D model, same as triangles
+  o_perfectDecay2 = platform.malloc<dfloat>(perfectDecay2);
+
+  /* Interpolation of the degree 2 viscosity reconstruction,
+     node (a,b) of a 3x3 GLL grid, to the element nodes */
+  memory<dfloat> r2, w2, muInterp1D;
+  JacobiGLL(2, r2, w2);
+  InterpolationMatrix1D(2, r2, gllz, muInterp1D);
+
+  memory<dfloat> muInterpT(9*Np);
+  for (int j=0;j<Nq;j++) {
+    for (int i=0;i<Nq;i++) {
+      for (int b=0;b<3;b++) {
+        for (int a=0;a<3;a++) {
+          muInterpT[(a+3*b)*Np + i+j*Nq] = muInterp1D[i*3+a]*muInterp1D[j*3+b];
+        }
+      }
+    }
+  }
+  o_muInterp = platform.malloc<dfloat>(muInterpT);
+
   /* Plotting data */
   plotN = N + 3; //enriched interpolation space for plotting
   plotNq = plotN + 1;
@@ -48,6 +48,10 @@ meshSettings_t::meshSettings_t(comm_t _comm):
              "Type mapping used to transform each element",
              {"ISOPARAMETRIC","AFFINE"});
 
+  newSetting("PARTITIONED MESH OUTPUT",
+             "NONE",
+             "Save the partitioned and connected mesh to this .pmsh file set after setup. Set MESH FILE to a .pmsh file to load it");
+
   newSetting("BOX DIMX",
              "10",
              "Length of BOX domain in X-dimension");
@@ -87,6 +91,25 @@ meshSettings_t::meshSettings_t(comm_t _comm):
              "Degree of polynomial finite element space",
              {"1","2","3","4","5","6","7","8","9","10","11","12","13","14","15"});
 
+  newSetting("OUTPUT FILE FORMAT",
+             "BINARY",
+             "Encoding of VTU field output files",
+             {"ASCII", "BINARY", "BASE64"});
+
+  newSetting("OUTPUT COMPRESSION",
+             "NONE",
+             "Compression of binary VTU field output (ZLIB requires building with zlib=true)",
+             {"NONE", "ZLIB"});
+
+  newSetting("OUTPUT QUEUE DEPTH",
+             "2",
+             "Number of output frames that may be queued for background writing (0 writes synchronously)");
+
+  newSetting("PARTITION CONSTRAINTS",
+             "ELEMENTS",
+             "Quantities balanced by mesh partitioning (PML balances interior and PML elements separately)",
+             {"ELEMENTS", "PML"});
+
   paradogs::AddSettings(*this);
 }
 
@@ -97,6 +120,9 @@ void meshSettings_t::report() {
     if (!compareSetting("MESH FILE","BOX"))
       reportSetting("MESH FILE");
 
+    if (!compareSetting("PARTITIONED MESH OUTPUT","NONE"))
+      reportSetting("PARTITIONED MESH OUTPUT");
+
     reportSetting("MESH DIMENSION");
     reportSetting("ELEMENT TYPE");
 
@@ -129,8 +155,13 @@ void meshSettings_t::report() {
     }
 
     reportSetting("POLYNOMIAL DEGREE");
+    reportSetting("OUTPUT FILE FORMAT");
+    if (!compareSetting("OUTPUT FILE FORMAT","ASCII"))
+      reportSetting("OUTPUT COMPRESSION");
+    reportSetting("OUTPUT QUEUE DEPTH");
 
     if (!compareSetting("MESH FILE","BOX")) {
+      reportSetting("PARTITION CONSTRAINTS");
       paradogs::ReportSettings(*this);
     }
   }
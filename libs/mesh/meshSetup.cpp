@@ -52,13 +52,17 @@ void mesh_t::Setup(platform_t& _platform, meshSettings_t& _settings,
   std::string fileName;
   settings.getSetting("MESH FILE", fileName);
 
+  // a .pmsh file set already holds the partitioned and connected mesh
+  const bool partitioned = fileName.size()>5
+                           && fileName.compare(fileName.size()-5, 5, ".pmsh")==0;
+
   if (settings.compareSetting("MESH FILE","PMLBOX")) {
     //build a box mesh with a pml layer
     SetupPmlBox();
   } else if (settings.compareSetting("MESH FILE","BOX")) {
     //build a box mesh
     SetupBox();
-  } else {
+  } else if (!partitioned) {
     // read chunk of elements from file
     ReadGmsh(fileName);
 
@@ -70,14 +74,19 @@ void mesh_t::Setup(platform_t& _platform, meshSettings_t& _settings,
   settings.getSetting("POLYNOMIAL DEGREE", N);
   ReferenceNodes();
 
-  // connect elements
-  Connect();
+  if (partitioned) {
+    // map in elements, connectivity, and halo info
+    LoadPartitioned(fileName);
+  } else {
+    // connect elements
+    Connect();
 
-  // connect elements to boundary faces
-  ConnectBoundary();
+    // connect elements to boundary faces
+    ConnectBoundary();
 
-  // set up halo exchange info for MPI (do before connect face nodes)
-  HaloSetup();
+    // set up halo exchange info for MPI (do before connect face nodes)
+    HaloSetup();
+  }
 
   // connect face vertices
   ConnectFaceVertices();
@@ -86,8 +95,9 @@ void mesh_t::Setup(platform_t& _platform, meshSettings_t& _settings,
   // connect face nodes
   ConnectFaceNodes();
 
-  // make global indexing
-  ConnectNodes();
+  // make global indexing (unless loaded with a partitioned mesh)
+  if (!globalIds.length())
+    ConnectNodes();
 
   // compute physical (x,y) locations of the element nodes
   PhysicalNodes();
@@ -102,6 +112,11 @@ void mesh_t::Setup(platform_t& _platform, meshSettings_t& _settings,
   // label local/global gather elements
   GatherScatterSetup();
 
+  std::string outputName;
+  settings.getSetting("PARTITIONED MESH OUTPUT", outputName);
+  if (outputName!="NONE")
+    SavePartitioned(outputName);
+
 }
 
 } //namespace libp
@@ -41,7 +41,7 @@ mesh_t mesh_t::SetupRingPatch(){
   mesh.globalSize=size;
   //just reuse the current mesh if there are no neighbors
   if (size==1) {
-      mesh.SetupVToETri2D();
+      mesh.SetupVToE();
      return mesh;
   }
 
@@ -124,7 +124,7 @@ mesh_t mesh_t::SetupRingPatch(){
   // label local/global gather elements
   mesh.GatherScatterSetup();
 
-  mesh.SetupVToETri2D();
+  mesh.SetupVToE();
   return mesh;
 }
 
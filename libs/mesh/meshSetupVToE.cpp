@@ -0,0 +1,81 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "mesh.hpp"
+
+namespace libp {
+
+/*For each local element vertex, list the elements sharing that vertex.
+  EToN[(e*Nverts+v)*maxVToE + i], i<Vcounts[e*Nverts+v]. Ring elements
+  are included as neighbors, but only get listed for the local elements*/
+void mesh_t::SetupVToE(){
+
+    const dlong NlocalElements = Nelements-totalRingElements;
+
+    Vcounts.malloc(Nverts*NlocalElements);
+    EToN.malloc(maxVToE*Nverts*NlocalElements);
+
+    hlong Nvertices = 0;
+    for(dlong n=0;n<Nelements*Nverts;++n)
+      Nvertices = std::max(Nvertices, EToV[n]+1);
+
+    VToE.malloc(Nvertices*maxVToE);
+    counts.calloc(Nvertices);
+
+    for(dlong e=0;e<Nelements;++e) {
+        dlong id = e*Nverts;
+        for(int i=0;i<Nverts;++i) {
+            hlong v=EToV[id + i];
+
+            LIBP_ABORT("Vertex " << v << " is shared by more than "
+                       << maxVToE << " elements",
+                       counts[v]==maxVToE);
+
+            VToE[v*maxVToE+counts[v]]=e;
+            counts[v]++;
+        }
+    }
+
+    #pragma omp parallel for
+    for(dlong e=0;e<NlocalElements;++e) {
+        dlong id = e*Nverts;
+
+        for(int i=0;i<Nverts;++i) {
+            hlong v=EToV[id + i];
+            Vcounts[e*Nverts+i]=counts[v];
+            for(int j=0;j<counts[v];++j) {
+                EToN[(e*Nverts+i)*maxVToE+j]=VToE[v*maxVToE+j];
+            }
+        }
+    }
+    VToE.free();
+    counts.free();
+
+    o_EToN=platform.malloc<dlong>(EToN);
+    o_Vcounts=platform.malloc<dlong>(Vcounts);
+}
+
+} //namespace libp
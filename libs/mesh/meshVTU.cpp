@@ -0,0 +1,691 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "mesh.hpp"
+#include "mesh/meshVTU.hpp"
+#include <cstdint>
+#include <limits>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#ifdef LIBP_ZLIB
+#include <zlib.h>
+#endif
+
+namespace libp {
+
+namespace {
+
+template<typename T> const char* vtkType();
+template<> const char* vtkType<float>()         { return "Float32"; }
+template<> const char* vtkType<double>()        { return "Float64"; }
+template<> const char* vtkType<int>()           { return "Int32"; }
+template<> const char* vtkType<long long int>() { return "Int64"; }
+template<> const char* vtkType<unsigned char>() { return "UInt8"; }
+
+std::string Base64(const unsigned char* data, const size_t Nbytes) {
+  static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+  std::string out;
+  out.reserve(4*((Nbytes+2)/3));
+
+  size_t i=0;
+  for (;i+2<Nbytes;i+=3) {
+    const uint32_t w = (data[i]<<16) | (data[i+1]<<8) | data[i+2];
+    out.push_back(table[(w>>18)&0x3F]);
+    out.push_back(table[(w>>12)&0x3F]);
+    out.push_back(table[(w>> 6)&0x3F]);
+    out.push_back(table[(w    )&0x3F]);
+  }
+  if (i+1==Nbytes) {
+    const uint32_t w = (data[i]<<16);
+    out.push_back(table[(w>>18)&0x3F]);
+    out.push_back(table[(w>>12)&0x3F]);
+    out.append("==");
+  } else if (i+2==Nbytes) {
+    const uint32_t w = (data[i]<<16) | (data[i+1]<<8);
+    out.push_back(table[(w>>18)&0x3F]);
+    out.push_back(table[(w>>12)&0x3F]);
+    out.push_back(table[(w>> 6)&0x3F]);
+    out.push_back('=');
+  }
+  return out;
+}
+
+std::string BaseName(const std::string fileName) {
+  const size_t pos = fileName.find_last_of('/');
+  return (pos==std::string::npos) ? fileName : fileName.substr(pos+1);
+}
+
+//zlib block size used for compressed arrays
+constexpr size_t vtuBlockSize = 1<<15;
+
+} //namespace
+
+/*Bounded queue of output frames drained by a single worker thread. The
+  worker owns a synchronous copy of the writer, so the plot geometry and
+  the .pvd time series are only ever touched from one thread. OCCA devices
+  are not thread-safe, so every call which queues device work (staging
+  allocations, copies, and stream tags) stays on the producing thread. The
+  worker only waits on the tag marking the end of a frame's copies.*/
+class vtuWriter_t::outputQueue_t {
+ public:
+  struct frame_t {
+    std::string name;
+    int frame;
+    dfloat time;
+    std::vector<field_t> fields;
+
+    //pinned buffers the device fields are copied to, their host copies,
+    // and the stream tag marking the end of the device to host copies
+    std::vector<pinnedMemory<dfloat>> staging;
+    std::vector<memory<dfloat>> snapshots;
+    occa::streamTag ready;
+  };
+
+  outputQueue_t(const vtuWriter_t& _writer, const int _depth):
+    writer(_writer),
+    platform(_writer.mesh.platform),
+    depth(_depth) {
+    worker = std::thread(&outputQueue_t::Run, this);
+  }
+
+  ~outputQueue_t() {
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      done = true;
+    }
+    cv.notify_all();
+    worker.join();
+
+    //a write which failed after the last Flush can no longer be returned
+    // to the caller, so it ends the run rather than losing the output
+    if (error) {
+      try {
+        std::rethrow_exception(error);
+      } catch (exception& e) {
+        LIBP_FORCE_ABORT("Background output failed: " << e.message);
+      } catch (std::exception& e) {
+        LIBP_FORCE_ABORT("Background output failed: " << e.what());
+      }
+    }
+  }
+
+  /*Block until there is room for another frame*/
+  void Reserve() {
+    std::unique_lock<std::mutex> lock(mtx);
+    cv.wait(lock, [&]{ return error || frames.size() < static_cast<size_t>(depth); });
+    Check();
+  }
+
+  void Push(frame_t&& f) {
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      frames.push_back(std::move(f));
+    }
+    cv.notify_all();
+  }
+
+  void Flush() {
+    std::unique_lock<std::mutex> lock(mtx);
+    cv.wait(lock, [&]{ return error || (frames.empty() && !busy); });
+    Check();
+  }
+
+  /*Time series written by the worker. Only valid after Flush*/
+  const std::vector<std::pair<dfloat, std::string>>& Series() const {
+    return writer.series;
+  }
+
+  /*Get a pinned staging buffer of at least N entries. Only called from
+    the producing thread, since pinned allocations go through the device*/
+  pinnedMemory<dfloat> Staging(const size_t N) {
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      for (auto it=pool.begin();it!=pool.end();++it) {
+        if (it->length()>=N) {
+          pinnedMemory<dfloat> buf = *it;
+          pool.erase(it);
+          return buf;
+        }
+      }
+    }
+    return platform.hostMalloc<dfloat>(N);
+  }
+
+ private:
+  vtuWriter_t writer;
+  platform_t platform;
+  int depth;
+
+  std::thread worker;
+  std::mutex mtx;
+  std::condition_variable cv;
+
+  std::deque<frame_t> frames;
+  std::vector<pinnedMemory<dfloat>> pool;
+
+  bool busy=false;
+  bool done=false;
+  std::exception_ptr error;
+
+  //rethrow a failure from the worker on the producing thread (lock held)
+  void Check() {
+    if (error) {
+      std::exception_ptr e = error;
+      error = nullptr;
+      std::rethrow_exception(e);
+    }
+  }
+
+  void Run() {
+    while (true) {
+      frame_t f;
+      {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [&]{ return done || !frames.empty(); });
+        if (frames.empty()) return;
+
+        f = std::move(frames.front());
+        frames.pop_front();
+        busy = true;
+      }
+      cv.notify_all();
+
+      try {
+        if (f.staging.size()) {
+          //wait for the copies to land here, so the producer never blocks
+          f.ready.wait();
+          for (size_t n=0;n<f.staging.size();++n) {
+            f.snapshots[n].copyFrom(f.staging[n].ptr(), f.snapshots[n].length());
+          }
+
+          std::unique_lock<std::mutex> lock(mtx);
+          for (auto& buf: f.staging) pool.push_back(buf);
+        }
+
+        writer.fields = f.fields;
+        writer.WriteFrame(f.name, f.frame, f.time);
+        writer.ClearFields();
+      } catch (...) {
+        std::unique_lock<std::mutex> lock(mtx);
+        error = std::current_exception();
+      }
+
+      {
+        std::unique_lock<std::mutex> lock(mtx);
+        busy = false;
+      }
+      cv.notify_all();
+    }
+  }
+};
+
+void vtuWriter_t::Setup(mesh_t& _mesh) {
+  mesh = _mesh;
+
+  if (mesh.settings.compareSetting("OUTPUT FILE FORMAT", "ASCII")) {
+    format = ASCII;
+  } else if (mesh.settings.compareSetting("OUTPUT FILE FORMAT", "BASE64")) {
+    format = BASE64;
+  } else {
+    format = BINARY;
+  }
+
+  compress = mesh.settings.compareSetting("OUTPUT COMPRESSION", "ZLIB");
+#ifndef LIBP_ZLIB
+  LIBP_WARNING("VTU output compression requested but libParanumal was built without zlib. Writing uncompressed data.",
+               compress && mesh.rank==0);
+  compress = false;
+#endif
+  if (format==ASCII) compress=false;
+
+  //drop any previous background writer (this flushes it) and its series
+  queue = nullptr;
+  series.clear();
+
+  Remesh(_mesh);
+}
+
+void vtuWriter_t::Remesh(mesh_t& _mesh) {
+
+  //finish the frames on the old partition. The worker's copy of the
+  // writer holds the time series, so take it back before replacing it
+  if (queue) {
+    queue->Flush();
+    series = queue->Series();
+    queue = nullptr;
+  }
+
+  mesh = _mesh;
+
+  fields.clear();
+  deviceFields.clear();
+
+  //plot geometry is built on the first Write
+  xmlPoints.clear(); xmlCells.clear();
+  binPoints.clear(); binCells.clear();
+
+  //start the background writer
+  int depth=0;
+  mesh.settings.getSetting("OUTPUT QUEUE DEPTH", depth);
+  if (depth>0) {
+    queue = std::make_shared<outputQueue_t>(*this, depth);
+  }
+}
+
+void vtuWriter_t::AddField(const std::string name,
+                           const memory<dfloat> Q,
+                           const int Nfields,
+                           const int field,
+                           const int Ncomponents) {
+  fields.push_back({name, Q, Nfields, field, Ncomponents});
+}
+
+void vtuWriter_t::AddField(const std::string name,
+                           const deviceMemory<dfloat> o_Q,
+                           const int Nfields,
+                           const int field,
+                           const int Ncomponents) {
+  deviceFields.push_back({name, o_Q, Nfields, field, Ncomponents});
+}
+
+void vtuWriter_t::ClearFields() {
+  fields.clear();
+  deviceFields.clear();
+}
+
+void vtuWriter_t::Write(const std::string name, const int frame, const dfloat time) {
+
+  if (!queue) {
+    //synchronous output, bring device fields back to the host
+    for (auto& f: deviceFields) {
+      memory<dfloat> Q(f.o_Q.length());
+      f.o_Q.copyTo(Q);
+      fields.push_back({f.name, Q, f.Nfields, f.field, f.Ncomponents});
+    }
+    WriteFrame(name, frame, time);
+    ClearFields();
+    return;
+  }
+
+  //wait if the writer has fallen too far behind
+  queue->Reserve();
+
+  outputQueue_t::frame_t out;
+  out.name  = name;
+  out.frame = frame;
+  out.time  = time;
+
+  //the caller is free to overwrite host fields once we return
+  for (auto& f: fields) {
+    memory<dfloat> Q(f.Q.length());
+    Q.copyFrom(f.Q);
+    out.fields.push_back({f.name, Q, f.Nfields, f.field, f.Ncomponents});
+  }
+
+  if (deviceFields.size()) {
+    device_t &device = mesh.platform.device;
+
+    //copy the fields to pinned buffers on the compute stream. Stream order
+    // keeps kernels queued after we return from overwriting them before
+    // they are copied, and the host does not wait for the copies. Fields
+    // sharing a device array share one copy.
+    std::vector<deviceMemory<dfloat>> staged;
+    for (auto& f: deviceFields) {
+      size_t s=0;
+      for (;s<staged.size();++s) {
+        if (staged[s]==f.o_Q) break;
+      }
+      if (s==staged.size()) {
+        const size_t N = f.o_Q.length();
+        pinnedMemory<dfloat> buf = queue->Staging(N);
+        buf.copyFrom(f.o_Q, N, 0, properties_t("async", true));
+
+        staged.push_back(f.o_Q);
+        out.staging.push_back(buf);
+        out.snapshots.push_back(memory<dfloat>(N));
+      }
+      out.fields.push_back({f.name, out.snapshots[s], f.Nfields, f.field, f.Ncomponents});
+    }
+    out.ready = device.tagStream();
+  }
+
+  queue->Push(std::move(out));
+
+  ClearFields();
+}
+
+void vtuWriter_t::Flush() {
+  if (queue) queue->Flush();
+}
+
+void vtuWriter_t::WriteFrame(const std::string name, const int frame, const dfloat time) {
+
+  if (xmlPoints.empty()) SetupGeometry();
+
+  char fname[BUFSIZ];
+  sprintf(fname, "%s_%04d_%04d.vtu", name.c_str(), mesh.rank, frame);
+  WritePiece(std::string(fname));
+
+  if (mesh.rank==0) {
+    sprintf(fname, "%s_%04d.pvtu", name.c_str(), frame);
+    WritePvtu(std::string(fname), name, frame);
+
+    if (series.empty() && frame>0) ReadPvd(name + ".pvd", frame);
+
+    series.push_back({time, BaseName(std::string(fname))});
+    WritePvd(name + ".pvd");
+  }
+}
+
+/*Encode one binary data array. Uncompressed arrays carry a single UInt64
+  byte count header, compressed arrays carry the VTK block header
+  [#blocks][block size][last block size][compressed sizes...]*/
+std::string vtuWriter_t::EncodeBlock(const char* data, const size_t Nbytes) {
+
+  std::string header, payload;
+
+  if (!compress) {
+    const uint64_t size = Nbytes;
+    header.assign(reinterpret_cast<const char*>(&size), sizeof(uint64_t));
+    payload.assign(data, Nbytes);
+  } else {
+#ifdef LIBP_ZLIB
+    const uint64_t Nblocks = (Nbytes + vtuBlockSize - 1)/vtuBlockSize;
+    const uint64_t lastSize = Nbytes%vtuBlockSize;
+
+    memory<uint64_t> head(3+Nblocks);
+    head[0] = Nblocks;
+    head[1] = vtuBlockSize;
+    head[2] = lastSize;
+
+    //compress blocks independently
+    std::vector<std::string> blocks(Nblocks);
+    #pragma omp parallel for
+    for (uint64_t b=0;b<Nblocks;++b) {
+      const size_t size = (b==Nblocks-1 && lastSize) ? lastSize : vtuBlockSize;
+      uLongf csize = compressBound(size);
+      blocks[b].resize(csize);
+      compress2(reinterpret_cast<Bytef*>(&blocks[b][0]), &csize,
+                reinterpret_cast<const Bytef*>(data + b*vtuBlockSize), size,
+                Z_BEST_SPEED);
+      blocks[b].resize(csize);
+      head[3+b] = csize;
+    }
+
+    header.assign(reinterpret_cast<const char*>(head.ptr()), (3+Nblocks)*sizeof(uint64_t));
+    for (auto& block: blocks) payload.append(block);
+#endif
+  }
+
+  if (format==BASE64) {
+    //header and data are encoded separately
+    return Base64(reinterpret_cast<const unsigned char*>(header.data()), header.size())
+         + Base64(reinterpret_cast<const unsigned char*>(payload.data()), payload.size());
+  } else {
+    return header + payload;
+  }
+}
+
+template<typename T>
+void vtuWriter_t::AddDataArray(const std::string name,
+                               const int Ncomponents,
+                               const memory<T> data,
+                               std::string& xml,
+                               std::string& bin,
+                               const size_t offset) {
+
+  std::stringstream ss;
+  ss << "        <DataArray type=\"" << vtkType<T>() << "\"";
+  if (name.size()) ss << " Name=\"" << name << "\"";
+  if (Ncomponents>1) ss << " NumberOfComponents=\"" << Ncomponents << "\"";
+
+  if (format==ASCII) {
+    ss << " format=\"ascii\">\n";
+    ss.precision(std::numeric_limits<T>::max_digits10);
+    for (size_t n=0;n<data.length();n+=Ncomponents) {
+      ss << "         ";
+      for (int c=0;c<Ncomponents;++c) {
+        if (sizeof(T)==1) ss << static_cast<int>(data[n+c]) << " ";
+        else              ss << data[n+c] << " ";
+      }
+      ss << "\n";
+    }
+    ss << "        </DataArray>\n";
+  } else {
+    ss << " format=\"appended\" offset=\"" << offset + bin.size() << "\"/>\n";
+    bin.append(EncodeBlock(reinterpret_cast<const char*>(data.ptr()), data.size()));
+  }
+
+  xml.append(ss.str());
+}
+
+void vtuWriter_t::SetupGeometry() {
+
+  const dlong Npoints = mesh.Nelements*mesh.plotNp;
+  const dlong Ncells  = mesh.Nelements*mesh.plotNelements;
+
+  //plot node coordinates
+  memory<dfloat> xyz(3*Npoints);
+
+  #pragma omp parallel
+  {
+    //scratch space for interpolation
+    size_t Nscratch = std::max(mesh.Np, mesh.plotNp);
+    memory<dfloat> scratch(2*Nscratch);
+
+    memory<dfloat> Ix(mesh.plotNp);
+    memory<dfloat> Iy(mesh.plotNp);
+    memory<dfloat> Iz(mesh.plotNp, 0.0);
+
+    #pragma omp for
+    for(dlong e=0;e<mesh.Nelements;++e){
+      mesh.PlotInterp(mesh.x + e*mesh.Np, Ix, scratch);
+      mesh.PlotInterp(mesh.y + e*mesh.Np, Iy, scratch);
+      if(mesh.dim==3)
+        mesh.PlotInterp(mesh.z + e*mesh.Np, Iz, scratch);
+
+      for(int n=0;n<mesh.plotNp;++n){
+        const dlong id = e*mesh.plotNp + n;
+        xyz[3*id+0] = Ix[n];
+        xyz[3*id+1] = Iy[n];
+        xyz[3*id+2] = Iz[n];
+      }
+    }
+  }
+
+  //plot cells
+  memory<dlong> connectivity(Ncells*mesh.plotNverts);
+  memory<dlong> offsets(Ncells);
+  memory<unsigned char> types(Ncells, (mesh.dim==2) ? 5 : 10); //VTK_TRIANGLE, VTK_TETRA
+
+  #pragma omp parallel for
+  for(dlong e=0;e<mesh.Nelements;++e){
+    for(int n=0;n<mesh.plotNelements;++n){
+      const dlong cell = e*mesh.plotNelements + n;
+      for(int m=0;m<mesh.plotNverts;++m){
+        connectivity[cell*mesh.plotNverts+m] = e*mesh.plotNp + mesh.plotEToV[n*mesh.plotNverts+m];
+      }
+      offsets[cell] = (cell+1)*mesh.plotNverts;
+    }
+  }
+
+  xmlPoints.clear(); xmlCells.clear();
+  binPoints.clear(); binCells.clear();
+
+  xmlPoints.append("      <Points>\n");
+  AddDataArray(std::string(), 3, xyz, xmlPoints, binPoints, 0);
+  xmlPoints.append("      </Points>\n");
+
+  xmlCells.append("      <Cells>\n");
+  AddDataArray("connectivity", 1, connectivity, xmlCells, binCells, binPoints.size());
+  AddDataArray("offsets",      1, offsets,      xmlCells, binCells, binPoints.size());
+  AddDataArray("types",        1, types,        xmlCells, binCells, binPoints.size());
+  xmlCells.append("      </Cells>\n");
+}
+
+void vtuWriter_t::WritePiece(const std::string fileName) {
+
+  const dlong Npoints = mesh.Nelements*mesh.plotNp;
+  const dlong Ncells  = mesh.Nelements*mesh.plotNelements;
+
+  std::string xmlData, binData;
+  const size_t offset = binPoints.size() + binCells.size();
+
+  xmlData.append("      <PointData>\n");
+  for (auto& f: fields) {
+    memory<dfloat> data(Npoints*f.Ncomponents);
+
+    #pragma omp parallel
+    {
+      //scratch space for interpolation
+      size_t Nscratch = std::max(mesh.Np, mesh.plotNp);
+      memory<dfloat> scratch(2*Nscratch);
+      memory<dfloat> Iq(mesh.plotNp);
+
+      #pragma omp for
+      for(dlong e=0;e<mesh.Nelements;++e){
+        for(int c=0;c<f.Ncomponents;++c){
+          mesh.PlotInterp(f.Q + (f.field+c)*mesh.Np + e*mesh.Np*f.Nfields, Iq, scratch);
+          for(int n=0;n<mesh.plotNp;++n){
+            data[(e*mesh.plotNp+n)*f.Ncomponents + c] = Iq[n];
+          }
+        }
+      }
+    }
+
+    AddDataArray(f.name, f.Ncomponents, data, xmlData, binData, offset);
+  }
+  xmlData.append("      </PointData>\n");
+
+  FILE *fp = fopen(fileName.c_str(), "wb");
+  LIBP_ABORT("Failed to open " << fileName << " for writing.",
+             fp==nullptr);
+
+  const char* encoding = (format==BASE64) ? "base64" : "raw";
+
+  fprintf(fp, "<?xml version=\"1.0\"?>\n");
+  fprintf(fp, "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"LittleEndian\" header_type=\"UInt64\"%s>\n",
+          compress ? " compressor=\"vtkZLibDataCompressor\"" : "");
+  fprintf(fp, "  <UnstructuredGrid>\n");
+  fprintf(fp, "    <Piece NumberOfPoints=\"" dlongFormat "\" NumberOfCells=\"" dlongFormat "\">\n",
+          Npoints, Ncells);
+
+  fwrite(xmlPoints.data(), 1, xmlPoints.size(), fp);
+  fwrite(xmlCells.data(),  1, xmlCells.size(),  fp);
+  fwrite(xmlData.data(),   1, xmlData.size(),   fp);
+
+  fprintf(fp, "    </Piece>\n");
+  fprintf(fp, "  </UnstructuredGrid>\n");
+
+  if (format!=ASCII) {
+    fprintf(fp, "  <AppendedData encoding=\"%s\">\n", encoding);
+    fprintf(fp, "   _");
+    fwrite(binPoints.data(), 1, binPoints.size(), fp);
+    fwrite(binCells.data(),  1, binCells.size(),  fp);
+    fwrite(binData.data(),   1, binData.size(),   fp);
+    fprintf(fp, "\n  </AppendedData>\n");
+  }
+
+  fprintf(fp, "</VTKFile>\n");
+  fclose(fp);
+}
+
+void vtuWriter_t::WritePvtu(const std::string fileName,
+                            const std::string pieceName,
+                            const int frame) {
+
+  const char* realType = vtkType<dfloat>();
+
+  FILE *fp = fopen(fileName.c_str(), "w");
+  LIBP_ABORT("Failed to open " << fileName << " for writing.",
+             fp==nullptr);
+
+  fprintf(fp, "<?xml version=\"1.0\"?>\n");
+  fprintf(fp, "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\" byte_order=\"LittleEndian\" header_type=\"UInt64\">\n");
+  fprintf(fp, "  <PUnstructuredGrid GhostLevel=\"0\">\n");
+  fprintf(fp, "    <PPoints>\n");
+  fprintf(fp, "      <PDataArray type=\"%s\" NumberOfComponents=\"3\"/>\n", realType);
+  fprintf(fp, "    </PPoints>\n");
+  fprintf(fp, "    <PPointData>\n");
+  for (auto& f: fields) {
+    if (f.Ncomponents>1)
+      fprintf(fp, "      <PDataArray type=\"%s\" Name=\"%s\" NumberOfComponents=\"%d\"/>\n",
+              realType, f.name.c_str(), f.Ncomponents);
+    else
+      fprintf(fp, "      <PDataArray type=\"%s\" Name=\"%s\"/>\n",
+              realType, f.name.c_str());
+  }
+  fprintf(fp, "    </PPointData>\n");
+
+  const std::string base = BaseName(pieceName);
+  for (int r=0;r<mesh.size;++r) {
+    fprintf(fp, "    <Piece Source=\"%s_%04d_%04d.vtu\"/>\n", base.c_str(), r, frame);
+  }
+
+  fprintf(fp, "  </PUnstructuredGrid>\n");
+  fprintf(fp, "</VTKFile>\n");
+  fclose(fp);
+}
+
+void vtuWriter_t::WritePvd(const std::string fileName) {
+
+  FILE *fp = fopen(fileName.c_str(), "w");
+  LIBP_ABORT("Failed to open " << fileName << " for writing.",
+             fp==nullptr);
+
+  fprintf(fp, "<?xml version=\"1.0\"?>\n");
+  fprintf(fp, "<VTKFile type=\"Collection\" version=\"1.0\" byte_order=\"LittleEndian\">\n");
+  fprintf(fp, "  <Collection>\n");
+  for (auto& s: series) {
+    fprintf(fp, "    <DataSet timestep=\"%.15g\" part=\"0\" file=\"%s\"/>\n",
+            static_cast<double>(s.first), s.second.c_str());
+  }
+  fprintf(fp, "  </Collection>\n");
+  fprintf(fp, "</VTKFile>\n");
+  fclose(fp);
+}
+
+void vtuWriter_t::ReadPvd(const std::string fileName, const int Nframes) {
+
+  FILE *fp = fopen(fileName.c_str(), "r");
+  if (fp==nullptr) return; //no earlier series to extend
+
+  char line[BUFSIZ], file[BUFSIZ];
+  while (static_cast<int>(series.size())<Nframes
+         && fgets(line, BUFSIZ, fp)) {
+    double time;
+    if (sscanf(line, " <DataSet timestep=\"%lf\" part=\"0\" file=\"%[^\"]\"", &time, file)==2) {
+      series.push_back({static_cast<dfloat>(time), std::string(file)});
+    }
+  }
+  fclose(fp);
+}
+
+} //namespace libp
@@ -61,23 +61,18 @@ void ogs_t::GatherScatterStart(deviceMemory<T> o_v,
     //prepare MPI exchange
     exchange->Start(o_haloBuf, k, op, trans);
   } else {
-    //get current stream
     device_t &device = platform.device;
-    stream_t currentStream = device.getStream();
 
     pinnedMemory<T> haloBuf = exchange->h_workspace;
 
     //if not using gpu-aware mpi move the halo buffer to the host
     const dlong Nhalo = (trans == NoTrans) ? NhaloP : NhaloT;
 
-    //wait for o_haloBuf to be ready
-    device.finish();
-
-    //queue copy to host
-    device.setStream(dataStream);
+    //queue copy to host on the current stream
     haloBuf.copyFrom(o_haloBuf, Nhalo*k,
                      0, properties_t("async", true));
-    device.setStream(currentStream);
+
+    exchange->sendReady = device.tagStream();
   }
 }
 
@@ -98,13 +93,9 @@ void ogs_t::GatherScatterFinish(deviceMemory<T> o_v,
   } else {
     pinnedMemory<T> haloBuf = exchange->h_workspace;
 
-    //get current stream
     device_t &device = platform.device;
-    stream_t currentStream = device.getStream();
 
-    //synchronize data stream to ensure the buffer is on the host
-    device.setStream(dataStream);
-    device.finish();
+    device.waitFor(exchange->sendReady);
 
     /*MPI exchange of host buffer*/
     exchange->Start (haloBuf, k, op, trans);
@@ -114,8 +105,6 @@ void ogs_t::GatherScatterFinish(deviceMemory<T> o_v,
     const dlong Nhalo = (trans == Trans) ? NhaloP : NhaloT;
     haloBuf.copyTo(o_haloBuf, Nhalo*k,
                    0, properties_t("async", true));
-    device.finish(); //wait for transfer to finish
-    device.setStream(currentStream);
   }
 
   //write exchanged halo buffer back to vector
@@ -229,21 +218,16 @@ void ogs_t::GatherStart(deviceMemory<T> o_gv,
       //prepare MPI exchange
       exchange->Start(o_haloBuf, k, op, Trans);
     } else {
-      //get current stream
       device_t &device = platform.device;
-      stream_t currentStream = device.getStream();
 
       //if not using gpu-aware mpi move the halo buffer to the host
       pinnedMemory<T> haloBuf = exchange->h_workspace;
 
-      //wait for o_haloBuf to be ready
-      device.finish();
-
-      //queue copy to host
-      device.setStream(dataStream);
+      //queue copy to host on the current stream
       haloBuf.copyFrom(o_haloBuf, NhaloT*k,
                        0, properties_t("async", true));
-      device.setStream(currentStream);
+
+      exchange->sendReady = device.tagStream();
     }
   } else {
     //gather halo
@@ -275,13 +259,9 @@ void ogs_t::GatherFinish(deviceMemory<T> o_gv,
     } else {
       pinnedMemory<T> haloBuf = exchange->h_workspace;
 
-      //get current stream
       device_t &device = platform.device;
-      stream_t currentStream = device.getStream();
 
-      //synchronize data stream to ensure the buffer is on the host
-      device.setStream(dataStream);
-      device.finish();
+      device.waitFor(exchange->sendReady);
 
       /*MPI exchange of host buffer*/
       exchange->Start (haloBuf, k, op, trans);
@@ -291,8 +271,6 @@ void ogs_t::GatherFinish(deviceMemory<T> o_gv,
       //put the result at the end of o_gv
       haloBuf.copyTo(o_gv + k*NlocalT, k*NhaloP,
                      0, properties_t("async", true));
-      device.finish(); //wait for transfer to finish
-      device.setStream(currentStream);
     }
   }
 }
@@ -417,26 +395,17 @@ void ogs_t::ScatterStart(deviceMemory<T> o_v,
       o_haloBuf.copyFrom(o_gv + k*NlocalT,
                          k*NhaloP, 0, properties_t("async", true));
 
-      //wait for o_haloBuf to be ready
-      device.finish();
-
       //prepare MPI exchange
       exchange->Start(o_haloBuf, k, Add, NoTrans);
     } else {
-      //get current stream
-      stream_t currentStream = device.getStream();
-
       //if not using gpu-aware mpi move the halo buffer to the host
       pinnedMemory<T> haloBuf = exchange->h_workspace;
 
-      //wait for o_gv to be ready
-      device.finish();
-
-      //queue copy to host
-      device.setStream(dataStream);
+      //queue copy to host on the current stream
       haloBuf.copyFrom(o_gv + k*NlocalT, NhaloP*k,
                        0, properties_t("async", true));
-      device.setStream(currentStream);
+
+      exchange->sendReady = device.tagStream();
     }
   }
 }
@@ -460,13 +429,9 @@ void ogs_t::ScatterFinish(deviceMemory<T> o_v,
     } else {
       pinnedMemory<T> haloBuf = exchange->h_workspace;
 
-      //get current stream
       device_t &device = platform.device;
-      stream_t currentStream = device.getStream();
 
-      //synchronize data stream to ensure the buffer is on the host
-      device.setStream(dataStream);
-      device.finish();
+      device.waitFor(exchange->sendReady);
 
       /*MPI exchange of host buffer*/
       exchange->Start (haloBuf, k, Add, NoTrans);
@@ -475,8 +440,6 @@ void ogs_t::ScatterFinish(deviceMemory<T> o_v,
       // copy recv back to device
       haloBuf.copyTo(o_haloBuf, NhaloT*k,
                      0, properties_t("async", true));
-      device.finish(); //wait for transfer to finish
-      device.setStream(currentStream);
     }
 
     //scatter halo buffer
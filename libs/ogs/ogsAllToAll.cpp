@@ -27,6 +27,7 @@ SOFTWARE.
 #include "ogs.hpp"
 #include "ogs/ogsUtils.hpp"
 #include "ogs/ogsExchange.hpp"
+#include "timer.hpp"
 
 #ifdef GLIBCXX_PARALLEL
 #include <parallel/algorithm>
@@ -80,7 +81,11 @@ template<typename T>
 inline void ogsAllToAll_t::Finish(pinnedMemory<T> &buf, const int k,
                            const Op op, const Transpose trans){
 
+  timePoint_t start = Time();
   comm.Wait(request);
+  Profiler::Exchange("ogs AllToAll",
+                     (sendOffsets[size]+recvOffsets[size])*sizeof(T),
+                     ElapsedTime(start, Time()));
 
   //if we recvieved anything via MPI, gather the recv buffer and scatter
   // it back to to original vector
@@ -120,10 +125,10 @@ void ogsAllToAll_t::Start(deviceMemory<T> &o_buf,
     } else {
       extractKernel[ogsType<T>::get()](NsendT, k, o_sendIdsT, o_buf, o_sendBuf);
     }
-    //wait for kernel to finish on default stream
-    device_t &device = platform.device;
-    device.finish();
   }
+
+  device_t &device = platform.device;
+  sendReady = device.tagStream();
 }
 
 template<typename T>
@@ -150,9 +155,18 @@ void ogsAllToAll_t::Finish(deviceMemory<T> &o_buf,
     }
   }
 
+  //wait for the send buffer. Work queued on the stream since Start is not
+  // waited on, and the recv buffer is no longer read by a previous exchange
+  device_t &device = platform.device;
+  device.waitFor(sendReady);
+
   // collect everything needed with single MPI all to all
+  timePoint_t start = Time();
   comm.Alltoallv(o_sendBuf,     sendCounts, sendOffsets,
                  o_buf+Nhalo*k, recvCounts, recvOffsets);
+  Profiler::Exchange("ogs AllToAll",
+                     (sendOffsets[size]+recvOffsets[size])*sizeof(T),
+                     ElapsedTime(start, Time()));
 
   //if we recvieved anything via MPI, gather the recv buffer and scatter
   // it back to to original vector
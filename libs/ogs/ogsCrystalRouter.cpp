@@ -27,6 +27,7 @@ SOFTWARE.
 #include "ogs.hpp"
 #include "ogs/ogsUtils.hpp"
 #include "ogs/ogsExchange.hpp"
+#include "timer.hpp"
 
 #ifdef GLIBCXX_PARALLEL
 #include <parallel/algorithm>
@@ -91,7 +92,11 @@ inline void ogsCrystalRouter_t::Finish(pinnedMemory<T> &buf, const int k,
                rank,
                request[0]);
 
+    timePoint_t start = Time();
     comm.Waitall(levels[l].Nmsg+1, request);
+    Profiler::Exchange("ogs CrystalRouter",
+                       (levels[l].Nsend+levels[l].Nrecv0+levels[l].Nrecv1)*k*sizeof(T),
+                       ElapsedTime(start, Time()));
 
     //rotate buffers
     h_workspace = h_work[(hbuf_id+1)%2];
@@ -122,6 +127,8 @@ inline void ogsCrystalRouter_t::Start(deviceMemory<T> &o_buf,
                                       const int k,
                                       const Op op,
                                       const Transpose trans){
+  device_t &device = platform.device;
+  sendReady = device.tagStream();
 }
 
 template<typename T>
@@ -132,6 +139,10 @@ inline void ogsCrystalRouter_t::Finish(deviceMemory<T> &o_buf,
 
   device_t &device = platform.device;
 
+  //wait for o_buf. Work queued on the current stream since Start is not
+  // waited on, and keeps running while the levels are exchanged
+  device.waitFor(sendReady);
+
   //get current stream
   stream_t currentStream = device.getStream();
 
@@ -183,7 +194,11 @@ inline void ogsCrystalRouter_t::Finish(deviceMemory<T> &o_buf,
                rank,
                request[0]);
 
+    timePoint_t start = Time();
     comm.Waitall(levels[l].Nmsg+1, request);
+    Profiler::Exchange("ogs CrystalRouter",
+                       (levels[l].Nsend+levels[l].Nrecv0+levels[l].Nrecv1)*k*sizeof(T),
+                       ElapsedTime(start, Time()));
 
     //rotate buffers
     o_workspace = o_work[(buf_id+1)%2];
@@ -196,6 +211,9 @@ inline void ogsCrystalRouter_t::Finish(deviceMemory<T> &o_buf,
     levels[l].gather.Gather(o_buf, o_recvBuf, k, op, Trans);
   }
 
+  //the halo buffer must be assembled before the caller's stream reads it
+  device.finish();
+
   device.setStream(currentStream);
 }
 
@@ -62,34 +62,26 @@ void halo_t::ExchangeStart(deviceMemory<T> o_v, const int k){
     exchange->Start(o_haloBuf, k, Add, NoTrans);
 
   } else {
-    //get current stream
     device_t &device = platform.device;
-    stream_t currentStream = device.getStream();
 
     //if not using gpu-aware mpi move the halo buffer to the host
     pinnedMemory<T> haloBuf = exchange->h_workspace;
 
     if (gathered_halo) {
-      //wait for o_v to be ready
-      device.finish();
-
-      //queue copy to host
-      device.setStream(dataStream);
+      //queue copy to host on the current stream
       haloBuf.copyFrom(o_v + k*NlocalT, NhaloP*k,
                        0, properties_t("async", true));
-      device.setStream(currentStream);
+
+      exchange->sendReady = device.tagStream();
     } else {
       //collect halo buffer
       gatherHalo->Gather(o_haloBuf, o_v, k, Add, NoTrans);
 
-      //wait for o_haloBuf to be ready
-      device.finish();
-
-      //queue copy to host
-      device.setStream(dataStream);
+      //queue copy to host on the current stream
       haloBuf.copyFrom(o_haloBuf, NhaloP*k,
                        0, properties_t("async", true));
-      device.setStream(currentStream);
+
+      exchange->sendReady = device.tagStream();
     }
   }
 }
@@ -113,13 +105,9 @@ void halo_t::ExchangeFinish(deviceMemory<T> o_v, const int k){
   } else {
     pinnedMemory<T> haloBuf = exchange->h_workspace;
 
-    //get current stream
     device_t &device = platform.device;
-    stream_t currentStream = device.getStream();
 
-    //synchronize data stream to ensure the buffer is on the host
-    device.setStream(dataStream);
-    device.finish();
+    device.waitFor(exchange->sendReady);
 
     /*MPI exchange of host buffer*/
     exchange->Start (haloBuf, k, Add, NoTrans);
@@ -129,13 +117,9 @@ void halo_t::ExchangeFinish(deviceMemory<T> o_v, const int k){
     if (gathered_halo) {
       haloBuf.copyTo(o_v + k*(NlocalT+NhaloP), k*Nhalo,
                      k*NhaloP, properties_t("async", true));
-      device.finish(); //wait for transfer to finish
-      device.setStream(currentStream);
     } else {
       haloBuf.copyTo(o_haloBuf+k*NhaloP, k*Nhalo,
                      k*NhaloP, properties_t("async", true));
-      device.finish(); //wait for transfer to finish
-      device.setStream(currentStream);
 
       gatherHalo->Scatter(o_v, o_haloBuf, k, NoTrans);
     }
@@ -240,34 +224,26 @@ void halo_t::CombineStart(deviceMemory<T> o_v, const int k){
     //prepare MPI exchange
     exchange->Start(o_haloBuf, k, Add, Trans);
   } else {
-    //get current stream
     device_t &device = platform.device;
-    stream_t currentStream = device.getStream();
 
     //if not using gpu-aware mpi move the halo buffer to the host
     pinnedMemory<T> haloBuf = exchange->h_workspace;
 
     if (gathered_halo) {
-      //wait for o_v to be ready
-      device.finish();
-
-      //queue copy to host
-      device.setStream(dataStream);
+      //queue copy to host on the current stream
       haloBuf.copyFrom(o_v + k*NlocalT, NhaloT*k,
                        0, properties_t("async", true));
-      device.setStream(currentStream);
+
+      exchange->sendReady = device.tagStream();
     } else {
       //collect halo buffer
       gatherHalo->Gather(o_haloBuf, o_v, k, Add, Trans);
 
-      //wait for o_haloBuf to be ready
-      device.finish();
-
-      //queue copy to host
-      device.setStream(dataStream);
+      //queue copy to host on the current stream
       haloBuf.copyFrom(o_haloBuf, NhaloT*k,
                        0, properties_t("async", true));
-      device.setStream(currentStream);
+
+      exchange->sendReady = device.tagStream();
     }
   }
 }
@@ -292,13 +268,9 @@ void halo_t::CombineFinish(deviceMemory<T> o_v, const int k){
   } else {
     pinnedMemory<T> haloBuf = exchange->h_workspace;
 
-    //get current stream
     device_t &device = platform.device;
-    stream_t currentStream = device.getStream();
 
-    //synchronize data stream to ensure the buffer is on the host
-    device.setStream(dataStream);
-    device.finish();
+    device.waitFor(exchange->sendReady);
 
     /*MPI exchange of host buffer*/
     exchange->Start (haloBuf, k, Add, Trans);
@@ -308,13 +280,9 @@ void halo_t::CombineFinish(deviceMemory<T> o_v, const int k){
       // copy recv back to device
       haloBuf.copyTo(o_v + k*NlocalT, NhaloP*k,
                      0, properties_t("async", true));
-      device.finish(); //wait for transfer to finish
-      device.setStream(currentStream);
     } else {
       haloBuf.copyTo(o_haloBuf, NhaloP*k,
                      0, properties_t("async", true));
-      device.finish(); //wait for transfer to finish
-      device.setStream(currentStream);
 
       gatherHalo->Scatter(o_v, o_haloBuf, k, Trans);
     }
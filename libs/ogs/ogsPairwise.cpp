@@ -27,6 +27,7 @@ SOFTWARE.
 #include "ogs.hpp"
 #include "ogs/ogsUtils.hpp"
 #include "ogs/ogsExchange.hpp"
+#include "timer.hpp"
 
 #ifdef GLIBCXX_PARALLEL
 #include <parallel/algorithm>
@@ -88,9 +89,14 @@ inline void ogsPairwise_t::Finish(pinnedMemory<T> &buf, const int k,
 
   const int NranksSend  = (trans==NoTrans) ? NranksSendN  : NranksSendT;
   const int NranksRecv  = (trans==NoTrans) ? NranksRecvN  : NranksRecvT;
+  const int *sendOffsets= (trans==NoTrans) ? sendOffsetsN.ptr() : sendOffsetsT.ptr();
   const int *recvOffsets= (trans==NoTrans) ? recvOffsetsN.ptr() : recvOffsetsT.ptr();
 
+  timePoint_t start = Time();
   comm.Waitall(NranksRecv+NranksSend, requests);
+  Profiler::Exchange("ogs Pairwise",
+                     (sendOffsets[NranksSend]+recvOffsets[NranksRecv])*k*sizeof(T),
+                     ElapsedTime(start, Time()));
 
   //if we recvieved anything via MPI, gather the recv buffer and scatter
   // it back to to original vector
@@ -130,10 +136,10 @@ void ogsPairwise_t::Start(deviceMemory<T> &o_buf,
     } else {
       extractKernel[ogsType<T>::get()](NsendT, k, o_sendIdsT, o_buf, o_sendBuf);
     }
-    //wait for kernel to finish on default stream
-    device_t &device = platform.device;
-    device.finish();
   }
+
+  device_t &device = platform.device;
+  sendReady = device.tagStream();
 }
 
 template<typename T>
@@ -153,6 +159,11 @@ void ogsPairwise_t::Finish(deviceMemory<T> &o_buf,
   const int *sendOffsets= (trans==NoTrans) ? sendOffsetsN.ptr() : sendOffsetsT.ptr();
   const int *recvOffsets= (trans==NoTrans) ? recvOffsetsN.ptr() : recvOffsetsT.ptr();
 
+  //wait for the send buffer. Work queued on the stream since Start is not
+  // waited on, and the recv buffer is no longer read by a previous exchange
+  device_t &device = platform.device;
+  device.waitFor(sendReady);
+
   //post recvs
   for (int r=0;r<NranksRecv;r++) {
     comm.Irecv(o_buf + Nhalo*k + recvOffsets[r]*k,
@@ -171,7 +182,11 @@ void ogsPairwise_t::Finish(deviceMemory<T> &o_buf,
               requests[NranksRecv+r]);
   }
 
+  timePoint_t start = Time();
   comm.Waitall(NranksRecv+NranksSend, requests);
+  Profiler::Exchange("ogs Pairwise",
+                     (sendOffsets[NranksSend]+recvOffsets[NranksRecv])*k*sizeof(T),
+                     ElapsedTime(start, Time()));
 
   //if we recvieved anything via MPI, gather the recv buffer and scatter
   // it back to to original vector
@@ -43,6 +43,9 @@ graph_t::graph_t(platform_t &_platform,
                  const memory<dfloat>& EX,
                  const memory<dfloat>& EY,
                  const memory<dfloat>& EZ,
+                 const memory<hlong>& elementInfo,
+                 const int _Nconstraints,
+                 const memory<dfloat>& weights,
                  comm_t _comm):
   platform(_platform),
   Nverts(_Nelements),
@@ -50,7 +53,12 @@ graph_t::graph_t(platform_t &_platform,
   dim(_dim),
   Nfaces(_Nfaces),
   NelementVerts(_Nverts),
-  NfaceVerts(_NfaceVerts) {
+  NfaceVerts(_NfaceVerts),
+  Nconstraints(_Nconstraints) {
+
+  LIBP_ABORT("Paradogs: Number of balance constraints " << Nconstraints
+             << " exceeds maximum of " << MAX_NCONSTRAINTS,
+             Nconstraints > MAX_NCONSTRAINTS);
 
   gcomm = _comm.Dup();
   grank = gcomm.rank();
@@ -76,6 +84,14 @@ graph_t::graph_t(platform_t &_platform,
   gVoffsetL = VoffsetL;
   gVoffsetU = VoffsetU;
 
+  /*Remember where each element started*/
+  homeStarts.malloc(gsize+1);
+  homeStarts[0]=0;
+  comm.Allgather(localNverts, homeStarts+1);
+  for(int r=0;r<gsize;++r) {
+    homeStarts[r+1] += homeStarts[r];
+  }
+
   /*Create array of packed element data*/
   elements.malloc(Nelements);
 
@@ -91,6 +107,11 @@ graph_t::graph_t(platform_t &_platform,
         elements[e].E[f] = -1;
         elements[e].F[f] = -1;
       }
+      elements[e].info = elementInfo[e];
+      elements[e].id = VoffsetL + e;
+      for (int k=0;k<Nconstraints;++k) {
+        elements[e].W[k] = weights[k+e*Nconstraints];
+      }
     }
   } else {
     for (dlong e=0;e<Nelements;++e) {
@@ -105,6 +126,11 @@ graph_t::graph_t(platform_t &_platform,
         elements[e].E[f] = -1;
         elements[e].F[f] = -1;
       }
+      elements[e].info = elementInfo[e];
+      elements[e].id = VoffsetL + e;
+      for (int k=0;k<Nconstraints;++k) {
+        elements[e].W[k] = weights[k+e*Nconstraints];
+      }
     }
   }
 }
@@ -371,6 +397,30 @@ void graph_t::Report() {
             static_cast<long long int>(maxCut));
     printf("-----------------------------------------------------------------------------------------------\n");
   }
+
+  /*Imbalance (max/avg) of each balance constraint*/
+  for (int k=0;k<Nconstraints;++k) {
+    dfloat localW=0.0;
+    for (dlong n=0;n<Nverts;++n) {
+      localW += elements[n].W[k];
+    }
+    dfloat sumW = localW;
+    dfloat maxW = localW;
+    gcomm.Allreduce(sumW);
+    gcomm.Allreduce(maxW, Comm::Max);
+
+    const dfloat avgW = sumW/gsize;
+    const dfloat imbalance = (avgW>0.0) ? maxW/avgW : 1.0;
+
+    if(grank==0) {
+      char line[96];
+      snprintf(line, sizeof(line), "   Constraint %d imbalance (max/avg):  %5.3f", k, imbalance);
+      printf("%-94s|\n", line);
+    }
+  }
+  if(grank==0 && Nconstraints>0) {
+    printf("-----------------------------------------------------------------------------------------------\n");
+  }
 }
 
 void graph_t::ExtractMesh(dlong &Nelements_,
@@ -379,7 +429,10 @@ void graph_t::ExtractMesh(dlong &Nelements_,
                           memory<int>& EToF,
                           memory<dfloat>& EX,
                           memory<dfloat>& EY,
-                          memory<dfloat>& EZ) {
+                          memory<dfloat>& EZ,
+                          memory<hlong>& elementInfo,
+                          memory<dfloat>& weights,
+                          memory<hlong>& elementIds) {
 
   /*Destroy any exiting mesh data and create new data from current graph*/
   Nelements_ = Nelements;
@@ -393,6 +446,10 @@ void graph_t::ExtractMesh(dlong &Nelements_,
   if (dim==3)
     EZ.malloc(Nelements*NelementVerts);
 
+  elementInfo.malloc(Nelements);
+  elementIds.malloc(Nelements);
+  weights.malloc(Nelements*Nconstraints);
+
   if (dim==2) {
     for (dlong e=0;e<Nelements;++e) {
       for (int v=0;v<NelementVerts;++v) {
@@ -404,6 +461,11 @@ void graph_t::ExtractMesh(dlong &Nelements_,
         EToE[f+e*Nfaces] = elements[e].E[f];
         EToF[f+e*Nfaces] = elements[e].F[f];
       }
+      elementInfo[e] = elements[e].info;
+      elementIds[e] = elements[e].id;
+      for (int k=0;k<Nconstraints;++k) {
+        weights[k+e*Nconstraints] = elements[e].W[k];
+      }
     }
   } else {
     for (dlong e=0;e<Nelements;++e) {
@@ -417,6 +479,11 @@ void graph_t::ExtractMesh(dlong &Nelements_,
         EToE[f+e*Nfaces] = elements[e].E[f];
         EToF[f+e*Nfaces] = elements[e].F[f];
       }
+      elementInfo[e] = elements[e].info;
+      elementIds[e] = elements[e].id;
+      for (int k=0;k<Nconstraints;++k) {
+        weights[k+e*Nconstraints] = elements[e].W[k];
+      }
     }
   }
 }
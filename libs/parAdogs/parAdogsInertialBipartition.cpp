@@ -181,16 +181,7 @@ void graph_t::InertialBipartition(const dfloat targetFraction[2]) {
     }
   }
 
-  const hlong K = std::ceil(targetFraction[0]*NVertsGlobal);
-  const dfloat pivot = ParallelPivot(Nverts, F, K, comm);
-
-  for (dlong n=0;n<Nverts;++n) {
-    if (F[n]<=pivot) {
-      partition[n] = 0;
-    } else {
-      partition[n] = 1;
-    }
-  }
+  PivotBipartition(F, targetFraction, partition);
 
   /*Split the graph according to this partitioning*/
   Split(partition);
@@ -49,6 +49,10 @@ void MeshPartition(platform_t &platform,
                    memory<dfloat>& EX,
                    memory<dfloat>& EY,
                    memory<dfloat>& EZ,
+                   memory<hlong>& elementInfo,
+                   const int Nconstraints,
+                   memory<dfloat>& weights,
+                   memory<hlong>& elementIds,
                    comm_t comm) {
 
   /* Create RNG*/
@@ -66,6 +70,9 @@ void MeshPartition(platform_t &platform,
                 EX,
                 EY,
                 EZ,
+                elementInfo,
+                Nconstraints,
+                weights,
                 comm);
 
   timePoint_t timeStart = GlobalTime(comm);
@@ -81,6 +88,9 @@ void MeshPartition(platform_t &platform,
     graph.SpectralPartition();
   }
 
+  /*Keep partitions on the ranks which already hold most of their elements*/
+  graph.Remap();
+
   /*Connect element faces after partitioning*/
   graph.Connect();
 
@@ -106,7 +116,10 @@ void MeshPartition(platform_t &platform,
                     EToF,
                     EX,
                     EY,
-                    EZ);
+                    EZ,
+                    elementInfo,
+                    weights,
+                    elementIds);
 }
 
 } //namespace paradogs
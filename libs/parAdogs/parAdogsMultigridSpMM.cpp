@@ -27,6 +27,7 @@ SOFTWARE.
 #include "parAdogs.hpp"
 #include "parAdogs/parAdogsMatrix.hpp"
 #include "parAdogs/parAdogsPartition.hpp"
+#include "spgemm.hpp"
 
 namespace libp {
 
@@ -138,150 +139,75 @@ parCSR SpMM(const parCSR& A, const parCSR& B){
 
   //we now have all the needed nonlocal rows (should also be sorted by row then col)
 
-  //make an array of row offsets so we know how large each row is
-  memory<dlong> BoffdRowOffsets(A.Ncols-A.NlocalCols+1, 0);
-
-  dlong id=0;
-  for (dlong n=0;n<Boffdnnz;n++) {
-    hlong row = BoffdRows[n].row;
-
-    while(A.colMap[id+A.NlocalCols]!=row) id++;
-
-    BoffdRowOffsets[id+1]++; //count entry in row
+  // List the rows of B indexed by the columns of A, local rows first
+  // then the recieved rows in halo order, with global column ids
+  csrRows_t Brows;
+  Brows.Nrows = A.Ncols;
+  Brows.nnz = B.diag.nnz + B.offd.nnz + Boffdnnz;
+  Brows.rowStarts.malloc(A.Ncols+1);
+  Brows.cols.malloc(Brows.nnz);
+  Brows.vals.malloc(Brows.nnz);
+
+  Brows.rowStarts[0] = 0;
+  for (dlong i=0;i<B.Nrows;i++) {
+    Brows.rowStarts[i+1] = Brows.rowStarts[i]
+                          + B.diag.rowStarts[i+1]-B.diag.rowStarts[i]
+                          + B.offd.rowStarts[i+1]-B.offd.rowStarts[i];
   }
 
-  //cumulative sum
-  for (dlong n=0;n<A.Ncols-A.NlocalCols;n++)
-    BoffdRowOffsets[n+1] += BoffdRowOffsets[n];
-
-
-  // The next step to compute C = A*B is to multiply each entry A(i,j) by the
-  // row B(j,:), store the all the results, sort them by row+col, and compress
-  // the entries
-
-  // Find how big the intermediate form is
-  memory<dlong> rowStarts(A.Nrows+1, 0);
-  memory<dlong> rowCounts(A.Nrows, 0);
-
-  /*Count entries per row*/
   #pragma omp parallel for
-  for (dlong i=0;i<A.Nrows;i++) {
-    //local entries
-    dlong start = A.diag.rowStarts[i];
-    dlong end   = A.diag.rowStarts[i+1];
-    for (dlong j=start;j<end;j++) {
-      const dlong col = A.diag.cols[j];
-      rowStarts[i+1] +=  B.diag.rowStarts[col+1]-B.diag.rowStarts[col]
-                        +B.offd.rowStarts[col+1]-B.offd.rowStarts[col];
+  for (dlong i=0;i<B.Nrows;i++) {
+    dlong cnt = Brows.rowStarts[i];
+    for (dlong jj=B.diag.rowStarts[i]; jj<B.diag.rowStarts[i+1];jj++){
+      Brows.cols[cnt] = B.diag.cols[jj] + B.colOffsetL; //global id
+      Brows.vals[cnt] = B.diag.vals[jj];
+      cnt++;
     }
-    //non-local entries
-    start = A.offd.rowStarts[i];
-    end   = A.offd.rowStarts[i+1];
-    for (dlong j=start;j<end;j++) {
-      const dlong col = A.offd.cols[j]-A.NlocalCols;
-      rowStarts[i+1] += BoffdRowOffsets[col+1] - BoffdRowOffsets[col];
+    for (dlong jj=B.offd.rowStarts[i]; jj<B.offd.rowStarts[i+1];jj++){
+      Brows.cols[cnt] = B.colMap[B.offd.cols[jj]]; //global id
+      Brows.vals[cnt] = B.offd.vals[jj];
+      cnt++;
     }
   }
 
-  /*Cumulative sum*/
-  for(dlong i=1; i<A.Nrows+1; i++) {
-    rowStarts[i] += rowStarts[i-1];
-  }
-
-  NNZ = rowStarts[A.Nrows];
-
-  memory<nonZero_t> Ctmp(NNZ);
-
-  //count total number of nonzeros;
-  dlong nnz =0;
-
-  // Fill the intermediate form of C
-  // #pragma omp parallel for
-  for (dlong i=0;i<A.Nrows;i++) {
-    const dlong cStart = rowStarts[i];
-    dlong& c = rowCounts[i];
-
-    //local A entries
-    dlong start = A.diag.rowStarts[i];
-    dlong end   = A.diag.rowStarts[i+1];
-    for (dlong j=start;j<end;j++) {
-      const dlong col = A.diag.cols[j];
-      const dfloat Aval = A.diag.vals[j];
-
-      //local B entries
-      dlong Bstart = B.diag.rowStarts[col];
-      dlong Bend   = B.diag.rowStarts[col+1];
-      for (dlong jj=Bstart;jj<Bend;jj++) {
-        Ctmp[cStart+c].row = i + A.rowOffsetL;
-        Ctmp[cStart+c].col = B.diag.cols[jj] + B.colOffsetL; //global id
-        Ctmp[cStart+c].val = Aval*B.diag.vals[jj];
-        c++;
-      }
-      //non-local B entries
-      Bstart = B.offd.rowStarts[col];
-      Bend   = B.offd.rowStarts[col+1];
-      for (dlong jj=Bstart;jj<Bend;jj++) {
-        Ctmp[cStart+c].row = i + A.rowOffsetL;
-        Ctmp[cStart+c].col = B.colMap[B.offd.cols[jj]]; //global id
-        Ctmp[cStart+c].val = Aval*B.offd.vals[jj];
-        c++;
-      }
-    }
-    //non-local A entries
-    start = A.offd.rowStarts[i];
-    end   = A.offd.rowStarts[i+1];
-    for (dlong j=start;j<end;j++) {
-      const dlong col = A.offd.cols[j]-A.NlocalCols;
-      const dfloat Aval = A.offd.vals[j];
-
-      // entries from recived rows of B
-      dlong Bstart = BoffdRowOffsets[col];
-      dlong Bend   = BoffdRowOffsets[col+1];
-      for (dlong jj=Bstart;jj<Bend;jj++) {
-        Ctmp[cStart+c].row = i + A.rowOffsetL;
-        Ctmp[cStart+c].col = BoffdRows[jj].col; //global id
-        Ctmp[cStart+c].val = Aval*BoffdRows[jj].val;
-        c++;
-      }
-    }
+  dlong cnt = Brows.rowStarts[B.Nrows];
+  dlong id=0;
+  for (dlong n=0;n<Boffdnnz;n++) {
+    const hlong row = BoffdRows[n].row;
 
-    //sort entries in this row by col id
-    std::sort(Ctmp.ptr()+cStart, Ctmp.ptr()+cStart+c,
-              [](const nonZero_t& a, const nonZero_t& b) {
-                return a.col < b.col;
-              });
-
-    /*Count how many actual nonzeros will be in this row*/
-    dlong nnzRow=0;
-    if (c>0) nnzRow++;
-    for (dlong j=1;j<c;j++) {
-      if ((Ctmp[cStart+j].col!=Ctmp[cStart+j-1].col)) nnzRow++;
+    while(A.colMap[id+A.NlocalCols]!=row) {
+      Brows.rowStarts[id+A.NlocalCols+1] = cnt; //close finished rows
+      id++;
     }
 
-    nnz+=nnzRow; //Add to total
+    Brows.cols[cnt] = BoffdRows[n].col; //global id
+    Brows.vals[cnt] = BoffdRows[n].val;
+    cnt++;
   }
-  BoffdRowOffsets.free();
+  for (dlong n=id+A.NlocalCols;n<A.Ncols;n++)
+    Brows.rowStarts[n+1] = cnt;
+
   BoffdRows.free();
 
-  rowStarts.free();
-  rowCounts.free();
+  // Form C = A*B row by row
+  csrRows_t Crows = SpGEMM(A.Nrows,
+                           A.diag.rowStarts, A.diag.cols, A.diag.vals,
+                           A.offd.rowStarts, A.offd.cols, A.offd.vals,
+                           Brows);
+  Brows = csrRows_t(); //free
 
-  // cooC.nnz = nnz;
+  const dlong nnz = Crows.nnz;
   memory<nonZero_t> entries(nnz);
 
-  //compress nonzeros
-  nnz = 0;
-  if (NNZ) entries[nnz++] = Ctmp[0];
-  for (dlong i=1;i<NNZ;i++) {
-    if ((Ctmp[i].row!=Ctmp[i-1].row)||
-        (Ctmp[i].col!=Ctmp[i-1].col)) {
-      entries[nnz++] = Ctmp[i];
-    } else {
-      entries[nnz-1].val += Ctmp[i].val;
+  #pragma omp parallel for
+  for (dlong i=0;i<A.Nrows;i++) {
+    for (dlong jj=Crows.rowStarts[i];jj<Crows.rowStarts[i+1];jj++) {
+      entries[jj].row = i + A.rowOffsetL;
+      entries[jj].col = Crows.cols[jj];
+      entries[jj].val = Crows.vals[jj];
     }
   }
-  //clean up
-  Ctmp.free();
+  Crows = csrRows_t(); //free
 
   //build C from coo matrix
   return parCSR(A.Nrows, B.NlocalCols,
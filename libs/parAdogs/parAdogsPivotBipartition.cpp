@@ -0,0 +1,237 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "parAdogs.hpp"
+#include "parAdogs/parAdogsGraph.hpp"
+#include "parAdogs/parAdogsPartition.hpp"
+#include <limits>
+#include <cmath>
+
+namespace libp {
+
+namespace paradogs {
+
+/* Given a distributed vector F with positive weights W in comm, find a
+   pivot value such that the global weight of entries of F which are
+   <= pivot is within half an entry weight of target. */
+dfloat WeightedParallelPivot(const dlong N, memory<dfloat>& F,
+                             memory<dfloat>& W, const dfloat target,
+                             comm_t comm) {
+
+  /*Find global minimum/maximum, and the largest single weight*/
+  dfloat globalMin=std::numeric_limits<dfloat>::max();
+  dfloat globalMax=std::numeric_limits<dfloat>::lowest();
+  dfloat maxW=0.0;
+  for (dlong n=0;n<N;++n) {
+    globalMax = std::max(F[n], globalMax);
+    globalMin = std::min(F[n], globalMin);
+    maxW = std::max(W[n], maxW);
+  }
+  comm.Allreduce(globalMin, Comm::Min);
+  comm.Allreduce(globalMax, Comm::Max);
+  comm.Allreduce(maxW, Comm::Max);
+
+  /*Find pivot point via binary search*/
+  constexpr dfloat TOL = (sizeof(dfloat)==8) ? 1.0e-13 : 1.0E-5;
+  dfloat min = globalMin;
+  dfloat max = globalMax;
+  dfloat pivot = (min+max)/2.0;
+  while (max-min >= TOL) {
+    pivot = (min+max)/2.0;
+
+    /*Get the weight of entries which are globally <= pivot*/
+    dfloat w=0.0;
+    for (dlong n=0;n<N;++n) {
+      if (F[n]<=pivot) w += W[n];
+    }
+    comm.Allreduce(w);
+
+    if (std::abs(w-target) <= 0.5*maxW) break;
+
+    if (target<w) {
+      max = pivot;
+    } else {
+      min = pivot;
+    }
+  }
+
+  return pivot;
+}
+
+/*Bipartition by thresholding F. Without constraints the threshold
+  splits the element count by targetFraction. With constraints, a single
+  threshold is placed on the combined weight of all constraints, each
+  scaled by its global total, so both sides stay contiguous in the
+  ordering. If that cut leaves a constraint out of balance, the element
+  centroid coordinates are tried as the ordering instead. Only when no
+  single cut balances every constraint is each element classed by its
+  dominant constraint and each class split at its own weighted pivot*/
+void graph_t::PivotBipartition(memory<dfloat>& F,
+                               const dfloat targetFraction[2],
+                               memory<int>& partition) {
+
+  if (Nconstraints==0) {
+    const hlong K = std::ceil(targetFraction[0]*NVertsGlobal);
+    const dfloat pivot = ParallelPivot(Nverts, F, K, comm);
+
+    for (dlong n=0;n<Nverts;++n) {
+      if (F[n]<=pivot) {
+        partition[n] = 0;
+      } else {
+        partition[n] = 1;
+      }
+    }
+    return;
+  }
+
+  /*Global total and largest element weight of each constraint*/
+  memory<dfloat> totalW(Nconstraints, 0.0);
+  memory<dfloat> maxW(Nconstraints, 0.0);
+  for (dlong n=0;n<Nverts;++n) {
+    for (int k=0;k<Nconstraints;++k) {
+      totalW[k] += elements[n].W[k];
+      maxW[k] = std::max(maxW[k], elements[n].W[k]);
+    }
+  }
+  comm.Allreduce(totalW);
+  comm.Allreduce(maxW, Comm::Max);
+
+  int Nweighted=0;
+  for (int k=0;k<Nconstraints;++k) {
+    if (totalW[k]>0.0) Nweighted++;
+  }
+
+  /*Combined weight, every constraint counting equally*/
+  memory<dfloat> Wsum(Nverts);
+  for (dlong n=0;n<Nverts;++n) {
+    Wsum[n] = 0.0;
+    for (int k=0;k<Nconstraints;++k) {
+      if (totalW[k]>0.0) Wsum[n] += elements[n].W[k]/totalW[k];
+    }
+  }
+
+  /*A cut is balanced if every constraint is within one element weight,
+    plus a small fraction, of its target*/
+  constexpr dfloat balanceTol = 0.01;
+  memory<dfloat> W0(Nconstraints);
+  auto Balanced = [&](memory<dfloat>& G, const dfloat pivot) {
+    for (int k=0;k<Nconstraints;++k) W0[k] = 0.0;
+    for (dlong n=0;n<Nverts;++n) {
+      if (G[n]<=pivot) {
+        for (int k=0;k<Nconstraints;++k) W0[k] += elements[n].W[k];
+      }
+    }
+    comm.Allreduce(W0);
+
+    bool balanced = true;
+    for (int k=0;k<Nconstraints;++k) {
+      const dfloat target = targetFraction[0]*totalW[k];
+      if (std::abs(W0[k]-target) > balanceTol*target + maxW[k]) balanced = false;
+    }
+    return balanced;
+  };
+
+  if (Nweighted>0) {
+    /*Orderings to try: F, then the element centroid coordinates*/
+    memory<dfloat> G[4];
+    G[0] = F;
+    for (int d=0;d<dim;++d) {
+      G[d+1].malloc(Nverts);
+      for (dlong n=0;n<Nverts;++n) {
+        dfloat c=0.0;
+        for (int v=0;v<NelementVerts;++v) {
+          c += (d==0) ? elements[n].EX[v]
+             : (d==1) ? elements[n].EY[v]
+                      : elements[n].EZ[v];
+        }
+        G[d+1][n] = c/NelementVerts;
+      }
+    }
+
+    const dfloat target = targetFraction[0]*Nweighted;
+    for (int g=0;g<=dim;++g) {
+      const dfloat pivot = WeightedParallelPivot(Nverts, G[g], Wsum, target, comm);
+
+      if (Balanced(G[g], pivot)) {
+        for (dlong n=0;n<Nverts;++n) {
+          partition[n] = (G[g][n]<=pivot) ? 0 : 1;
+        }
+        return;
+      }
+    }
+  }
+
+  /*Class each element by its dominant constraint*/
+  memory<int> klass(Nverts);
+  memory<dlong> Nclass(Nconstraints, 0);
+  memory<hlong> classCount(Nconstraints, 0);
+  memory<dfloat> classWeight(Nconstraints, 0.0);
+  for (dlong n=0;n<Nverts;++n) {
+    int c=0;
+    for (int k=1;k<Nconstraints;++k) {
+      if (elements[n].W[k]>elements[n].W[c]) c=k;
+    }
+    klass[n] = c;
+    Nclass[c]++;
+    classCount[c]++;
+    classWeight[c] += elements[n].W[c];
+  }
+  comm.Allreduce(classCount);
+  comm.Allreduce(classWeight);
+
+  memory<dfloat> Fc(Nverts);
+  memory<dfloat> Wc(Nverts);
+  for (int c=0;c<Nconstraints;++c) {
+    if (classCount[c]==0) continue;
+
+    /*Fall back to balancing counts if this class carries no weight*/
+    const bool unweighted = (classWeight[c]<=0.0);
+
+    dlong cnt=0;
+    for (dlong n=0;n<Nverts;++n) {
+      if (klass[n]==c) {
+        Fc[cnt] = F[n];
+        Wc[cnt] = unweighted ? 1.0 : elements[n].W[c];
+        cnt++;
+      }
+    }
+
+    const dfloat target = targetFraction[0]*(unweighted ? static_cast<dfloat>(classCount[c])
+                                                        : classWeight[c]);
+    const dfloat pivot = WeightedParallelPivot(Nclass[c], Fc, Wc, target, comm);
+
+    for (dlong n=0;n<Nverts;++n) {
+      if (klass[n]==c) {
+        partition[n] = (F[n]<=pivot) ? 0 : 1;
+      }
+    }
+  }
+}
+
+} //namespace paradogs
+
+} //namespace libp
@@ -0,0 +1,165 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "parAdogs.hpp"
+#include "parAdogs/parAdogsGraph.hpp"
+#include <algorithm>
+
+namespace libp {
+
+namespace paradogs {
+
+/*Once every rank holds one partition, permute the partitions among the
+  ranks so that each partition lands on the rank where most of its
+  elements started. This keeps repartitioning of an already distributed
+  mesh from needlessly migrating elements.*/
+void graph_t::Remap() {
+
+  /*Only meaningful once the graph has been fully partitioned*/
+  if (gsize==1 || size>1) return;
+
+  /*Count how many of our elements came from each rank*/
+  memory<int> home(Nverts);
+  for (dlong e=0;e<Nverts;++e) {
+    const hlong id = elements[e].id;
+    home[e] = static_cast<int>(std::upper_bound(homeStarts.ptr(),
+                                                homeStarts.ptr()+gsize+1,
+                                                id) - homeStarts.ptr()) - 1;
+  }
+  std::sort(home.ptr(), home.ptr()+Nverts);
+
+  int Noverlap=0;
+  for (dlong e=0;e<Nverts;++e) {
+    if (e==0 || home[e]!=home[e-1]) Noverlap++;
+  }
+
+  memory<int> overlapRanks(Noverlap);
+  memory<dlong> overlapCounts(Noverlap);
+  Noverlap=0;
+  for (dlong e=0;e<Nverts;++e) {
+    if (e==0 || home[e]!=home[e-1]) {
+      overlapRanks[Noverlap] = home[e];
+      overlapCounts[Noverlap] = 0;
+      Noverlap++;
+    }
+    overlapCounts[Noverlap-1]++;
+  }
+  home.free();
+
+  /*Gather the (sparse) overlap of partitions and home ranks on rank 0*/
+  memory<int> recvCounts(gsize);
+  memory<int> recvOffsets(gsize+1);
+  gcomm.Gather(Noverlap, recvCounts, 0);
+
+  recvOffsets[0]=0;
+  for (int r=0;r<gsize;++r) {
+    recvOffsets[r+1] = (grank==0) ? recvOffsets[r]+recvCounts[r] : 0;
+  }
+  const int NoverlapTotal = recvOffsets[gsize];
+
+  memory<int> allRanks(NoverlapTotal);
+  memory<dlong> allCounts(NoverlapTotal);
+  gcomm.Gatherv(overlapRanks, Noverlap, allRanks, recvCounts, recvOffsets, 0);
+  gcomm.Gatherv(overlapCounts, Noverlap, allCounts, recvCounts, recvOffsets, 0);
+
+  /*Greedily assign partitions to ranks, largest overlaps first*/
+  memory<int> perm(gsize);
+  if (grank==0) {
+    struct overlap_t {
+      dlong count;
+      int part;
+      int rank;
+    };
+    memory<overlap_t> overlaps(NoverlapTotal);
+    for (int p=0;p<gsize;++p) {
+      for (int n=recvOffsets[p];n<recvOffsets[p+1];++n) {
+        overlaps[n].count = allCounts[n];
+        overlaps[n].part  = p;
+        overlaps[n].rank  = allRanks[n];
+      }
+    }
+    std::sort(overlaps.ptr(), overlaps.ptr()+NoverlapTotal,
+              [](const overlap_t& a, const overlap_t& b) {
+                if (a.count!=b.count) return a.count>b.count;
+                if (a.part!=b.part) return a.part<b.part;
+                return a.rank<b.rank;
+              });
+
+    memory<int> owner(gsize, -1);
+    for (int p=0;p<gsize;++p) perm[p] = -1;
+
+    for (int n=0;n<NoverlapTotal;++n) {
+      const int p = overlaps[n].part;
+      const int r = overlaps[n].rank;
+      if (perm[p]==-1 && owner[r]==-1) {
+        perm[p] = r;
+        owner[r] = p;
+      }
+    }
+
+    /*Partitions with no remaining home go to the leftover ranks*/
+    int r=0;
+    for (int p=0;p<gsize;++p) {
+      if (perm[p]!=-1) continue;
+      while (owner[r]!=-1) r++;
+      perm[p] = r;
+      owner[r] = p;
+    }
+  }
+  gcomm.Bcast(perm, 0);
+
+  /*Send our whole partition to its new rank*/
+  memory<int> Nsend(gsize, 0);
+  memory<int> Nrecv(gsize);
+  memory<int> sendOffsets(gsize, 0);
+  memory<int> recvOffsets2(gsize);
+
+  Nsend[perm[grank]] = static_cast<int>(Nverts);
+  gcomm.Alltoall(Nsend, Nrecv);
+
+  recvOffsets2[0]=0;
+  for (int r=1;r<gsize;++r) {
+    recvOffsets2[r] = recvOffsets2[r-1] + Nrecv[r-1];
+  }
+  const dlong newNverts = recvOffsets2[gsize-1] + Nrecv[gsize-1];
+
+  memory<element_t> newElements(newNverts);
+  gcomm.Alltoallv(elements, Nsend, sendOffsets,
+                  newElements, Nrecv, recvOffsets2);
+
+  elements = newElements;
+  Nverts = newNverts;
+  Nelements = newNverts;
+
+  NVertsGlobal = Nverts;
+  VoffsetL = 0;
+  VoffsetU = Nverts;
+}
+
+} //namespace paradogs
+
+} //namespace libp
@@ -47,10 +47,15 @@ void parAlmond_t::Setup(platform_t& _platform, settings_t& _settings, comm_t com
 
   //build parAlmond kernels on first construction
   buildParAlmondKernels(platform);
+
+  if (settings.compareSetting("PRECONDITIONER PRECISION", "SINGLE"))
+    buildParAlmondSingleKernels(platform);
 }
 
 void parAlmond_t::Operator(deviceMemory<dfloat>& o_rhs, deviceMemory<dfloat>& o_x) {
 
+  Profiler::Start("parAlmond Operator");
+
   if (multigrid->exact){ //call the linear solver
     int maxIter = 500;
     int verbose = settings.compareSetting("VERBOSE", "TRUE") ? 1 : 0;
@@ -60,6 +65,8 @@ void parAlmond_t::Operator(deviceMemory<dfloat>& o_rhs, deviceMemory<dfloat>& o_
   } else { //apply a multigrid cycle
     multigrid->Operator(o_rhs, o_x);
   }
+
+  Profiler::Stop("parAlmond Operator");
 }
 
 void parAlmond_t::Report() {
@@ -77,8 +84,9 @@ void parAlmond_t::Report() {
     multigrid->levels[lev]->Report();
   }
 
-  //base level
-  multigrid->coarseSolver->Report(multigrid->numLevels-1);
+  //base level, which ranks agglomerated away do not hold
+  if (multigrid->baseLevel<multigrid->idleLevel)
+    multigrid->coarseSolver->Report(multigrid->numLevels-1);
 
   if(multigrid->comm.rank()==0)
     printf("--------------------------------------------------------------------------------------------\n");
@@ -84,9 +84,12 @@ void amgLevel::setupSmoother(){
 }
 
 void amgLevel::syncToDevice(){
-  if (A.Nrows>0) A.syncToDevice();
-  if (P.Nrows>0) P.syncToDevice();
-  if (R.Nrows>0) R.syncToDevice();
+  //optionally store the level operators in single precision
+  const bool singlePrecision = settings.compareSetting("PRECONDITIONER PRECISION", "SINGLE");
+
+  if (A.Nrows>0) A.syncToDevice(singlePrecision);
+  if (P.Nrows>0) P.syncToDevice(singlePrecision);
+  if (R.Nrows>0) R.syncToDevice(singlePrecision);
 }
 
 void amgLevel::Report() {
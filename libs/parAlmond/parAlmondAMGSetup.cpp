@@ -60,15 +60,20 @@ void parAlmond_t::AMGSetup(parCOO& cooA,
   const int gCoarseSize = coarse.getTargetSize();
 
   hlong globalSize;
-  if (mg.coarsetype==COARSEEXACT) {
-    globalSize = A.globalRowStarts[size];
-  } else { //COARSEOAS
+  if (mg.coarsetype==COARSEOAS) {
     //OAS cares about Ncols for size
     globalSize = A.Ncols;
     A.comm.Allreduce(globalSize);
+  } else { //COARSEEXACT or COARSEDIRECT
+    globalSize = A.globalRowStarts[size];
   }
 
+  //rows per rank below which coarse levels are gathered onto fewer ranks
+  int agglomerationSize=0;
+  settings.getSetting("PARALMOND AGGLOMERATION SIZE", agglomerationSize);
+
   amgLevel& Lbase = mg.AddLevel<amgLevel>(A, settings);
+  amgStartLevel = mg.numLevels-1;
 
   //if the system if already small, dont create MG levels
   bool done = false;
@@ -107,9 +112,22 @@ void parAlmond_t::AMGSetup(parCOO& cooA,
                               mg.strtype, theta,
                               mg.aggtype);
 
+    bool active = true;
+    if (agglomerationSize>0)
+      active = agglomerateAmgLevel(L, Lcoarse, null, agglomerationSize);
+
     mg.AllocateLevelWorkSpace(mg.numLevels-2);
     L.syncToDevice();
 
+    //ranks agglomerated away only restrict to and prolongate from the
+    // coarse level, which the remaining ranks carry on coarsening
+    if (!active) {
+      mg.AllocateLevelWorkSpace(mg.numLevels-1);
+      mg.baseLevel = mg.numLevels-1;
+      mg.idleLevel = mg.numLevels-1;
+      break;
+    }
+
     parCSR& Acoarse = Lcoarse.A;
 
     // Increase coarsening rate as we add levels.
@@ -118,12 +136,12 @@ void parAlmond_t::AMGSetup(parCOO& cooA,
       theta=theta/2;
 
     hlong globalCoarseSize;
-    if (mg.coarsetype==COARSEEXACT) {
-      globalCoarseSize = Acoarse.globalRowStarts[size];;
-    } else { //COARSEOAS
+    if (mg.coarsetype==COARSEOAS) {
       //OAS cares about Ncols for size
       globalCoarseSize = Acoarse.Ncols;
       Acoarse.comm.Allreduce(globalCoarseSize);
+    } else { //COARSEEXACT or COARSEDIRECT
+      globalCoarseSize = Acoarse.globalRowStarts[Acoarse.comm.size()];
     }
 
     if(globalCoarseSize <= gCoarseSize || globalSize < 2*globalCoarseSize){
@@ -140,6 +158,54 @@ void parAlmond_t::AMGSetup(parCOO& cooA,
     globalSize = globalCoarseSize;
   }
 
+  //keep the coarse null space for AMGUpdate
+  coarseNullSpace = nullSpace;
+  coarseNullSpacePenalty = nullSpacePenalty;
+  coarseNull = null;
+
+  if(Comm::World().rank()==0) printf("done.\n");
+}
+
+void parAlmond_t::AMGUpdate(parCOO& cooA){
+
+  if(Comm::World().rank()==0) {printf("Updating AMG...");fflush(stdout);}
+
+  /*Get multigrid solver*/
+  multigrid_t& mg = *multigrid;
+
+  LIBP_ABORT("parAlmond::AMGUpdate called before AMGSetup",
+             mg.numLevels<=amgStartLevel);
+
+  /*Get coarse solver*/
+  coarseSolver_t& coarse = *(mg.coarseSolver);
+
+  //refill the fine matrix
+  amgLevel& L0 = mg.GetLevel<amgLevel>(amgStartLevel);
+  L0.A.updateValues(cooA);
+  L0.A.diagSetup();
+
+  for (int k=amgStartLevel;k<mg.baseLevel;k++) {
+    amgLevel& L = mg.GetLevel<amgLevel>(k);
+    amgLevel& Lcoarse = mg.GetLevel<amgLevel>(k+1);
+
+    /*Rebuild smoother*/
+    L.setupSmoother();
+
+    /*Recompute P, R, and the coarse operator*/
+    updateAmgLevel(L, Lcoarse, mg.aggtype);
+    if (k+1<mg.idleLevel) Lcoarse.A.diagSetup();
+
+    L.syncToDevice();
+  }
+
+  //ranks agglomerated away have no coarse problem
+  if (mg.baseLevel<mg.idleLevel) {
+    amgLevel& Lbase = mg.GetLevel<amgLevel>(mg.baseLevel);
+    Lbase.syncToDevice();
+    coarse.setup(Lbase.A, coarseNullSpace, coarseNull, coarseNullSpacePenalty);
+    coarse.syncToDevice();
+  }
+
   if(Comm::World().rank()==0) printf("done.\n");
 }
 
@@ -44,23 +44,28 @@ void parCSR::smoothDampedJacobi(deviceMemory<dfloat>& o_r, deviceMemory<dfloat>&
 
   deviceMemory<dfloat> o_d = o_scratch;
 
+  kernel_t& SmoothJacobiCSR  = singlePrecision ? SmoothJacobiCSRSingleKernel
+                                               : SmoothJacobiCSRKernel;
+  kernel_t& SmoothJacobiMCSR = singlePrecision ? SmoothJacobiMCSRSingleKernel
+                                               : SmoothJacobiMCSRKernel;
+
   halo.ExchangeStart(o_x, 1);
 
   // d = lambda*inv(D)*(r-A*x)
   if (diag.NrowBlocks)
-    SmoothJacobiCSRKernel(diag.NrowBlocks,
-                         diag.o_blockRowStarts, diag.o_rowStarts,
-                         diag.o_cols, diag.o_vals,
-                         lambda, o_diagInv,
-                         o_r, o_x, o_d);
+    SmoothJacobiCSR(diag.NrowBlocks,
+                   diag.o_blockRowStarts, diag.o_rowStarts,
+                   diag.o_cols, diag.o_vals,
+                   lambda, o_diagInv,
+                   o_r, o_x, o_d);
 
   halo.ExchangeFinish(o_x, 1);
 
   if (offd.NrowBlocks)
-    SmoothJacobiMCSRKernel(offd.NrowBlocks,
-                           offd.o_blockRowStarts, offd.o_mRowStarts,
-                           offd.o_rows, offd.o_cols, offd.o_vals,
-                           lambda, o_diagInv, o_x, o_d);
+    SmoothJacobiMCSR(offd.NrowBlocks,
+                     offd.o_blockRowStarts, offd.o_mRowStarts,
+                     offd.o_rows, offd.o_cols, offd.o_vals,
+                     lambda, o_diagInv, o_x, o_d);
 
   platform.linAlg().axpy(Nrows, 1.0, o_d, 1.0, o_x);
 }
@@ -80,6 +85,10 @@ void parCSR::smoothChebyshev(deviceMemory<dfloat>& o_b, deviceMemory<dfloat>& o_
   deviceMemory<dfloat> o_d = o_scratch + 0*Ncols;
   deviceMemory<dfloat> o_r = o_scratch + 1*Ncols;
 
+  kernel_t& SmoothChebyshevCSR  = singlePrecision ? SmoothChebyshevCSRSingleKernel
+                                                  : SmoothChebyshevCSRKernel;
+  kernel_t& SmoothChebyshevMCSR = singlePrecision ? SmoothChebyshevMCSRSingleKernel
+                                                  : SmoothChebyshevMCSRKernel;
 
   if(x_is_zero){ //skip the Ax if x is zero
     //r = D^{-1}b
@@ -96,19 +105,19 @@ void parCSR::smoothChebyshev(deviceMemory<dfloat>& o_b, deviceMemory<dfloat>& o_
     const dfloat beta = 1.0;
 
     if (diag.NrowBlocks)
-      SmoothChebyshevCSRKernel(diag.NrowBlocks,
-                               diag.o_blockRowStarts, diag.o_rowStarts,
-                               diag.o_cols, diag.o_vals,
-                               alpha, beta, o_diagInv,
-                               o_b, o_x, o_r);
+      SmoothChebyshevCSR(diag.NrowBlocks,
+                         diag.o_blockRowStarts, diag.o_rowStarts,
+                         diag.o_cols, diag.o_vals,
+                         alpha, beta, o_diagInv,
+                         o_b, o_x, o_r);
 
     halo.ExchangeFinish(o_x, 1);
 
     if (offd.NrowBlocks)
-      SmoothChebyshevMCSRKernel(offd.NrowBlocks,
-                               offd.o_blockRowStarts, offd.o_mRowStarts,
-                               offd.o_rows, offd.o_cols, offd.o_vals,
-                               o_diagInv, o_x, o_r);
+      SmoothChebyshevMCSR(offd.NrowBlocks,
+                         offd.o_blockRowStarts, offd.o_mRowStarts,
+                         offd.o_rows, offd.o_cols, offd.o_vals,
+                         o_diagInv, o_x, o_r);
 
     const int last_it = (ChebyshevIterations==0) ? 1 : 0;
 
@@ -128,19 +137,19 @@ void parCSR::smoothChebyshev(deviceMemory<dfloat>& o_b, deviceMemory<dfloat>& o_
     halo.ExchangeStart(o_d, 1);
 
     if (diag.NrowBlocks)
-      SmoothChebyshevCSRKernel(diag.NrowBlocks,
-                               diag.o_blockRowStarts, diag.o_rowStarts,
-                               diag.o_cols, diag.o_vals,
-                               alpha, beta, o_diagInv,
-                               o_b, o_d, o_r);
+      SmoothChebyshevCSR(diag.NrowBlocks,
+                         diag.o_blockRowStarts, diag.o_rowStarts,
+                         diag.o_cols, diag.o_vals,
+                         alpha, beta, o_diagInv,
+                         o_b, o_d, o_r);
 
     halo.ExchangeFinish(o_d, 1);
 
     if (offd.NrowBlocks)
-      SmoothChebyshevMCSRKernel(offd.NrowBlocks,
-                               offd.o_blockRowStarts, offd.o_mRowStarts,
-                               offd.o_rows, offd.o_cols, offd.o_vals,
-                               o_diagInv, o_d, o_r);
+      SmoothChebyshevMCSR(offd.NrowBlocks,
+                         offd.o_blockRowStarts, offd.o_mRowStarts,
+                         offd.o_rows, offd.o_cols, offd.o_vals,
+                         o_diagInv, o_d, o_r);
 
     const int last_it = (k==ChebyshevIterations-1) ? 1 : 0;
 
@@ -0,0 +1,232 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "parAlmond.hpp"
+#include "parAlmond/parAlmondAMGSetup.hpp"
+
+namespace libp {
+
+namespace parAlmond {
+
+//gather the entries of the rows of A for a new row and column partition.
+// Global ids are unchanged
+static parCOO redistributeEntries(parCSR& A,
+                                  memory<hlong> newRowStarts,
+                                  memory<hlong> newColStarts){
+
+  // MPI info
+  int rank = A.comm.rank();
+  int size = A.comm.size();
+
+  const hlong rowOffset = A.globalRowStarts[rank];
+  const hlong colOffset = A.globalColStarts[rank];
+
+  //count number of non-zeros we're sending
+  memory<int> sendCounts(size, 0);
+  memory<int> recvCounts(size);
+  memory<int> sendOffsets(size+1);
+  memory<int> recvOffsets(size+1);
+
+  int r=0;
+  for (dlong i=0;i<A.Nrows;i++) {
+    const hlong row = i + rowOffset;
+    while(row>=newRowStarts[r+1]) r++;
+    sendCounts[r] += A.diag.rowStarts[i+1]-A.diag.rowStarts[i];
+    sendCounts[r] += A.offd.rowStarts[i+1]-A.offd.rowStarts[i];
+  }
+
+  A.comm.Alltoall(sendCounts, recvCounts);
+
+  sendOffsets[0] = 0;
+  recvOffsets[0] = 0;
+  for (r=0;r<size;r++) {
+    sendOffsets[r+1] = sendOffsets[r]+sendCounts[r];
+    recvOffsets[r+1] = recvOffsets[r]+recvCounts[r];
+  }
+
+  //rows are ascending, so entries are already grouped by destination
+  memory<parCOO::nonZero_t> sendNonZeros(sendOffsets[size]);
+  dlong cnt=0;
+  for (dlong i=0;i<A.Nrows;i++) {
+    for (dlong jj=A.diag.rowStarts[i]; jj<A.diag.rowStarts[i+1];jj++){
+      sendNonZeros[cnt].row = i + rowOffset;
+      sendNonZeros[cnt].col = A.diag.cols[jj] + colOffset;
+      sendNonZeros[cnt].val = A.diag.vals[jj];
+      cnt++;
+    }
+    for (dlong jj=A.offd.rowStarts[i]; jj<A.offd.rowStarts[i+1];jj++){
+      sendNonZeros[cnt].row = i + rowOffset;
+      sendNonZeros[cnt].col = A.colMap[A.offd.cols[jj]];
+      sendNonZeros[cnt].val = A.offd.vals[jj];
+      cnt++;
+    }
+  }
+
+  parCOO cooA(A.platform, A.comm);
+
+  //new global partition
+  cooA.globalRowStarts = newRowStarts;
+  cooA.globalColStarts = newColStarts;
+
+  cooA.nnz = recvOffsets[size];
+  cooA.entries.malloc(cooA.nnz);
+
+  A.comm.Alltoallv(sendNonZeros, sendCounts, sendOffsets,
+                   cooA.entries, recvCounts, recvOffsets);
+
+  //sort by row
+  std::sort(cooA.entries.ptr(), cooA.entries.ptr()+cooA.nnz,
+            [](const parCOO::nonZero_t& a, const parCOO::nonZero_t& b) {
+              if (a.row < b.row) return true;
+              if (a.row > b.row) return false;
+
+              return a.col < b.col;
+            });
+
+  return cooA;
+}
+
+//move the rows of A to a new row and column partition. Global ids are unchanged
+parCSR redistribute(parCSR& A,
+                    memory<hlong> newRowStarts,
+                    memory<hlong> newColStarts){
+  parCOO cooA = redistributeEntries(A, newRowStarts, newColStarts);
+  return parCSR(cooA);
+}
+
+//move a vector of row values to a new row partition
+static memory<dfloat> redistribute(memory<dfloat> v, comm_t comm,
+                                   memory<hlong> oldRowStarts,
+                                   memory<hlong> newRowStarts,
+                                   const dlong Nlength){
+
+  int rank = comm.rank();
+  int size = comm.size();
+
+  memory<int> sendCounts(size);
+  memory<int> recvCounts(size);
+  memory<int> sendOffsets(size+1);
+  memory<int> recvOffsets(size+1);
+
+  //send the overlap of our old rows with each rank's new rows
+  sendOffsets[0] = 0;
+  recvOffsets[0] = 0;
+  for (int r=0;r<size;r++) {
+    const hlong sendStart = std::max(oldRowStarts[rank], newRowStarts[r]);
+    const hlong sendEnd   = std::min(oldRowStarts[rank+1], newRowStarts[r+1]);
+    sendCounts[r] = static_cast<int>(std::max(sendEnd-sendStart, static_cast<hlong>(0)));
+
+    const hlong recvStart = std::max(newRowStarts[rank], oldRowStarts[r]);
+    const hlong recvEnd   = std::min(newRowStarts[rank+1], oldRowStarts[r+1]);
+    recvCounts[r] = static_cast<int>(std::max(recvEnd-recvStart, static_cast<hlong>(0)));
+
+    sendOffsets[r+1] = sendOffsets[r]+sendCounts[r];
+    recvOffsets[r+1] = recvOffsets[r]+recvCounts[r];
+  }
+
+  memory<dfloat> newV(Nlength, 0.0);
+  comm.Alltoallv(v, sendCounts, sendOffsets,
+                 newV, recvCounts, recvOffsets);
+  return newV;
+}
+
+/*Coarse levels with few rows per rank spend most of their time waiting on
+  halo exchanges. When the average falls below agglomerationSize rows per
+  rank, merge groups of ranks onto their first rank. The merged level and
+  all coarser ones live on a sub-communicator of the group leaders, so the
+  ranks left without rows drop out of their collectives and halo exchanges.
+  P and R of level stay on its communicator to move vectors between the
+  two. Returns false on the ranks which drop out.*/
+bool agglomerateAmgLevel(amgLevel& level, amgLevel& coarseLevel,
+                         memory<dfloat>& null,
+                         const int agglomerationSize){
+
+  parCSR& Ac = coarseLevel.A;
+
+  const int rank = Ac.comm.rank();
+  const int size = Ac.comm.size();
+
+  const hlong globalRows = Ac.globalRowStarts[size];
+
+  if (size==1
+      || globalRows >= static_cast<hlong>(agglomerationSize)*size) return true;
+
+  const int targetRanks = static_cast<int>(std::max(globalRows/agglomerationSize,
+                                                    static_cast<hlong>(1)));
+  const int groupSize = std::min((size + targetRanks - 1)/targetRanks, size);
+
+  //each group of ranks keeps the contiguous rows of its members
+  memory<hlong> newRowStarts(size+1);
+  for (int r=0;r<size+1;r++) {
+    const int first = std::min(((r + groupSize - 1)/groupSize)*groupSize, size);
+    newRowStarts[r] = Ac.globalRowStarts[first];
+  }
+
+  parCOO cooA = redistributeEntries(Ac, newRowStarts, newRowStarts);
+
+  const bool active = (rank%groupSize==0);
+  comm_t activeComm = Ac.comm.Split(active ? 0 : 1, rank);
+
+  parCSR A;
+  if (active) {
+    //the leaders' rows, numbered over the sub-communicator
+    const int activeSize = activeComm.size();
+    memory<hlong> activeRowStarts(activeSize+1);
+    for (int r=0;r<activeSize;r++) {
+      activeRowStarts[r] = newRowStarts[r*groupSize];
+    }
+    activeRowStarts[activeSize] = globalRows;
+
+    cooA.comm = activeComm;
+    cooA.globalRowStarts = activeRowStarts;
+    cooA.globalColStarts = activeRowStarts;
+
+    A = parCSR(cooA);
+    A.diagSetup();
+  } else {
+    A = parCSR(0, 0, Ac.platform, activeComm);
+  }
+
+  //the next coarsening reuses null in place, so size it to the new columns
+  null = redistribute(null, Ac.comm, Ac.globalRowStarts, newRowStarts, A.Ncols);
+
+  level.P = redistribute(level.P, level.P.globalRowStarts, newRowStarts);
+  level.R = redistribute(level.R, newRowStarts, level.R.globalColStarts);
+  if (level.T.globalColStarts.length())
+    level.T = redistribute(level.T, level.T.globalRowStarts, newRowStarts);
+
+  coarseLevel = amgLevel(A, coarseLevel.settings);
+
+  //update the number of columns required for each level
+  level.Ncols = std::max(level.Ncols, level.R.Ncols);
+  coarseLevel.Ncols = std::max(coarseLevel.Ncols, level.P.Ncols);
+
+  return active;
+}
+
+} //namespace parAlmond
+
+} //namespace libp
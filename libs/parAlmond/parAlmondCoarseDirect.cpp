@@ -0,0 +1,483 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "parAlmond.hpp"
+#include "parAlmond/parAlmondCoarseSolver.hpp"
+
+namespace libp {
+
+namespace parAlmond {
+
+void directSolver_t::solve(deviceMemory<dfloat>& o_rhs, deviceMemory<dfloat>& o_x) {
+
+  //ranks without coarse rows have nothing to do
+  if (!N) return;
+
+  //bring the coarse rhs to the host and gather it on the root
+  o_rhs.copyTo(localRhs, N);
+  activeComm.Gatherv(localRhs, N, coarseRhs, coarseCounts, coarseOffsets, 0);
+
+  if (activeComm.rank()==0) HostSolve();
+
+  activeComm.Scatterv(coarseX, coarseCounts, coarseOffsets, localX, N, 0);
+  o_x.copyFrom(localX, N);
+}
+
+void directSolver_t::HostSolve() {
+
+  const int n = coarseTotal;
+
+  //remove the null space component from the rhs
+  dfloat beta = 0.0;
+  if (nullSpace) {
+    for (int i=0;i<n;i++) beta += nullTotal[i]*coarseRhs[i];
+    for (int i=0;i<n;i++) coarseRhs[i] -= beta*nullTotal[i];
+    coarseRhs[pinnedRow] = 0.0;
+  }
+
+  //permute
+  for (int k=0;k<n;k++) work[k] = coarseRhs[perm[k]];
+
+  //forward solve with L
+  for (int j=0;j<n;j++) {
+    const dfloat wj = work[j];
+    for (hlong p=Lstarts[j];p<Lstarts[j+1];p++) {
+      work[Lrows[p]] -= Lvals[p]*wj;
+    }
+  }
+
+  //diagonal solve
+  for (int j=0;j<n;j++) work[j] /= D[j];
+
+  //backward solve with L^T
+  for (int j=n-1;j>=0;j--) {
+    dfloat wj = work[j];
+    for (hlong p=Lstarts[j];p<Lstarts[j+1];p++) {
+      wj -= Lvals[p]*work[Lrows[p]];
+    }
+    work[j] = wj;
+  }
+
+  //unpermute
+  for (int k=0;k<n;k++) coarseX[perm[k]] = work[k];
+
+  //project the pinned solution off the null space and add back the
+  // penalized null space component
+  if (nullSpace) {
+    dfloat gamma = 0.0;
+    for (int i=0;i<n;i++) gamma += nullTotal[i]*coarseX[i];
+
+    const dfloat alpha = beta/nullSpacePenalty - gamma;
+    for (int i=0;i<n;i++) coarseX[i] += alpha*nullTotal[i];
+  }
+}
+
+int directSolver_t::getTargetSize() {
+  int targetSize=10000;
+  settings.getSetting("PARALMOND COARSE SIZE", targetSize);
+  return targetSize;
+}
+
+void directSolver_t::setup(parCSR& _A, bool _nullSpace,
+                           memory<dfloat> nullVector, dfloat _nullSpacePenalty) {
+
+  A = _A;
+
+  comm = A.comm;
+  rank = comm.rank();
+  size = comm.size();
+
+  N = static_cast<int>(A.Nrows);
+  Nrows = A.Nrows;
+  Ncols = A.Ncols;
+
+  nullSpace = _nullSpace;
+  nullSpacePenalty = _nullSpacePenalty;
+
+  //only ranks holding coarse rows take part in the coarse solve
+  activeComm = comm.Split((N>0) ? 0 : 1, rank);
+  if (!N) return;
+
+  const int activeSize = activeComm.size();
+  const int root = (activeComm.rank()==0);
+
+  coarseTotal = static_cast<int>(A.globalRowStarts[size]);
+  const hlong coarseOffset = A.globalRowStarts[rank];
+
+  coarseCounts.malloc(activeSize);
+  coarseOffsets.malloc(activeSize+1, 0);
+  activeComm.Allgather(N, coarseCounts);
+  for (int r=0;r<activeSize;r++) {
+    coarseOffsets[r+1] = coarseOffsets[r] + coarseCounts[r];
+  }
+
+  int sendNNZ = static_cast<int>(A.diag.nnz+A.offd.nnz);
+
+  memory<parCOO::nonZero_t> sendNonZeros(sendNNZ);
+
+  //populate matrix
+  int cnt = 0;
+  for (int n=0;n<N;n++) {
+    const int start = static_cast<int>(A.diag.rowStarts[n]);
+    const int end   = static_cast<int>(A.diag.rowStarts[n+1]);
+    for (int m=start;m<end;m++) {
+      sendNonZeros[cnt].row = n + coarseOffset;
+      sendNonZeros[cnt].col = A.diag.cols[m] + coarseOffset;
+      sendNonZeros[cnt].val = A.diag.vals[m];
+      cnt++;
+    }
+  }
+
+  for (int n=0;n<A.offd.nzRows;n++) {
+    const int row   = static_cast<int>(A.offd.rows[n]);
+    const int start = static_cast<int>(A.offd.mRowStarts[n]);
+    const int end   = static_cast<int>(A.offd.mRowStarts[n+1]);
+    for (int m=start;m<end;m++) {
+      sendNonZeros[cnt].row = row + coarseOffset;
+      sendNonZeros[cnt].col = A.colMap[A.offd.cols[m]];
+      sendNonZeros[cnt].val = A.offd.vals[m];
+      cnt++;
+    }
+  }
+
+  //gather the nonzeros on the root
+  memory<int> recvNNZ(activeSize);
+  memory<int> NNZoffsets(activeSize+1,0);
+  activeComm.Allgather(sendNNZ, recvNNZ);
+
+  for (int r=0;r<activeSize;r++) {
+    NNZoffsets[r+1] = NNZoffsets[r] + recvNNZ[r];
+  }
+  const int totalNNZ = NNZoffsets[activeSize];
+
+  memory<parCOO::nonZero_t> recvNonZeros(root ? totalNNZ : 0);
+  activeComm.Gatherv(sendNonZeros, sendNNZ,
+                     recvNonZeros, recvNNZ, NNZoffsets, 0);
+
+  //gather null vector
+  if (nullSpace) {
+    nullTotal.malloc(root ? coarseTotal : 0);
+    activeComm.Gatherv(nullVector, N,
+                       nullTotal, coarseCounts, coarseOffsets, 0);
+  }
+
+  localRhs.malloc(N);
+  localX.malloc(N);
+
+  if (root) {
+    coarseRhs.malloc(coarseTotal);
+    coarseX.malloc(coarseTotal);
+    work.malloc(coarseTotal);
+
+    Factor(recvNonZeros, totalNNZ);
+  }
+}
+
+//nested dissection ordering from level set separators
+static void nestedDissectionOrdering(const int n,
+                                     memory<int> rowStarts,
+                                     memory<int> cols,
+                                     memory<int> perm) {
+
+  //small subgraphs are ordered as they are
+  constexpr int leafSize = 64;
+
+  //nodes of the subgraph being split carry its id, -1 once ordered
+  std::vector<int> part(n, 0);
+  std::vector<int> level(n, -1);
+
+  struct subgraph_t {
+    std::vector<int> nodes;
+    int start; //first position in the ordering
+    int id;
+  };
+
+  std::vector<subgraph_t> stack;
+  {
+    subgraph_t g;
+    g.nodes.resize(n);
+    for (int i=0;i<n;i++) g.nodes[i] = i;
+    g.start = 0;
+    g.id = 0;
+    stack.push_back(std::move(g));
+  }
+  int Nparts = 1;
+
+  std::vector<int> queue;
+
+  //breadth first search in part id from root, returns the last node reached
+  auto bfs = [&](const int root, const int id) {
+    queue.clear();
+    queue.push_back(root);
+    level[root] = 0;
+    for (size_t q=0;q<queue.size();q++) {
+      const int i = queue[q];
+      for (int j=rowStarts[i];j<rowStarts[i+1];j++) {
+        const int c = cols[j];
+        if (part[c]==id && level[c]==-1) {
+          level[c] = level[i]+1;
+          queue.push_back(c);
+        }
+      }
+    }
+    return queue.back();
+  };
+
+  while (!stack.empty()) {
+    subgraph_t g = std::move(stack.back());
+    stack.pop_back();
+
+    const int Ng = static_cast<int>(g.nodes.size());
+
+    //pseudo-peripheral root from two sweeps
+    int root = bfs(g.nodes[0], g.id);
+    for (const int i : queue) level[i] = -1;
+    bfs(root, g.id);
+
+    const int Nreached = static_cast<int>(queue.size());
+    const int depth = level[queue.back()];
+
+    if (Ng <= leafSize || (Nreached==Ng && depth<2)) {
+      for (int i=0;i<Ng;i++) {
+        perm[g.start+i] = g.nodes[i];
+        part[g.nodes[i]] = -1;
+        level[g.nodes[i]] = -1;
+      }
+      continue;
+    }
+
+    //split at the level holding the median node. Unreached nodes of a
+    // disconnected subgraph form their own part
+    int sepLevel = depth+1;
+    if (Nreached==Ng) sepLevel = level[queue[Ng/2]];
+
+    subgraph_t g1, g2;
+    g1.id = Nparts++;
+    g2.id = Nparts++;
+    std::vector<int> separator;
+    for (const int i : g.nodes) {
+      if (level[i]==-1 || level[i]>sepLevel) g2.nodes.push_back(i);
+      else if (level[i]<sepLevel)            g1.nodes.push_back(i);
+      else                                   separator.push_back(i);
+    }
+    for (const int i : g.nodes) level[i] = -1;
+    for (const int i : g1.nodes) part[i] = g1.id;
+    for (const int i : g2.nodes) part[i] = g2.id;
+
+    //separator is ordered last
+    g1.start = g.start;
+    g2.start = g.start + static_cast<int>(g1.nodes.size());
+    int k = g2.start + static_cast<int>(g2.nodes.size());
+    for (const int i : separator) {
+      perm[k++] = i;
+      part[i] = -1;
+    }
+
+    if (g1.nodes.size()) stack.push_back(std::move(g1));
+    if (g2.nodes.size()) stack.push_back(std::move(g2));
+  }
+}
+
+void directSolver_t::Factor(memory<parCOO::nonZero_t> entries, const int nnz) {
+
+  const int n = coarseTotal;
+
+  //a singular operator is factored with the row and column of its
+  // largest null vector entry replaced by the identity
+  if (nullSpace) {
+    dfloat norm = 0.0;
+    for (int i=0;i<n;i++) norm += nullTotal[i]*nullTotal[i];
+    norm = sqrt(norm);
+
+    LIBP_ABORT("parAlmond: null vector of coarse operator is zero",
+               norm==0.0);
+
+    pinnedRow = 0;
+    for (int i=0;i<n;i++) {
+      nullTotal[i] /= norm;
+      if (std::abs(nullTotal[i]) > std::abs(nullTotal[pinnedRow])) pinnedRow = i;
+    }
+  }
+
+  //assemble the coarse operator in CSR form
+  memory<int> rowStarts(n+1, 0);
+  for (int i=0;i<nnz;i++) {
+    const int row = static_cast<int>(entries[i].row);
+    const int col = static_cast<int>(entries[i].col);
+    if (row!=pinnedRow && col!=pinnedRow) rowStarts[row+1]++;
+  }
+  if (nullSpace) rowStarts[pinnedRow+1]++;
+
+  for (int i=0;i<n;i++) rowStarts[i+1] += rowStarts[i];
+
+  memory<int> cols(rowStarts[n]);
+  memory<dfloat> vals(rowStarts[n]);
+  memory<int> rowCnt(n, 0);
+  for (int i=0;i<nnz;i++) {
+    const int row = static_cast<int>(entries[i].row);
+    const int col = static_cast<int>(entries[i].col);
+    if (row!=pinnedRow && col!=pinnedRow) {
+      const int id = rowStarts[row] + rowCnt[row]++;
+      cols[id] = col;
+      vals[id] = entries[i].val;
+    }
+  }
+  if (nullSpace) {
+    const int id = rowStarts[pinnedRow];
+    cols[id] = pinnedRow;
+    vals[id] = 1.0;
+  }
+
+  //fill-reducing ordering
+  perm.malloc(n);
+  nestedDissectionOrdering(n, rowStarts, cols, perm);
+
+  memory<int> permInv(n);
+  for (int k=0;k<n;k++) permInv[perm[k]] = k;
+
+  /*Symbolic LDL^T: elimination tree and column counts of L. The operator is
+    symmetric, so row perm[k] of the CSR matrix is column k of the permuted
+    matrix.*/
+  memory<int> parent(n);
+  memory<int> flag(n);
+  memory<int> Lnz(n);
+  for (int k=0;k<n;k++) {
+    parent[k] = -1;
+    flag[k] = k;
+    Lnz[k] = 0;
+    const int kk = perm[k];
+    for (int p=rowStarts[kk];p<rowStarts[kk+1];p++) {
+      int i = permInv[cols[p]];
+      if (i < k) {
+        //follow the path up the elimination tree
+        for (; flag[i]!=k; i=parent[i]) {
+          if (parent[i]==-1) parent[i] = k;
+          Lnz[i]++;
+          flag[i] = k;
+        }
+      }
+    }
+  }
+
+  Lstarts.malloc(n+1);
+  Lstarts[0] = 0;
+  for (int k=0;k<n;k++) Lstarts[k+1] = Lstarts[k] + Lnz[k];
+
+  Lrows.malloc(Lstarts[n]);
+  Lvals.malloc(Lstarts[n]);
+  D.malloc(n);
+
+  /*Numeric LDL^T: row k of L from a sparse triangular solve whose
+    pattern is the reach of row k in the elimination tree*/
+  memory<dfloat> y(n, 0.0);
+  memory<int> pattern(n);
+  for (int k=0;k<n;k++) {
+    int top = n;
+    flag[k] = k;
+    Lnz[k] = 0;
+    const int kk = perm[k];
+    for (int p=rowStarts[kk];p<rowStarts[kk+1];p++) {
+      int i = permInv[cols[p]];
+      if (i <= k) {
+        y[i] += vals[p];
+        int len = 0;
+        for (; flag[i]!=k; i=parent[i]) {
+          pattern[len++] = i;
+          flag[i] = k;
+        }
+        while (len > 0) pattern[--top] = pattern[--len];
+      }
+    }
+
+    D[k] = y[k];
+    y[k] = 0.0;
+    for (; top<n; top++) {
+      const int i = pattern[top];
+      const dfloat yi = y[i];
+      y[i] = 0.0;
+      const hlong p2 = Lstarts[i] + Lnz[i];
+      for (hlong p=Lstarts[i];p<p2;p++) {
+        y[Lrows[p]] -= Lvals[p]*yi;
+      }
+      const dfloat lki = yi/D[i];
+      D[k] -= lki*yi;
+      Lrows[p2] = k;
+      Lvals[p2] = lki;
+      Lnz[i]++;
+    }
+
+    LIBP_ABORT("parAlmond: zero pivot in coarse LDL^T factorization at row " << k,
+               D[k]==0.0);
+  }
+}
+
+void directSolver_t::syncToDevice() {}
+
+void directSolver_t::Report(int lev) {
+
+  int totalActive = (N>0) ? 1:0;
+  comm.Allreduce(totalActive, Comm::Sum);
+
+  dlong minNrows=N, maxNrows=N;
+  hlong totalNrows=N;
+  comm.Allreduce(maxNrows, Comm::Max);
+  comm.Allreduce(totalNrows, Comm::Sum);
+  dfloat avgNrows = (dfloat) totalNrows/totalActive;
+
+  if (N==0) minNrows=maxNrows; //set this so it's ignored for the global min
+  comm.Allreduce(minNrows, Comm::Min);
+
+  long long int nnz;
+  nnz = A.diag.nnz+A.offd.nnz;
+
+  long long int minNnz=nnz, maxNnz=nnz, totalNnz=nnz;
+  comm.Allreduce(maxNnz,   Comm::Max);
+  comm.Allreduce(totalNnz, Comm::Sum);
+
+  if (nnz==0) minNnz = maxNnz; //set this so it's ignored for the global min
+  comm.Allreduce(minNnz, Comm::Min);
+
+  dfloat nnzPerRow = (Nrows==0) ? 0 : (dfloat) nnz/Nrows;
+  dfloat minNnzPerRow=nnzPerRow, maxNnzPerRow=nnzPerRow, avgNnzPerRow=nnzPerRow;
+  comm.Allreduce(maxNnzPerRow, Comm::Max);
+  comm.Allreduce(avgNnzPerRow, Comm::Sum);
+  avgNnzPerRow /= totalActive;
+
+  if (Nrows==0) minNnzPerRow = maxNnzPerRow;
+  comm.Allreduce(minNnzPerRow, Comm::Min);
+
+  std::string name = "Direct Solve    ";
+
+  if (rank==0){
+    printf(" %3d  |  parAlmond |  %12lld  |  %12d  | %13d   |   %s|\n", lev, (long long int)totalNrows, minNrows, (int)minNnzPerRow, name.c_str());
+    printf("      |            |                |  %12d  | %13d   |                   |\n", maxNrows, (int)maxNnzPerRow);
+    printf("      |            |                |  %12d  | %13d   |                   |\n", (int)avgNrows, (int)avgNnzPerRow);
+  }
+}
+
+} //namespace parAlmond
+
+} //namespace libp
@@ -53,6 +53,7 @@ amgLevel coarsenAmgLevel(amgLevel& level, memory<dfloat>& null,
   parCSR T = tentativeProlongator(A, FineToCoarse, globalAggStarts, null);
   if (aggtype == SMOOTHED) {
     P = smoothProlongator(A, T);
+    level.T = T; //kept for numeric re-setups
   } else {
     P = T;
   }
@@ -82,6 +83,28 @@ amgLevel coarsenAmgLevel(amgLevel& level, memory<dfloat>& null,
   return coarseLevel;
 }
 
+/*Recompute the values of P, R, and the coarse operator of a level
+  coarsened by coarsenAmgLevel after the values of level.A change.
+  The aggregates and all sparsity patterns are reused. The caller redoes
+  the diagonal setup of the coarse operator on the ranks holding it.*/
+void updateAmgLevel(amgLevel& level, amgLevel& coarseLevel,
+                    AggType aggtype){
+
+  parCSR& A = level.A;
+
+  if (aggtype == SMOOTHED) {
+    smoothProlongatorNumeric(A, level.T, level.P, level.Tplan);
+    transposeNumeric(level.P, level.R, level.Rplan);
+  }
+  //for unsmoothed aggregation P and R depend only on the null vector
+
+  //A*P is only built on the first update
+  if (!level.Pplan.ready) level.AP = SpMM(A, level.P);
+
+  SpMMNumeric(A, level.P, level.AP, level.Pplan);
+  SpMMNumeric(level.R, level.AP, coarseLevel.A, level.APplan);
+}
+
 } //namespace parAlmond
 
 } //namespace libp
@@ -56,7 +56,9 @@ void multigrid_t::kcycle(const int k, deviceMemory<dfloat>& o_RHS, deviceMemory<
   // rhsC = P^T res
   level.coarsen(o_RES, o_RHSC);
 
-  if(k+1>NUMKCYCLES) {
+  if(k+1>=idleLevel) {
+    //agglomerated away, the prolongation fills in our halo of xC
+  } else if(k+1>NUMKCYCLES) {
     vcycle(k+1, o_RHSC, o_XC);
   } else{
     // first inner krylov iteration
@@ -180,7 +182,7 @@ void multigrid_t::kcycleCombinedOp1(multigridLevel& level,
     reductionScratch[1] += reductionScratch[3*i+1];
     reductionScratch[2] += reductionScratch[3*i+2];
   }
-  comm.Allreduce(reductionScratch, Comm::Sum, 3);
+  level.comm.Allreduce(reductionScratch, Comm::Sum, 3);
   aDotb = reductionScratch[0];
   aDotc = reductionScratch[1];
   bDotb = reductionScratch[2];
@@ -214,7 +216,7 @@ void multigrid_t::kcycleCombinedOp2(multigridLevel& level,
     reductionScratch[1] += reductionScratch[3*i+1];
     reductionScratch[2] += reductionScratch[3*i+2];
   }
-  comm.Allreduce(reductionScratch, Comm::Sum, 3);
+  level.comm.Allreduce(reductionScratch, Comm::Sum, 3);
   aDotb = reductionScratch[0];
   aDotc = reductionScratch[1];
   aDotd = reductionScratch[2];
@@ -240,7 +242,7 @@ dfloat multigrid_t::vectorAddInnerProd(multigridLevel& level,
   for (dlong i=1; i<numBlocks; i++) {
     reductionScratch[0] += reductionScratch[i];
   }
-  comm.Allreduce(reductionScratch, Comm::Sum, 1);
+  level.comm.Allreduce(reductionScratch, Comm::Sum, 1);
   return reductionScratch[0];
 }
 
@@ -43,6 +43,16 @@ kernel_t SmoothChebyshevCSRKernel;
 kernel_t SmoothChebyshevMCSRKernel;
 kernel_t SmoothChebyshevUpdateKernel;
 
+kernel_t SpMVcsrSingleKernel1;
+kernel_t SpMVcsrSingleKernel2;
+kernel_t SpMVmcsrSingleKernel;
+
+kernel_t SmoothJacobiCSRSingleKernel;
+kernel_t SmoothJacobiMCSRSingleKernel;
+
+kernel_t SmoothChebyshevCSRSingleKernel;
+kernel_t SmoothChebyshevMCSRSingleKernel;
+
 kernel_t kcycleCombinedOp1Kernel;
 kernel_t kcycleCombinedOp2Kernel;
 kernel_t vectorAddInnerProdKernel;
@@ -88,6 +98,35 @@ void buildParAlmondKernels(platform_t& platform){
   }
 }
 
+void buildParAlmondSingleKernels(platform_t& platform){
+
+  if (SpMVcsrSingleKernel1.isInitialized()==false) {
+    int rank=platform.rank();
+
+    //build kernels with the matrix values stored in float. Vectors
+    // and accumulation stay in dfloat
+    properties_t kernelInfo = platform.props();
+
+    kernelInfo["defines/" "p_BLOCKSIZE"]= blockSize;
+    kernelInfo["defines/" "p_NonzerosPerBlock"]= NonzerosPerBlock;
+    kernelInfo["defines/" "pfloat"]= "float";
+
+    if (rank==0) {printf("Compiling single precision parALMOND Kernels...");fflush(stdout);}
+
+    SpMVcsrSingleKernel1  = platform.buildKernel(PARALMOND_DIR"/okl/SpMVcsr.okl",  "SpMVcsr1",  kernelInfo);
+    SpMVcsrSingleKernel2  = platform.buildKernel(PARALMOND_DIR"/okl/SpMVcsr.okl",  "SpMVcsr2",  kernelInfo);
+    SpMVmcsrSingleKernel  = platform.buildKernel(PARALMOND_DIR"/okl/SpMVmcsr.okl", "SpMVmcsr1", kernelInfo);
+
+    SmoothJacobiCSRSingleKernel  = platform.buildKernel(PARALMOND_DIR"/okl/SmoothJacobi.okl", "SmoothJacobiCSR", kernelInfo);
+    SmoothJacobiMCSRSingleKernel = platform.buildKernel(PARALMOND_DIR"/okl/SmoothJacobi.okl", "SmoothJacobiMCSR", kernelInfo);
+
+    SmoothChebyshevCSRSingleKernel  = platform.buildKernel(PARALMOND_DIR"/okl/SmoothChebyshev.okl", "SmoothChebyshevCSR", kernelInfo);
+    SmoothChebyshevMCSRSingleKernel = platform.buildKernel(PARALMOND_DIR"/okl/SmoothChebyshev.okl", "SmoothChebyshevMCSR", kernelInfo);
+
+    if(rank==0) printf("done.\n");
+  }
+}
+
 } //namespace parAlmond
 
 } //namespace libp
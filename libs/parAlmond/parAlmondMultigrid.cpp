@@ -77,11 +77,17 @@ multigrid_t::multigrid_t(platform_t& _platform, settings_t& _settings,
   else
     exact = false;
 
-  //Hard code for now
-  coarsetype=COARSEEXACT;
+  //coarse solver type
+  if(settings.compareSetting("PARALMOND COARSE SOLVER", "DIRECT")) {
+    coarsetype = COARSEDIRECT;
+  } else {
+    coarsetype = COARSEEXACT;
+  }
 
   if (coarsetype==COARSEEXACT) {
     coarseSolver = std::make_shared<exactSolver_t>(_platform, _settings, _comm);
+  } else if (coarsetype==COARSEDIRECT) {
+    coarseSolver = std::make_shared<directSolver_t>(_platform, _settings, _comm);
   } else {
     coarseSolver = std::make_shared<oasSolver_t>(_platform, _settings, _comm);
   }
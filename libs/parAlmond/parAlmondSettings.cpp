@@ -57,6 +57,19 @@ void AddSettings(settings_t& settings,
                       "2",
                       "Number of Chebyshev iteration to run in smoother");
 
+  settings.newSetting(prefix+"PARALMOND COARSE SOLVER",
+                      "EXACT",
+                      "Type of solver on the coarsest level",
+                      {"EXACT", "DIRECT"});
+
+  settings.newSetting(prefix+"PARALMOND COARSE SIZE",
+                      "10000",
+                      "Target global size of the coarsest level for the DIRECT coarse solver");
+
+  settings.newSetting(prefix+"PARALMOND AGGLOMERATION SIZE",
+                      "0",
+                      "Rows per rank below which coarse levels are gathered onto fewer ranks (0 to disable)");
+
 }
 
 void ReportSettings(settings_t& settings) {
@@ -67,6 +80,12 @@ void ReportSettings(settings_t& settings) {
 
   if (settings.compareSetting("PARALMOND SMOOTHER","CHEBYSHEV"))
     settings.reportSetting("PARALMOND CHEBYSHEV DEGREE");
+
+  settings.reportSetting("PARALMOND COARSE SOLVER");
+  if (settings.compareSetting("PARALMOND COARSE SOLVER","DIRECT"))
+    settings.reportSetting("PARALMOND COARSE SIZE");
+
+  settings.reportSetting("PARALMOND AGGLOMERATION SIZE");
 }
 
 } //namespace parAlmond
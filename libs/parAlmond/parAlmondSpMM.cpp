@@ -26,6 +26,7 @@ SOFTWARE.
 
 #include "parAlmond.hpp"
 #include "parAlmond/parAlmondAMGSetup.hpp"
+#include "spgemm.hpp"
 
 namespace libp {
 
@@ -124,138 +125,242 @@ parCSR SpMM(parCSR& A, parCSR& B){
 
   //we now have all the needed nonlocal rows (should also be sorted by row then col)
 
-  //make an array of row offsets so we know how large each row is
-  memory<dlong> BoffdRowOffsets(A.Ncols-A.NlocalCols+1, 0);
+  // List the rows of B indexed by the columns of A, local rows first
+  // then the recieved rows in halo order, with global column ids
+  csrRows_t Brows;
+  Brows.Nrows = A.Ncols;
+  Brows.nnz = B.diag.nnz + B.offd.nnz + Boffdnnz;
+  Brows.rowStarts.malloc(A.Ncols+1);
+  Brows.cols.malloc(Brows.nnz);
+  Brows.vals.malloc(Brows.nnz);
+
+  dlong cnt = 0;
+  Brows.rowStarts[0] = 0;
+  for (dlong i=0;i<B.Nrows;i++) {
+    for (dlong jj=B.diag.rowStarts[i]; jj<B.diag.rowStarts[i+1];jj++){
+      Brows.cols[cnt] = B.diag.cols[jj] + B.globalColStarts[rank]; //global id
+      Brows.vals[cnt] = B.diag.vals[jj];
+      cnt++;
+    }
+    for (dlong jj=B.offd.rowStarts[i]; jj<B.offd.rowStarts[i+1];jj++){
+      Brows.cols[cnt] = B.colMap[B.offd.cols[jj]]; //global id
+      Brows.vals[cnt] = B.offd.vals[jj];
+      cnt++;
+    }
+    Brows.rowStarts[i+1] = cnt;
+  }
 
   dlong id=0;
   for (dlong n=0;n<Boffdnnz;n++) {
-    hlong row = BoffdRows[n].row;
+    const hlong row = BoffdRows[n].row;
 
-    while(A.colMap[id+A.NlocalCols]!=row) id++;
+    while(A.colMap[id+A.NlocalCols]!=row) {
+      Brows.rowStarts[id+A.NlocalCols+1] = cnt; //close finished rows
+      id++;
+    }
 
-    BoffdRowOffsets[id+1]++; //count entry in row
+    Brows.cols[cnt] = BoffdRows[n].col; //global id
+    Brows.vals[cnt] = BoffdRows[n].val;
+    cnt++;
   }
+  for (dlong n=id+A.NlocalCols;n<A.Ncols;n++)
+    Brows.rowStarts[n+1] = cnt;
 
-  //cumulative sum
-  for (dlong n=0;n<A.Ncols-A.NlocalCols;n++)
-    BoffdRowOffsets[n+1] += BoffdRowOffsets[n];
+  // Form C = A*B row by row
+  csrRows_t Crows = SpGEMM(A.Nrows,
+                           A.diag.rowStarts, A.diag.cols, A.diag.vals,
+                           A.offd.rowStarts, A.offd.cols, A.offd.vals,
+                           Brows);
+
+  parCOO cooC(A.platform, A.comm);
 
+  //copy global partition
+  cooC.globalRowStarts = A.globalRowStarts;
+  cooC.globalColStarts = B.globalColStarts;
 
-  // The next step to compute C = A*B is to multiply each entry A(i,j) by the
-  // row B(j,:), store the all the results, sort them by row+col, and compress
-  // the entries
+  cooC.nnz = Crows.nnz;
+  cooC.entries.malloc(cooC.nnz);
 
-  // Find how big the intermediate form is
-  nnzTotal = 0;
+  #pragma omp parallel for
   for (dlong i=0;i<A.Nrows;i++) {
-    //local entries
-    dlong start = A.diag.rowStarts[i];
-    dlong end   = A.diag.rowStarts[i+1];
-    for (dlong j=start;j<end;j++) {
-      const dlong col = A.diag.cols[j];
-      const int nnzBj =  B.diag.rowStarts[col+1]-B.diag.rowStarts[col]
-                        +B.offd.rowStarts[col+1]-B.offd.rowStarts[col];
-      nnzTotal += nnzBj;
+    for (dlong jj=Crows.rowStarts[i];jj<Crows.rowStarts[i+1];jj++) {
+      cooC.entries[jj].row = i + A.globalRowStarts[rank];
+      cooC.entries[jj].col = Crows.cols[jj];
+      cooC.entries[jj].val = Crows.vals[jj];
     }
-    //non-local entries
-    start = A.offd.rowStarts[i];
-    end   = A.offd.rowStarts[i+1];
-    for (dlong j=start;j<end;j++) {
-      const dlong col = A.offd.cols[j]-A.NlocalCols;
-      const int nnzBj = BoffdRowOffsets[col+1] - BoffdRowOffsets[col];
-      nnzTotal += nnzBj;
+  }
+
+  //build C from coo matrix
+  return parCSR(cooC);
+}
+
+/*Numeric-only product C = A*B, where the sparsity pattern of C was
+  previously built by SpMM(A,B). The exchange of the needed rows of B
+  is recorded in plan on the first call, and later calls only
+  communicate values.*/
+void SpMMNumeric(parCSR& A, parCSR& B, parCSR& C, productPlan_t& plan){
+
+  // MPI info
+  int rank = A.comm.rank();
+  int size = A.comm.size();
+
+  const dlong Nhalo = A.Ncols-A.NlocalCols;
+
+  if (!plan.ready) {
+    //request the rows of B for the halo columns of A, as in SpMM
+    memory<hlong> recvRows(Nhalo);
+    memory<int> rowSendCounts(size);
+    memory<int> rowRecvCounts(size, 0);
+    memory<int> rowSendOffsets(size+1);
+    memory<int> rowRecvOffsets(size+1);
+
+    int r=0;
+    for (dlong n=A.NlocalCols;n<A.Ncols;n++) {
+      const hlong id = A.colMap[n];
+      while (id>=B.globalRowStarts[r+1]) r++; //assumes the halo is sorted
+      rowRecvCounts[r]++;
+      recvRows[n-A.NlocalCols] = id;
     }
+
+    A.comm.Alltoall(rowRecvCounts, rowSendCounts);
+
+    rowSendOffsets[0] = 0;
+    rowRecvOffsets[0] = 0;
+    for (r=0;r<size;r++) {
+      rowSendOffsets[r+1] = rowSendOffsets[r]+rowSendCounts[r];
+      rowRecvOffsets[r+1] = rowRecvOffsets[r]+rowRecvCounts[r];
+    }
+
+    const dlong NsendRows = rowSendOffsets[size];
+    memory<hlong> sendRows(NsendRows);
+
+    A.comm.Alltoallv(recvRows, rowRecvCounts, rowRecvOffsets,
+                     sendRows, rowSendCounts, rowSendOffsets);
+
+    //record the local rows to send and their lengths
+    plan.sendRows.malloc(NsendRows);
+    plan.sendCounts.malloc(size);
+    plan.recvCounts.malloc(size);
+    plan.sendOffsets.malloc(size+1);
+    plan.recvOffsets.malloc(size+1);
+
+    memory<dlong> sendLengths(NsendRows);
+    for (r=0;r<size;r++) {
+      plan.sendCounts[r] = 0;
+      for (int n=rowSendOffsets[r];n<rowSendOffsets[r+1];n++) {
+        const dlong i = static_cast<dlong>(sendRows[n]-B.globalRowStarts[rank]); //local row id
+        plan.sendRows[n] = i;
+        sendLengths[n] = B.diag.rowStarts[i+1]-B.diag.rowStarts[i]
+                        +B.offd.rowStarts[i+1]-B.offd.rowStarts[i];
+        plan.sendCounts[r] += sendLengths[n];
+      }
+    }
+
+    memory<dlong> recvLengths(Nhalo);
+    A.comm.Alltoallv(sendLengths, rowSendCounts, rowSendOffsets,
+                     recvLengths, rowRecvCounts, rowRecvOffsets);
+
+    A.comm.Alltoall(plan.sendCounts, plan.recvCounts);
+
+    plan.sendOffsets[0] = 0;
+    plan.recvOffsets[0] = 0;
+    for (r=0;r<size;r++) {
+      plan.sendOffsets[r+1] = plan.sendOffsets[r]+plan.sendCounts[r];
+      plan.recvOffsets[r+1] = plan.recvOffsets[r]+plan.recvCounts[r];
+    }
+
+    //rows arrive in the order of the halo columns of A
+    plan.recvRowStarts.malloc(Nhalo+1);
+    plan.recvRowStarts[0] = 0;
+    for (dlong n=0;n<Nhalo;n++)
+      plan.recvRowStarts[n+1] = plan.recvRowStarts[n]+recvLengths[n];
+
+    //share the global column ids once
+    memory<hlong> sendCols(plan.sendOffsets[size]);
+    dlong cnt=0;
+    for (dlong n=0;n<NsendRows;n++) {
+      const dlong i = plan.sendRows[n];
+      for (dlong jj=B.diag.rowStarts[i]; jj<B.diag.rowStarts[i+1];jj++)
+        sendCols[cnt++] = B.diag.cols[jj] + B.globalColStarts[rank];
+      for (dlong jj=B.offd.rowStarts[i]; jj<B.offd.rowStarts[i+1];jj++)
+        sendCols[cnt++] = B.colMap[B.offd.cols[jj]];
+    }
+
+    memory<hlong> recvCols(plan.recvOffsets[size]);
+    A.comm.Alltoallv(sendCols, plan.sendCounts, plan.sendOffsets,
+                     recvCols, plan.recvCounts, plan.recvOffsets);
+
+    //map them to the columns of C
+    plan.recvCols.malloc(plan.recvOffsets[size]);
+    for (dlong n=0;n<plan.recvOffsets[size];n++) {
+      plan.recvCols[n] = C.colIndex(recvCols[n]);
+      LIBP_ABORT("SpMMNumeric: sparsity pattern of C does not match A*B",
+                 plan.recvCols[n]<0);
+    }
+
+    plan.ready = true;
   }
 
-  memory<parCOO::nonZero_t> Ctmp(nnzTotal);
+  //exchange the values of the needed rows of B
+  const dlong NsendRows = static_cast<dlong>(plan.sendRows.length());
+  memory<dfloat> sendVals(plan.sendOffsets[size]);
+  dlong cnt=0;
+  for (dlong n=0;n<NsendRows;n++) {
+    const dlong i = plan.sendRows[n];
+    for (dlong jj=B.diag.rowStarts[i]; jj<B.diag.rowStarts[i+1];jj++)
+      sendVals[cnt++] = B.diag.vals[jj];
+    for (dlong jj=B.offd.rowStarts[i]; jj<B.offd.rowStarts[i+1];jj++)
+      sendVals[cnt++] = B.offd.vals[jj];
+  }
+
+  memory<dfloat> recvVals(plan.recvOffsets[size]);
+  A.comm.Alltoallv(sendVals, plan.sendCounts, plan.sendOffsets,
+                   recvVals, plan.recvCounts, plan.recvOffsets);
+
+  //map the halo columns of B to the columns of C. Ranks without rows of
+  // C, e.g. ranks agglomerated away, have nothing to map
+  memory<dlong> BoffdCols(B.Ncols-B.NlocalCols);
+  if (A.Nrows>0) {
+    for (dlong n=B.NlocalCols;n<B.Ncols;n++) {
+      BoffdCols[n-B.NlocalCols] = C.colIndex(B.colMap[n]);
+      LIBP_ABORT("SpMMNumeric: sparsity pattern of C does not match A*B",
+                 BoffdCols[n-B.NlocalCols]<0);
+    }
+  }
+
+  // Accumulate each row of C in a dense workspace, then gather it
+  // into the existing pattern. Local columns of B and C coincide.
+  memory<dfloat> Crow(C.Ncols, 0.0);
 
-  // Fill the intermediate form of C
-  dlong cnt = 0;
   for (dlong i=0;i<A.Nrows;i++) {
     //local A entries
-    dlong start = A.diag.rowStarts[i];
-    dlong end   = A.diag.rowStarts[i+1];
-    for (dlong j=start;j<end;j++) {
+    for (dlong j=A.diag.rowStarts[i];j<A.diag.rowStarts[i+1];j++) {
       const dlong col = A.diag.cols[j];
       const dfloat Aval = A.diag.vals[j];
 
-      //local B entries
-      dlong Bstart = B.diag.rowStarts[col];
-      dlong Bend   = B.diag.rowStarts[col+1];
-      for (dlong jj=Bstart;jj<Bend;jj++) {
-        Ctmp[cnt].row = i + A.globalRowStarts[rank];
-        Ctmp[cnt].col = B.diag.cols[jj]+B.globalColStarts[rank]; //global id
-        Ctmp[cnt].val = Aval*B.diag.vals[jj];
-        cnt++;
-      }
-      //non-local B entries
-      Bstart = B.offd.rowStarts[col];
-      Bend   = B.offd.rowStarts[col+1];
-      for (dlong jj=Bstart;jj<Bend;jj++) {
-        Ctmp[cnt].row = i + A.globalRowStarts[rank];
-        Ctmp[cnt].col = B.colMap[B.offd.cols[jj]]; //global id
-        Ctmp[cnt].val = Aval*B.offd.vals[jj];
-        cnt++;
-      }
+      for (dlong jj=B.diag.rowStarts[col];jj<B.diag.rowStarts[col+1];jj++)
+        Crow[B.diag.cols[jj]] += Aval*B.diag.vals[jj];
+      for (dlong jj=B.offd.rowStarts[col];jj<B.offd.rowStarts[col+1];jj++)
+        Crow[BoffdCols[B.offd.cols[jj]-B.NlocalCols]] += Aval*B.offd.vals[jj];
     }
     //non-local A entries
-    start = A.offd.rowStarts[i];
-    end   = A.offd.rowStarts[i+1];
-    for (dlong j=start;j<end;j++) {
+    for (dlong j=A.offd.rowStarts[i];j<A.offd.rowStarts[i+1];j++) {
       const dlong col = A.offd.cols[j]-A.NlocalCols;
       const dfloat Aval = A.offd.vals[j];
 
-      // entries from recived rows of B
-      dlong Bstart = BoffdRowOffsets[col];
-      dlong Bend   = BoffdRowOffsets[col+1];
-      for (dlong jj=Bstart;jj<Bend;jj++) {
-        Ctmp[cnt].row = i + A.globalRowStarts[rank];
-        Ctmp[cnt].col = BoffdRows[jj].col; //global id
-        Ctmp[cnt].val = Aval*BoffdRows[jj].val;
-        cnt++;
-      }
+      for (dlong jj=plan.recvRowStarts[col];jj<plan.recvRowStarts[col+1];jj++)
+        Crow[plan.recvCols[jj]] += Aval*recvVals[jj];
     }
-  }
-
-  //sort entries by the row and col
-  std::sort(Ctmp.ptr(), Ctmp.ptr()+nnzTotal,
-            [](const parCOO::nonZero_t& a, const parCOO::nonZero_t& b) {
-              if (a.row < b.row) return true;
-              if (a.row > b.row) return false;
-
-              return a.col < b.col;
-            });
 
-  //count total number of nonzeros;
-  dlong nnz =0;
-  if (nnzTotal) nnz++;
-  for (dlong i=1;i<nnzTotal;i++)
-    if ((Ctmp[i].row!=Ctmp[i-1].row)||
-        (Ctmp[i].col!=Ctmp[i-1].col)) nnz++;
-
-  parCOO cooC(A.platform, A.comm);
-
-  //copy global partition
-  cooC.globalRowStarts = A.globalRowStarts;
-  cooC.globalColStarts = B.globalColStarts;
-
-  cooC.nnz = nnz;
-  cooC.entries.malloc(nnz);
-
-  //compress nonzeros
-  nnz = 0;
-  if (nnzTotal) cooC.entries[nnz++] = Ctmp[0];
-  for (dlong i=1;i<nnzTotal;i++) {
-    if ((Ctmp[i].row!=Ctmp[i-1].row)||
-        (Ctmp[i].col!=Ctmp[i-1].col)) {
-      cooC.entries[nnz++] = Ctmp[i];
-    } else {
-      cooC.entries[nnz-1].val += Ctmp[i].val;
+    for (dlong jj=C.diag.rowStarts[i];jj<C.diag.rowStarts[i+1];jj++) {
+      C.diag.vals[jj] = Crow[C.diag.cols[jj]];
+      Crow[C.diag.cols[jj]] = 0.0;
+    }
+    for (dlong jj=C.offd.rowStarts[i];jj<C.offd.rowStarts[i+1];jj++) {
+      C.offd.vals[jj] = Crow[C.offd.cols[jj]];
+      Crow[C.offd.cols[jj]] = 0.0;
     }
   }
-
-  //build C from coo matrix
-  return parCSR(cooC);
 }
 
 } //namespace parAlmond
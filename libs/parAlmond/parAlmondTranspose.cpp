@@ -119,6 +119,124 @@ parCSR transpose(parCSR& A){
   return parCSR(cooAt);
 }
 
+/*Numeric-only transpose At = A^T, where the sparsity pattern of At was
+  previously built by transpose(A). Where each entry of A lands in At is
+  recorded in plan on the first call, and later calls only communicate
+  values.*/
+void transposeNumeric(parCSR& A, parCSR& At, transposePlan_t& plan){
+
+  // MPI info
+  int rank = A.comm.rank();
+  int size = A.comm.size();
+
+  if (!plan.ready) {
+    //local entries A(i,j) are At(j,i) in At.diag
+    plan.diagIds.malloc(A.diag.nnz);
+    for (dlong i=0;i<A.Nrows;i++) {
+      for (dlong j=A.diag.rowStarts[i];j<A.diag.rowStarts[i+1];j++) {
+        const dlong row = A.diag.cols[j];
+        dlong id = At.diag.rowStarts[row];
+        while (id<At.diag.rowStarts[row+1] && At.diag.cols[id]!=i) id++;
+        LIBP_ABORT("transposeNumeric: sparsity pattern of At does not match A^T",
+                   id==At.diag.rowStarts[row+1]);
+        plan.diagIds[j] = id;
+      }
+    }
+
+    //group the nonlocal entries by the rank owning their column
+    memory<hlong> sendRows(A.offd.nnz);
+    memory<hlong> sendCols(A.offd.nnz);
+    plan.sendIds.malloc(A.offd.nnz);
+    for (dlong i=0;i<A.Nrows;i++) {
+      for (dlong j=A.offd.rowStarts[i];j<A.offd.rowStarts[i+1];j++) {
+        plan.sendIds[j] = j;
+        sendRows[j] = A.colMap[A.offd.cols[j]]; //global ids
+        sendCols[j] = i + A.globalRowStarts[rank];
+      }
+    }
+    std::sort(plan.sendIds.ptr(), plan.sendIds.ptr()+A.offd.nnz,
+              [&](const dlong a, const dlong b) {
+                if (sendRows[a] < sendRows[b]) return true;
+                if (sendRows[a] > sendRows[b]) return false;
+
+                return a < b;
+              });
+
+    plan.sendCounts.malloc(size, 0);
+    plan.recvCounts.malloc(size);
+    plan.sendOffsets.malloc(size+1);
+    plan.recvOffsets.malloc(size+1);
+
+    memory<hlong> sendIds(2*A.offd.nnz);
+    int r=0;
+    for (dlong n=0;n<A.offd.nnz;n++) {
+      const dlong id = plan.sendIds[n];
+      while(sendRows[id]>=A.globalColStarts[r+1]) r++;
+      plan.sendCounts[r]++;
+      sendIds[2*n+0] = sendRows[id];
+      sendIds[2*n+1] = sendCols[id];
+    }
+
+    A.comm.Alltoall(plan.sendCounts, plan.recvCounts);
+
+    plan.sendOffsets[0] = 0;
+    plan.recvOffsets[0] = 0;
+    for (r=0;r<size;r++) {
+      plan.sendOffsets[r+1] = plan.sendOffsets[r]+plan.sendCounts[r];
+      plan.recvOffsets[r+1] = plan.recvOffsets[r]+plan.recvCounts[r];
+    }
+
+    //share the (row,col) pairs once
+    memory<int> pairSendCounts(size);
+    memory<int> pairRecvCounts(size);
+    memory<int> pairSendOffsets(size+1);
+    memory<int> pairRecvOffsets(size+1);
+    for (r=0;r<size;r++) {
+      pairSendCounts[r] = 2*plan.sendCounts[r];
+      pairRecvCounts[r] = 2*plan.recvCounts[r];
+    }
+    for (r=0;r<size+1;r++) {
+      pairSendOffsets[r] = 2*plan.sendOffsets[r];
+      pairRecvOffsets[r] = 2*plan.recvOffsets[r];
+    }
+
+    const dlong Nrecv = plan.recvOffsets[size];
+    memory<hlong> recvIds(2*Nrecv);
+    A.comm.Alltoallv(sendIds, pairSendCounts, pairSendOffsets,
+                     recvIds, pairRecvCounts, pairRecvOffsets);
+
+    //recv'd entries come from columns owned elsewhere, so land in At.offd
+    plan.recvIds.malloc(Nrecv);
+    for (dlong n=0;n<Nrecv;n++) {
+      const dlong row = static_cast<dlong>(recvIds[2*n+0]-At.globalRowStarts[rank]);
+      const dlong col = At.colIndex(recvIds[2*n+1]);
+
+      dlong id = At.offd.rowStarts[row];
+      while (id<At.offd.rowStarts[row+1] && At.offd.cols[id]!=col) id++;
+      LIBP_ABORT("transposeNumeric: sparsity pattern of At does not match A^T",
+                 col<0 || id==At.offd.rowStarts[row+1]);
+      plan.recvIds[n] = id;
+    }
+
+    plan.ready = true;
+  }
+
+  for (dlong n=0;n<A.diag.nnz;n++)
+    At.diag.vals[plan.diagIds[n]] = A.diag.vals[n];
+
+  memory<dfloat> sendVals(A.offd.nnz);
+  for (dlong n=0;n<A.offd.nnz;n++)
+    sendVals[n] = A.offd.vals[plan.sendIds[n]];
+
+  const dlong Nrecv = plan.recvOffsets[size];
+  memory<dfloat> recvVals(Nrecv);
+  A.comm.Alltoallv(sendVals, plan.sendCounts, plan.sendOffsets,
+                   recvVals, plan.recvCounts, plan.recvOffsets);
+
+  for (dlong n=0;n<Nrecv;n++)
+    At.offd.vals[plan.recvIds[n]] = recvVals[n];
+}
+
 } //namespace parAlmond
 
 } //namespace libp
@@ -51,7 +51,8 @@ void multigrid_t::vcycle(const int k, deviceMemory<dfloat>& o_RHS, deviceMemory<
   // rhsC = P^T res
   level.coarsen(o_RES, o_RHSC);
 
-  vcycle(k+1, o_RHSC, o_XC);
+  //ranks agglomerated away sit out the coarse correction
+  if (k+1<idleLevel) vcycle(k+1, o_RHSC, o_XC);
 
   // x = x + P xC
   level.prolongate(o_XC, o_X);
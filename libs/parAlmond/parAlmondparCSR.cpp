@@ -101,21 +101,24 @@ void parCSR::SpMV(const dfloat alpha, deviceMemory<dfloat>& o_x, const dfloat be
 
   halo.ExchangeStart(o_x, 1);
 
+  kernel_t& SpMVcsr  = singlePrecision ? SpMVcsrSingleKernel1 : SpMVcsrKernel1;
+  kernel_t& SpMVmcsr = singlePrecision ? SpMVmcsrSingleKernel : SpMVmcsrKernel;
+
   // z[i] = beta*y[i] + alpha* (sum_{ij} Aij*x[j])
   if (diag.NrowBlocks)
-    SpMVcsrKernel1(diag.NrowBlocks, alpha, beta,
-                   diag.o_blockRowStarts, diag.o_rowStarts,
-                   diag.o_cols, diag.o_vals,
-                   o_x, o_y);
+    SpMVcsr(diag.NrowBlocks, alpha, beta,
+            diag.o_blockRowStarts, diag.o_rowStarts,
+            diag.o_cols, diag.o_vals,
+            o_x, o_y);
 
   halo.ExchangeFinish(o_x, 1);
 
   const dfloat one = 1.0;
   if (offd.NrowBlocks)
-    SpMVmcsrKernel(offd.NrowBlocks, alpha, one,
-                   offd.o_blockRowStarts, offd.o_mRowStarts,
-                   offd.o_rows, offd.o_cols, offd.o_vals,
-                   o_x, o_y);
+    SpMVmcsr(offd.NrowBlocks, alpha, one,
+             offd.o_blockRowStarts, offd.o_mRowStarts,
+             offd.o_rows, offd.o_cols, offd.o_vals,
+             o_x, o_y);
 }
 
 void parCSR::SpMV(const dfloat alpha, deviceMemory<dfloat>& o_x, const dfloat beta,
@@ -123,21 +126,24 @@ void parCSR::SpMV(const dfloat alpha, deviceMemory<dfloat>& o_x, const dfloat be
 
   halo.ExchangeStart(o_x, 1);
 
+  kernel_t& SpMVcsr  = singlePrecision ? SpMVcsrSingleKernel2 : SpMVcsrKernel2;
+  kernel_t& SpMVmcsr = singlePrecision ? SpMVmcsrSingleKernel : SpMVmcsrKernel;
+
   // z[i] = beta*y[i] + alpha* (sum_{ij} Aij*x[j])
   if (diag.NrowBlocks)
-    SpMVcsrKernel2(diag.NrowBlocks, alpha, beta,
-                   diag.o_blockRowStarts, diag.o_rowStarts,
-                   diag.o_cols, diag.o_vals,
-                   o_x, o_y, o_z);
+    SpMVcsr(diag.NrowBlocks, alpha, beta,
+            diag.o_blockRowStarts, diag.o_rowStarts,
+            diag.o_cols, diag.o_vals,
+            o_x, o_y, o_z);
 
   halo.ExchangeFinish(o_x, 1);
 
   const dfloat one = 1.0;
   if (offd.NrowBlocks)
-    SpMVmcsrKernel(offd.NrowBlocks, alpha, one,
-                   offd.o_blockRowStarts, offd.o_mRowStarts,
-                   offd.o_rows, offd.o_cols, offd.o_vals,
-                   o_x, o_z);
+    SpMVmcsr(offd.NrowBlocks, alpha, one,
+             offd.o_blockRowStarts, offd.o_mRowStarts,
+             offd.o_rows, offd.o_cols, offd.o_vals,
+             o_x, o_z);
 }
 
 
@@ -233,6 +239,50 @@ parCSR::parCSR(parCOO& A):       // number of nonzeros on this rank
   }
 }
 
+void parCSR::updateValues(parCOO& A) {
+
+  int rank = comm.rank();
+
+  const hlong globalColOffset = globalColStarts[rank];
+
+  LIBP_ABORT("parCSR::updateValues: matrix has " << A.nnz
+             << " nonzeros, expected " << diag.nnz+offd.nnz,
+             A.nnz != diag.nnz+offd.nnz);
+
+  //entries land in the same order as in the constructor
+  dlong diagCnt = 0;
+  dlong offdCnt = 0;
+  for (dlong n=0;n<A.nnz;n++) {
+    const hlong col = A.entries[n].col;
+    if ( (col < globalColOffset)
+      || (col > globalColOffset+NlocalCols-1)) {
+      LIBP_ABORT("parCSR::updateValues: sparsity pattern does not match",
+                 offdCnt>=offd.nnz || colMap[offd.cols[offdCnt]]!=col);
+      offd.vals[offdCnt++] = A.entries[n].val;
+    } else {
+      LIBP_ABORT("parCSR::updateValues: sparsity pattern does not match",
+                 diagCnt>=diag.nnz || diag.cols[diagCnt]!=col-globalColOffset);
+      diag.vals[diagCnt++] = A.entries[n].val;
+    }
+  }
+}
+
+dlong parCSR::colIndex(const hlong id) {
+
+  int rank = comm.rank();
+
+  if (id>=globalColStarts[rank] && id<globalColStarts[rank+1])
+    return static_cast<dlong>(id-globalColStarts[rank]);
+
+  //the halo part of colMap is sorted
+  const hlong* begin = colMap.ptr()+NlocalCols;
+  const hlong* end   = colMap.ptr()+Ncols;
+  const hlong* it = std::lower_bound(begin, end, id);
+
+  if (it==end || *it!=id) return -1;
+  return static_cast<dlong>(it-colMap.ptr());
+}
+
 //------------------------------------------------------------------------
 //
 //  parCSR halo setup
@@ -457,7 +507,9 @@ dfloat parCSR::rhoDinvA(){
   return RHO;
 }
 
-void parCSR::syncToDevice() {
+void parCSR::syncToDevice(const bool _singlePrecision) {
+
+  singlePrecision = _singlePrecision;
 
   if (Nrows) {
     //transfer matrix data
@@ -502,7 +554,13 @@ void parCSR::syncToDevice() {
 
       //transfer matrix data
       diag.o_cols = platform.malloc<dlong>(diag.cols);
-      diag.o_vals = platform.malloc<pfloat>(diag.vals);
+      if (singlePrecision) {
+        memory<float> fvals(diag.nnz);
+        for (dlong n=0;n<diag.nnz;++n) fvals[n] = static_cast<float>(diag.vals[n]);
+        diag.o_vals = platform.malloc<float>(fvals);
+      } else {
+        diag.o_vals = platform.malloc<pfloat>(diag.vals);
+      }
     }
 
     if (offd.nnz) {
@@ -546,7 +604,13 @@ void parCSR::syncToDevice() {
       offd.o_mRowStarts = platform.malloc<dlong>(offd.mRowStarts);
 
       offd.o_cols = platform.malloc<dlong>(offd.cols);
-      offd.o_vals = platform.malloc<pfloat>(offd.vals);
+      if (singlePrecision) {
+        memory<float> fvals(offd.nnz);
+        for (dlong n=0;n<offd.nnz;++n) fvals[n] = static_cast<float>(offd.vals[n]);
+        offd.o_vals = platform.malloc<float>(fvals);
+      } else {
+        offd.o_vals = platform.malloc<pfloat>(offd.vals);
+      }
     }
 
     if (diagA.size()) {
@@ -33,6 +33,13 @@ void timeStepper_t::Run(solver_t& solver,
                         deviceMemory<dfloat>& o_q,
                         dfloat start, dfloat end) {
   assertInitialized();
+
+  int dtUpdateInterval=0;
+  if (solver.settings.hasSetting("TIME STEP UPDATE INTERVAL"))
+    solver.settings.getSetting("TIME STEP UPDATE INTERVAL", dtUpdateInterval);
+  LIBP_ABORT("TIME STEP UPDATE INTERVAL is only supported by the AB3, LSERK4, and SSPRK2 time integrators",
+             dtUpdateInterval>0 && !ts->SupportsTimeStepUpdate());
+
   ts->Run(solver, o_q, start, end);
 }
 
@@ -51,6 +58,49 @@ dfloat timeStepper_t::GetGamma() {
   return ts->GetGamma();
 }
 
+namespace TimeStepper {
+
+bool timeStepperBase_t::Restart(checkpoint_t& checkpoint, solver_t& solver,
+                                deviceMemory<dfloat>& o_q,
+                                dfloat& time, dfloat& outputTime, int& tstep) {
+
+  checkpoint.Setup(platform, solver.settings, comm);
+
+  checkpoint.AddScalar("time", time);
+  checkpoint.AddScalar("output time", outputTime);
+  checkpoint.AddScalar("time step", tstep);
+  checkpoint.AddScalar("output frame", solver.outputFrame);
+  checkpoint.AddField("q", o_q);
+
+  SetupCheckpoint(checkpoint);
+  solver.SetupCheckpoint(checkpoint);
+
+  return checkpoint.Restart();
+}
+
+void timeStepperBase_t::TimeStepUpdateSetup(solver_t& solver) {
+  solver.settings.getSetting("TIME STEP UPDATE INTERVAL", dtUpdateInterval);
+}
+
+bool timeStepperBase_t::TimeStepUpdateStart(solver_t& solver, deviceMemory<dfloat>& o_q,
+                                            const dfloat time, const int tstep) {
+  if (dtUpdateInterval<=0 || tstep%dtUpdateInterval) return false;
+
+  solver.MaxTimeStepStart(o_q, time);
+  return true;
+}
+
+void timeStepperBase_t::TimeStepUpdateFinish(solver_t& solver, const bool updating) {
+  if (!updating) return;
+
+  const dfloat newdt = solver.MaxTimeStepFinish();
+  LIBP_ABORT("Invalid time step " << newdt << " from CFL estimate",
+             !(newdt>0.0));
+  UpdateTimeStep(newdt);
+}
+
+} //namespace TimeStepper
+
 void timeStepper_t::assertInitialized() {
   LIBP_ABORT("timeStepper_t not initialized",
              ts==nullptr);
@@ -66,14 +66,18 @@ ab3::ab3(dlong Nelements, dlong NhaloElements,
   ab_a.copyFrom(_ab_a);
 
   o_ab_a = platform.malloc<dfloat>(ab_a);
+
+  dtHistory[0] = 0.0;
+  dtHistory[1] = 0.0;
+
+  ab_v.malloc(Nstages);
+  o_ab_v = platform.malloc<dfloat>(Nstages);
 }
 
 void ab3::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dfloat end) {
 
   dfloat time = start;
 
-  solver.Report(time,0);
-
   dfloat outputInterval=0.0;
   solver.settings.getSetting("OUTPUT INTERVAL", outputInterval);
 
@@ -81,27 +85,44 @@ void ab3::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dfloat
 
   int tstep=0;
   int order=0;
+
+  //load state if restarting from a checkpoint
+  checkpoint_t checkpoint;
+  checkpoint.AddScalar("order", order);
+  if (!Restart(checkpoint, solver, o_q, time, outputTime, tstep)) {
+    solver.Report(time,0);
+  }
+
+  TimeStepUpdateSetup(solver);
+
   while (time < end) {
+    const bool updating = TimeStepUpdateStart(solver, o_q, time, tstep);
+
     Step(solver, o_q, time, dt, order);
     time += dt;
     tstep++;
     if (order<Nstages-1) order++;
 
+    TimeStepUpdateFinish(solver, updating);
+
     if (time>outputTime) {
       //report state
       solver.Report(time,tstep);
       outputTime += outputInterval;
     }
+
+    checkpoint.Write(tstep);
   }
 }
 
 void ab3::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloat _dt, int order) {
+  Profiler::Start("timeStepper Step");
 
   //rhs at current index
   deviceMemory<dfloat> o_rhsq0 = o_rhsq + shiftIndex*N;
 
   //A coefficients at current order
-  deviceMemory<dfloat> o_A = o_ab_a + order*Nstages;
+  deviceMemory<dfloat> o_A = Coefficients(order);
 
   //evaluate ODE rhs = f(q,t)
   solver.rhsf(o_q, o_rhsq0, time);
@@ -116,6 +137,56 @@ void ab3::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloat
 
   //rotate index
   shiftIndex = (shiftIndex+Nstages-1)%Nstages;
+  ShiftHistory();
+
+  Profiler::Stop("timeStepper Step");
+}
+
+/*AB coefficients for the current step. While the rhs history was taken
+  with the current dt these are the constant step coefficients, otherwise
+  the Lagrange interpolant through the history is integrated over the
+  new step. With s=(t-t_n)/dt and previous steps at s=-a, s=-b:
+    order 2: a0 = 1 + 1/(2a), a1 = -1/(2a)
+    order 3: a0 = (1/3 + (a+b)/2 + ab)/(ab)
+             a1 = (1/3 + b/2)/(a(a-b))
+             a2 = (1/3 + a/2)/(b(b-a))   */
+deviceMemory<dfloat> ab3::Coefficients(const int order) {
+
+  bool variable = false;
+  for (int s=0;s<order;++s)
+    variable = variable || (dtHistory[s]!=dt);
+
+  if (!variable) return o_ab_a + order*Nstages;
+
+  const dfloat a = dtHistory[0]/dt;
+  const dfloat b = (dtHistory[0]+dtHistory[1])/dt;
+
+  for (int s=0;s<Nstages;++s) ab_v[s] = 0.0;
+
+  if (order==1) {
+    ab_v[0] =  1.0 + 1.0/(2.0*a);
+    ab_v[1] = -1.0/(2.0*a);
+  } else {
+    ab_v[0] = (1.0/3.0 + (a+b)/2.0 + a*b)/(a*b);
+    ab_v[1] = (1.0/3.0 + b/2.0)/(a*(a-b));
+    ab_v[2] = (1.0/3.0 + a/2.0)/(b*(b-a));
+  }
+
+  o_ab_v.copyFrom(ab_v);
+  return o_ab_v;
+}
+
+void ab3::ShiftHistory() {
+  dtHistory[1] = dtHistory[0];
+  dtHistory[0] = dt;
+}
+
+void ab3::SetupCheckpoint(checkpoint_t& checkpoint) {
+  timeStepperBase_t::SetupCheckpoint(checkpoint);
+  checkpoint.AddScalar("shift index", shiftIndex);
+  checkpoint.AddScalar("dt history 0", dtHistory[0]);
+  checkpoint.AddScalar("dt history 1", dtHistory[1]);
+  checkpoint.AddField("rhsq", o_rhsq);
 }
 
 /**************************************************/
@@ -137,6 +208,7 @@ ab3_pml::ab3_pml(dlong Nelements, dlong NpmlElements, dlong NhaloElements,
 }
 
 void ab3_pml::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloat _dt, int order) {
+  Profiler::Start("timeStepper Step");
 
   //rhs at current index
   deviceMemory<dfloat> o_rhsq0 = o_rhsq + shiftIndex*N;
@@ -144,7 +216,7 @@ void ab3_pml::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfl
   if (Npml)    o_rhspmlq0 = o_rhspmlq + shiftIndex*Npml;
 
   //A coefficients at current order
-  deviceMemory<dfloat> o_A = o_ab_a + order*Nstages;
+  deviceMemory<dfloat> o_A = Coefficients(order);
 
   //evaluate ODE rhs = f(q,t)
   solver.rhsf_pml(o_q, o_pmlq, o_rhsq0, o_rhspmlq0, time);
@@ -166,6 +238,17 @@ void ab3_pml::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfl
 
   //rotate index
   shiftIndex = (shiftIndex+Nstages-1)%Nstages;
+  ShiftHistory();
+
+  Profiler::Stop("timeStepper Step");
+}
+
+void ab3_pml::SetupCheckpoint(checkpoint_t& checkpoint) {
+  ab3::SetupCheckpoint(checkpoint);
+  if (Npml) {
+    checkpoint.AddField("pmlq", o_pmlq);
+    checkpoint.AddField("rhspmlq", o_rhspmlq);
+  }
 }
 
 } //namespace TimeStepper
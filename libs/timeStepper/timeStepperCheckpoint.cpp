@@ -0,0 +1,272 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "core.hpp"
+#include "timeStepper.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <map>
+
+namespace libp {
+
+namespace {
+
+constexpr char checkpointMagic[8] = {'L','I','B','P','C','H','K','1'};
+
+void WriteName(FILE* fp, const std::string& name) {
+  const uint32_t len = name.size();
+  fwrite(&len, sizeof(uint32_t), 1, fp);
+  fwrite(name.data(), 1, len, fp);
+}
+
+bool ReadName(FILE* fp, std::string& name) {
+  uint32_t len=0;
+  if (fread(&len, sizeof(uint32_t), 1, fp)!=1) return false;
+  name.resize(len);
+  return fread(&name[0], 1, len, fp)==len;
+}
+
+} //namespace
+
+void checkpoint_t::Setup(platform_t& _platform, settings_t& _settings, comm_t _comm) {
+  platform = _platform;
+  comm = _comm;
+
+  _settings.getSetting("CHECKPOINT INTERVAL", interval);
+  _settings.getSetting("CHECKPOINT FILE NAME", baseName);
+  restart = _settings.compareSetting("RESTART FROM CHECKPOINT", "TRUE");
+}
+
+void checkpoint_t::AddScalar(const std::string name, int& value) {
+  scalars.push_back({name, &value, nullptr});
+}
+
+void checkpoint_t::AddScalar(const std::string name, dfloat& value) {
+  scalars.push_back({name, nullptr, &value});
+}
+
+std::string checkpoint_t::FileName(const int s, const int r) const {
+  char fname[BUFSIZ];
+  sprintf(fname, "%s_%d_%04d.chk", baseName.c_str(), s, r);
+  return std::string(fname);
+}
+
+/*Each rank file holds
+    magic, rank, size, step, Nscalars, Nfields
+    Nscalars x (name, type, value)
+    Nfields  x (name, bytes, data)
+  all in native byte order. The manifest is a small text file naming the
+  slot, rank count and step of the last complete checkpoint.*/
+void checkpoint_t::Write(const int tstep) {
+
+  if (interval<=0 || tstep<=0 || tstep%interval) return;
+  if (tstep==lastStep) return;
+  lastStep = tstep;
+
+  //write into the slot not referenced by the manifest
+  slot = 1-slot;
+
+  const int rank = comm.rank();
+  const int size = comm.size();
+
+  const std::string fileName = FileName(slot, rank);
+  FILE *fp = fopen(fileName.c_str(), "wb");
+
+  int ok = (fp!=nullptr);
+  if (ok) {
+    int32_t header[5] = {rank, size, tstep,
+                         static_cast<int32_t>(scalars.size()),
+                         static_cast<int32_t>(fields.size())};
+    fwrite(checkpointMagic, 1, sizeof(checkpointMagic), fp);
+    fwrite(header, sizeof(int32_t), 5, fp);
+
+    for (auto& s: scalars) {
+      WriteName(fp, s.name);
+      if (s.i) {
+        const char type = 'i';
+        const int64_t val = *(s.i);
+        fwrite(&type, 1, 1, fp);
+        fwrite(&val, sizeof(int64_t), 1, fp);
+      } else {
+        const char type = 'd';
+        const double val = *(s.d);
+        fwrite(&type, 1, 1, fp);
+        fwrite(&val, sizeof(double), 1, fp);
+      }
+    }
+
+    for (auto& f: fields) {
+      WriteName(fp, f.name);
+      const uint64_t bytes = f.bytes;
+      fwrite(&bytes, sizeof(uint64_t), 1, fp);
+      if (bytes) {
+        memory<char> buf(bytes);
+        f.o_q.copyTo(buf.ptr(), bytes);
+        fwrite(buf.ptr(), 1, bytes, fp);
+      }
+    }
+
+    ok = !ferror(fp);
+    ok = (fclose(fp)==0) && ok;
+  }
+
+  //only update the manifest once every rank has its part on disk
+  comm.Allreduce(ok, Comm::Min);
+  LIBP_ABORT("Failed to write checkpoint " << baseName << " at time step " << tstep,
+             !ok);
+
+  if (rank==0) {
+    const std::string manifest = baseName + ".chk";
+    const std::string tmpName = manifest + ".tmp";
+
+    fp = fopen(tmpName.c_str(), "w");
+    LIBP_ABORT("Failed to open " << tmpName << " for writing.",
+               fp==nullptr);
+    fprintf(fp, "libParanumal checkpoint\n");
+    fprintf(fp, "slot %d\n", slot);
+    fprintf(fp, "ranks %d\n", size);
+    fprintf(fp, "step %d\n", tstep);
+    fclose(fp);
+
+    LIBP_ABORT("Failed to update checkpoint manifest " << manifest,
+               rename(tmpName.c_str(), manifest.c_str()));
+  }
+}
+
+bool checkpoint_t::Restart() {
+
+  if (!restart) return false;
+
+  const int rank = comm.rank();
+  const int size = comm.size();
+
+  //read the manifest on rank 0 and share it
+  int info[3] = {-1, -1, -1}; //slot, ranks, step
+  if (rank==0) {
+    const std::string manifest = baseName + ".chk";
+    FILE *fp = fopen(manifest.c_str(), "r");
+    if (fp) {
+      if (fscanf(fp, "libParanumal checkpoint slot %d ranks %d step %d",
+                 info+0, info+1, info+2)!=3) {
+        info[0] = -1;
+      }
+      fclose(fp);
+    }
+  }
+  memory<int> h_info(3);
+  h_info.copyFrom(info);
+  comm.Bcast(h_info, 0);
+
+  LIBP_ABORT("Unable to read checkpoint manifest " << baseName << ".chk",
+             h_info[0]<0);
+  LIBP_ABORT("Checkpoint " << baseName << " was written with " << h_info[1]
+             << " ranks, restarting requires the same partitioning, but running with "
+             << size << " ranks.",
+             h_info[1]!=size);
+
+  slot = h_info[0];
+  const int tstep = h_info[2];
+
+  const std::string fileName = FileName(slot, rank);
+  FILE *fp = fopen(fileName.c_str(), "rb");
+  LIBP_ABORT("Failed to open checkpoint file " << fileName,
+             fp==nullptr);
+
+  char magic[sizeof(checkpointMagic)];
+  int32_t header[5];
+  LIBP_ABORT("Checkpoint file " << fileName << " is corrupt.",
+             fread(magic, 1, sizeof(magic), fp)!=sizeof(magic)
+             || std::memcmp(magic, checkpointMagic, sizeof(magic))
+             || fread(header, sizeof(int32_t), 5, fp)!=5);
+  LIBP_ABORT("Checkpoint file " << fileName << " does not match the manifest.",
+             header[0]!=rank || header[1]!=size || header[2]!=tstep);
+
+  //read everything stored, then match it against the registered state
+  std::map<std::string, int64_t> ivals;
+  std::map<std::string, double> dvals;
+  for (int n=0;n<header[3];++n) {
+    std::string sname;
+    char type;
+    bool good = ReadName(fp, sname) && fread(&type, 1, 1, fp)==1;
+    if (good && type=='i') {
+      int64_t val;
+      good = fread(&val, sizeof(int64_t), 1, fp)==1;
+      ivals[sname] = val;
+    } else if (good) {
+      double val;
+      good = fread(&val, sizeof(double), 1, fp)==1;
+      dvals[sname] = val;
+    }
+    LIBP_ABORT("Checkpoint file " << fileName << " is corrupt.",
+               !good);
+  }
+
+  std::map<std::string, memory<char>> data;
+  for (int n=0;n<header[4];++n) {
+    std::string fname;
+    uint64_t bytes=0;
+    bool good = ReadName(fp, fname) && fread(&bytes, sizeof(uint64_t), 1, fp)==1;
+    memory<char> buf(bytes);
+    if (good && bytes) good = fread(buf.ptr(), 1, bytes, fp)==bytes;
+    LIBP_ABORT("Checkpoint file " << fileName << " is corrupt.",
+               !good);
+    data[fname] = buf;
+  }
+  fclose(fp);
+
+  for (auto& s: scalars) {
+    if (s.i) {
+      auto it = ivals.find(s.name);
+      LIBP_ABORT("Checkpoint " << fileName << " is missing [" << s.name << "]",
+                 it==ivals.end());
+      *(s.i) = static_cast<int>(it->second);
+    } else {
+      auto it = dvals.find(s.name);
+      LIBP_ABORT("Checkpoint " << fileName << " is missing [" << s.name << "]",
+                 it==dvals.end());
+      *(s.d) = static_cast<dfloat>(it->second);
+    }
+  }
+
+  for (auto& f: fields) {
+    auto it = data.find(f.name);
+    LIBP_ABORT("Checkpoint " << fileName << " is missing [" << f.name << "]",
+               it==data.end());
+    LIBP_ABORT("Checkpoint field [" << f.name << "] has " << it->second.length()
+               << " bytes, expected " << f.bytes,
+               it->second.length()!=f.bytes);
+    if (f.bytes) f.o_q.copyFrom(it->second.ptr(), f.bytes);
+  }
+
+  lastStep = tstep;
+
+  if (rank==0)
+    printf("Restarting from checkpoint %s at time step %d\n", baseName.c_str(), tstep);
+
+  return true;
+}
+
+} //namespace libp
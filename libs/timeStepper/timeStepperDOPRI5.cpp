@@ -121,8 +121,6 @@ void dopri5::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dflo
   // int rank;
   // comm_rank_t(comm, &rank);
 
-  solver.Report(time,0);
-
   dfloat outputInterval=0.0;
   solver.settings.getSetting("OUTPUT INTERVAL", outputInterval);
 
@@ -130,6 +128,13 @@ void dopri5::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dflo
 
   int tstep=0, allStep=0;
 
+  //load state if restarting from a checkpoint
+  checkpoint_t checkpoint;
+  checkpoint.AddScalar("total steps", allStep);
+  if (!Restart(checkpoint, solver, o_q, time, outputTime, tstep)) {
+    solver.Report(time,0);
+  }
+
   while (time < end) {
 
     LIBP_ABORT("Time step became too small at time step = " << tstep,
@@ -213,6 +218,8 @@ void dopri5::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dflo
     }
     dt = dtnew;
     allStep++;
+
+    checkpoint.Write(tstep);
   }
 
   // if (!rank)
@@ -232,6 +239,7 @@ void dopri5::AcceptStep(deviceMemory<dfloat> &o_q, deviceMemory<dfloat> &o_rq) {
 }
 
 void dopri5::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloat _dt) {
+  Profiler::Start("timeStepper Step");
 
   //RK step
   for(int rk=0;rk<Nrk;++rk){
@@ -268,6 +276,8 @@ void dopri5::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dflo
                    o_rkq,
                    o_rkerr);
   }
+
+  Profiler::Stop("timeStepper Step");
 }
 
 dfloat dopri5::Estimater(deviceMemory<dfloat>& o_q){
@@ -295,6 +305,11 @@ dfloat dopri5::Estimater(deviceMemory<dfloat>& o_q){
   return err;
 }
 
+void dopri5::SetupCheckpoint(checkpoint_t& checkpoint) {
+  timeStepperBase_t::SetupCheckpoint(checkpoint);
+  checkpoint.AddScalar("facold", facold);
+}
+
 /**************************************************/
 /* PML version                                    */
 /**************************************************/
@@ -348,6 +363,7 @@ void dopri5_pml::AcceptStep(deviceMemory<dfloat> &o_q, deviceMemory<dfloat> &o_r
 }
 
 void dopri5_pml::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloat _dt) {
+  Profiler::Start("timeStepper Step");
 
   //RK step
   for(int rk=0;rk<Nrk;++rk){
@@ -401,6 +417,15 @@ void dopri5_pml::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time,
                      o_rkrhspmlq,
                      o_rkpmlq);
   }
+
+  Profiler::Stop("timeStepper Step");
+}
+
+void dopri5_pml::SetupCheckpoint(checkpoint_t& checkpoint) {
+  dopri5::SetupCheckpoint(checkpoint);
+  if (Npml) {
+    checkpoint.AddField("pmlq", o_pmlq);
+  }
 }
 
 } //namespace TimeStepper
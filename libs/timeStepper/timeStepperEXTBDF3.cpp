@@ -88,8 +88,6 @@ void extbdf3::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dfl
 
   dfloat time = start;
 
-  solver.Report(time,0);
-
   dfloat outputInterval=0.0;
   solver.settings.getSetting("OUTPUT INTERVAL", outputInterval);
 
@@ -97,6 +95,14 @@ void extbdf3::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dfl
 
   int tstep=0;
   int order=0;
+
+  //load state if restarting from a checkpoint
+  checkpoint_t checkpoint;
+  checkpoint.AddScalar("order", order);
+  if (!Restart(checkpoint, solver, o_q, time, outputTime, tstep)) {
+    solver.Report(time,0);
+  }
+
   while (time < end) {
     Step(solver, o_q, time, dt, order);
     time += dt;
@@ -108,10 +114,13 @@ void extbdf3::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dfl
       solver.Report(time,tstep);
       outputTime += outputInterval;
     }
+
+    checkpoint.Write(tstep);
   }
 }
 
 void extbdf3::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloat _dt, int order) {
+  Profiler::Start("timeStepper Step");
 
   //F(q) at current index
   deviceMemory<dfloat> o_F0 = o_F + shiftIndex*N;
@@ -143,6 +152,15 @@ void extbdf3::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfl
 
   //rotate index
   shiftIndex = (shiftIndex+Nstages-1)%Nstages;
+
+  Profiler::Stop("timeStepper Step");
+}
+
+void extbdf3::SetupCheckpoint(checkpoint_t& checkpoint) {
+  timeStepperBase_t::SetupCheckpoint(checkpoint);
+  checkpoint.AddScalar("shift index", shiftIndex);
+  checkpoint.AddField("qn", o_qn);
+  checkpoint.AddField("F", o_F);
 }
 
 } //namespace TimeStepper
@@ -86,17 +86,26 @@ void lserk4::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dflo
 
   dfloat time = start;
 
-  solver.Report(time,0);
-
   dfloat outputInterval=0.0;
   solver.settings.getSetting("OUTPUT INTERVAL", outputInterval);
 
   dfloat outputTime = time + outputInterval;
 
   int tstep=0;
+
+  //load state if restarting from a checkpoint
+  checkpoint_t checkpoint;
+  if (!Restart(checkpoint, solver, o_q, time, outputTime, tstep)) {
+    solver.Report(time,0);
+  }
+
+  TimeStepUpdateSetup(solver);
+
   dfloat stepdt;
   while (time < end) {
 
+    const bool updating = TimeStepUpdateStart(solver, o_q, time, tstep);
+
     if (time<outputTime && time+dt>=outputTime) {
 
       //save current state
@@ -126,10 +135,15 @@ void lserk4::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dflo
     Step(solver, o_q, time, stepdt);
     time += stepdt;
     tstep++;
+
+    TimeStepUpdateFinish(solver, updating);
+
+    checkpoint.Write(tstep);
   }
 }
 
 void lserk4::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloat _dt) {
+  Profiler::Start("timeStepper Step");
 
   // Low storage explicit Runge Kutta (5 stages, 4th order)
   for(int rk=0;rk<Nrk;++rk){
@@ -143,6 +157,8 @@ void lserk4::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dflo
     updateKernel(N, _dt, rka[rk], rkb[rk],
                  o_rhsq, o_resq, o_q);
   }
+
+  Profiler::Stop("timeStepper Step");
 }
 
 
@@ -166,6 +182,7 @@ lserk4_pml::lserk4_pml(dlong _Nelements, dlong _NpmlElements, dlong _NhaloElemen
 }
 
 void lserk4_pml::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloat _dt) {
+  Profiler::Start("timeStepper Step");
 
   // Low storage explicit Runge Kutta (5 stages, 4th order)
   for(int rk=0;rk<Nrk;++rk){
@@ -182,6 +199,15 @@ void lserk4_pml::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time,
       updateKernel(Npml, _dt, rka[rk], rkb[rk],
                    o_rhspmlq, o_respmlq, o_pmlq);
   }
+
+  Profiler::Stop("timeStepper Step");
+}
+
+void lserk4_pml::SetupCheckpoint(checkpoint_t& checkpoint) {
+  lserk4::SetupCheckpoint(checkpoint);
+  if (Npml) {
+    checkpoint.AddField("pmlq", o_pmlq);
+  }
 }
 
 } //namespace TimeStepper
@@ -99,43 +99,58 @@ void mrsaab3::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dfl
 
   dfloat time = start;
 
-  //set timesteps and shifting index
-  for (int lev=0;lev<Nlevels;lev++) {
-    mrdt[lev] = dt*(1 << lev);
-    h_shiftIndex[lev] = 0;
-  }
-  o_mrdt.copyFrom(mrdt);
-  h_shiftIndex.copyTo(o_shiftIndex);
-
-  solver.Report(time,0);
-
   dfloat outputInterval=0.0;
   solver.settings.getSetting("OUTPUT INTERVAL", outputInterval);
 
   dfloat outputTime = time + outputInterval;
 
+  int tstep=0;
+  int order=0;
+
+  //load state if restarting from a checkpoint
+  checkpoint_t checkpoint;
+  checkpoint.AddScalar("order", order);
+  const bool restarted = Restart(checkpoint, solver, o_q, time, outputTime, tstep);
+
+  //set timesteps
+  for (int lev=0;lev<Nlevels;lev++) {
+    mrdt[lev] = dt*(1 << lev);
+  }
+  o_mrdt.copyFrom(mrdt);
+
   //Compute coefficients
   UpdateCoefficients();
 
-  // Populate Trace Buffer
-  traceUpdateKernel(mesh.mrNelements[Nlevels-1],
-                    mesh.o_mrElements[Nlevels-1],
-                    mesh.o_mrLevel,
-                    mesh.o_vmapM,
-                    N,
-                    o_shiftIndex,
-                    o_mrdt,
-                    o_saab_x,
-                    o_saab_b,
-                    o_rhsq0,
-                    o_rhsq,
-                    o_q,
-                    o_fQM);
+  if (restarted) {
+    //shifting index and trace buffer were loaded from the checkpoint
+    h_shiftIndex.copyFrom(o_shiftIndex);
+  } else {
+    //set shifting index
+    for (int lev=0;lev<Nlevels;lev++) {
+      h_shiftIndex[lev] = 0;
+    }
+    h_shiftIndex.copyTo(o_shiftIndex);
+
+    solver.Report(time,0);
+
+    // Populate Trace Buffer
+    traceUpdateKernel(mesh.mrNelements[Nlevels-1],
+                      mesh.o_mrElements[Nlevels-1],
+                      mesh.o_mrLevel,
+                      mesh.o_vmapM,
+                      N,
+                      o_shiftIndex,
+                      o_mrdt,
+                      o_saab_x,
+                      o_saab_b,
+                      o_rhsq0,
+                      o_rhsq,
+                      o_q,
+                      o_fQM);
+  }
 
   dfloat DT = dt*(1 << (Nlevels-1));
 
-  int tstep=0;
-  int order=0;
   while (time < end) {
     Step(solver, o_q, time, dt, order);
     time += DT;
@@ -147,10 +162,13 @@ void mrsaab3::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dfl
       solver.Report(outputTime,tstep);
       outputTime += outputInterval;
     }
+
+    checkpoint.Write(tstep);
   }
 }
 
 void mrsaab3::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloat _dt, int order) {
+  Profiler::Start("timeStepper Step");
 
   deviceMemory<dfloat> o_A = o_saab_a+order*Nstages;
   deviceMemory<dfloat> o_B = o_saab_b+order*Nstages;
@@ -211,6 +229,8 @@ void mrsaab3::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfl
     h_shiftIndex.copyTo(o_shiftIndex); //Required to keep the update kernel overlapping the transfer,
                                        // but why does that happen?
   }
+
+  Profiler::Stop("timeStepper Step");
 }
 
 
@@ -325,6 +345,14 @@ void mrsaab3::UpdateCoefficients() {
   }
 }
 
+void mrsaab3::SetupCheckpoint(checkpoint_t& checkpoint) {
+  timeStepperBase_t::SetupCheckpoint(checkpoint);
+  checkpoint.AddField("shift index", o_shiftIndex);
+  checkpoint.AddField("rhsq0", o_rhsq0);
+  checkpoint.AddField("rhsq", o_rhsq);
+  checkpoint.AddField("fQM", o_fQM);
+}
+
 /**************************************************/
 /* PML version                                    */
 /**************************************************/
@@ -387,6 +415,7 @@ mrsaab3_pml::mrsaab3_pml(dlong Nelements, dlong NpmlElements, dlong NhaloElement
 }
 
 void mrsaab3_pml::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloat _dt, int order) {
+  Profiler::Start("timeStepper Step");
 
   deviceMemory<dfloat> o_A = o_saab_a+order*Nstages;
   deviceMemory<dfloat> o_B = o_saab_b+order*Nstages;
@@ -466,6 +495,17 @@ void mrsaab3_pml::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time,
     h_shiftIndex.copyTo(o_shiftIndex); //Required to keep the update kernel overlapping the transfer,
                                        // but why does that happen?
   }
+
+  Profiler::Stop("timeStepper Step");
+}
+
+void mrsaab3_pml::SetupCheckpoint(checkpoint_t& checkpoint) {
+  mrsaab3::SetupCheckpoint(checkpoint);
+  if (Npml) {
+    checkpoint.AddField("pmlq", o_pmlq);
+    checkpoint.AddField("rhspmlq0", o_rhspmlq0);
+    checkpoint.AddField("rhspmlq", o_rhspmlq);
+  }
 }
 
 } //namespace TimeStepper
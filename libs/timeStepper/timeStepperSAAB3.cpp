@@ -78,18 +78,24 @@ void saab3::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dfloa
 
   dfloat time = start;
 
-  solver.Report(time,0);
-
   dfloat outputInterval=0.0;
   solver.settings.getSetting("OUTPUT INTERVAL", outputInterval);
 
   dfloat outputTime = time + outputInterval;
 
+  int tstep=0;
+  int order=0;
+
+  //load state if restarting from a checkpoint
+  checkpoint_t checkpoint;
+  checkpoint.AddScalar("order", order);
+  if (!Restart(checkpoint, solver, o_q, time, outputTime, tstep)) {
+    solver.Report(time,0);
+  }
+
   //Compute SAAB coefficients
   UpdateCoefficients();
 
-  int tstep=0;
-  int order=0;
   while (time < end) {
     Step(solver, o_q, time, dt, order);
     time += dt;
@@ -101,10 +107,13 @@ void saab3::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dfloa
       solver.Report(time,tstep);
       outputTime += outputInterval;
     }
+
+    checkpoint.Write(tstep);
   }
 }
 
 void saab3::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloat _dt, int order) {
+  Profiler::Start("timeStepper Step");
 
   //rhs at current index
   deviceMemory<dfloat> o_rhsq0 = o_rhsq + shiftIndex*N;
@@ -127,6 +136,8 @@ void saab3::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloa
 
   //rotate index
   shiftIndex = (shiftIndex+Nstages-1)%Nstages;
+
+  Profiler::Stop("timeStepper Step");
 }
 
 void saab3::UpdateCoefficients() {
@@ -207,6 +218,12 @@ void saab3::UpdateCoefficients() {
 }
 
 
+void saab3::SetupCheckpoint(checkpoint_t& checkpoint) {
+  timeStepperBase_t::SetupCheckpoint(checkpoint);
+  checkpoint.AddScalar("shift index", shiftIndex);
+  checkpoint.AddField("rhsq", o_rhsq);
+}
+
 /**************************************************/
 /* PML version                                    */
 /**************************************************/
@@ -253,6 +270,7 @@ saab3_pml::saab3_pml(dlong _Nelements, dlong _NpmlElements, dlong _NhaloElements
 
 
 void saab3_pml::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloat _dt, int order) {
+  Profiler::Start("timeStepper Step");
 
   //rhs at current index
   deviceMemory<dfloat> o_rhsq0    = o_rhsq + shiftIndex*N;
@@ -291,6 +309,16 @@ void saab3_pml::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, d
 
   //rotate index
   shiftIndex = (shiftIndex+Nstages-1)%Nstages;
+
+  Profiler::Stop("timeStepper Step");
+}
+
+void saab3_pml::SetupCheckpoint(checkpoint_t& checkpoint) {
+  saab3::SetupCheckpoint(checkpoint);
+  if (Npml) {
+    checkpoint.AddField("pmlq", o_pmlq);
+    checkpoint.AddField("rhspmlq", o_rhspmlq);
+  }
 }
 
 } //namespace TimeStepper
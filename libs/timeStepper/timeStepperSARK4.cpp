@@ -132,8 +132,6 @@ void sark4::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dfloa
 
   int rank = comm.rank();
 
-  solver.Report(time,0);
-
   dfloat outputInterval=0.0;
   solver.settings.getSetting("OUTPUT INTERVAL", outputInterval);
 
@@ -141,6 +139,13 @@ void sark4::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dfloa
 
   int tstep=0, allStep=0;
 
+  //load state if restarting from a checkpoint
+  checkpoint_t checkpoint;
+  checkpoint.AddScalar("total steps", allStep);
+  if (!Restart(checkpoint, solver, o_q, time, outputTime, tstep)) {
+    solver.Report(time,0);
+  }
+
   //Compute Butcher Tableau
   UpdateCoefficients();
 
@@ -235,6 +240,8 @@ void sark4::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dfloa
     UpdateCoefficients();
 
     allStep++;
+
+    checkpoint.Write(tstep);
   }
 
   if (!rank)
@@ -254,6 +261,7 @@ void sark4::AcceptStep(deviceMemory<dfloat> &o_q, deviceMemory<dfloat> &o_rq) {
 }
 
 void sark4::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloat _dt) {
+  Profiler::Start("timeStepper Step");
 
   //RK step
   for(int rk=0;rk<Nrk;++rk){
@@ -292,6 +300,8 @@ void sark4::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloa
                    o_rkq,
                    o_rkerr);
   }
+
+  Profiler::Stop("timeStepper Step");
 }
 
 dfloat sark4::Estimater(deviceMemory<dfloat>& o_q){
@@ -425,6 +435,11 @@ void sark4::UpdateCoefficients() {
 }
 
 
+void sark4::SetupCheckpoint(checkpoint_t& checkpoint) {
+  timeStepperBase_t::SetupCheckpoint(checkpoint);
+  checkpoint.AddScalar("facold", facold);
+}
+
 /**************************************************/
 /* PML version                                    */
 /**************************************************/
@@ -501,6 +516,7 @@ void sark4_pml::AcceptStep(deviceMemory<dfloat> &o_q, deviceMemory<dfloat> &o_rq
 }
 
 void sark4_pml::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloat _dt) {
+  Profiler::Start("timeStepper Step");
 
   //RK step
   for(int rk=0;rk<Nrk;++rk){
@@ -557,6 +573,15 @@ void sark4_pml::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, d
                          o_rkrhspmlq,
                          o_rkpmlq);
   }
+
+  Profiler::Stop("timeStepper Step");
+}
+
+void sark4_pml::SetupCheckpoint(checkpoint_t& checkpoint) {
+  sark4::SetupCheckpoint(checkpoint);
+  if (Npml) {
+    checkpoint.AddField("pmlq", o_pmlq);
+  }
 }
 
 } //namespace TimeStepper
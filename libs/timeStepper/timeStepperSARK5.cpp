@@ -131,8 +131,6 @@ void sark5::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dfloa
 
   int rank = comm.rank();
 
-  solver.Report(time,0);
-
   dfloat outputInterval=0.0;
   solver.settings.getSetting("OUTPUT INTERVAL", outputInterval);
 
@@ -140,6 +138,13 @@ void sark5::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dfloa
 
   int tstep=0, allStep=0;
 
+  //load state if restarting from a checkpoint
+  checkpoint_t checkpoint;
+  checkpoint.AddScalar("total steps", allStep);
+  if (!Restart(checkpoint, solver, o_q, time, outputTime, tstep)) {
+    solver.Report(time,0);
+  }
+
   //Compute Butcher Tableau
   UpdateCoefficients();
 
@@ -234,6 +239,8 @@ void sark5::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dfloa
     UpdateCoefficients();
 
     allStep++;
+
+    checkpoint.Write(tstep);
   }
 
   if (!rank)
@@ -253,6 +260,7 @@ void sark5::AcceptStep(deviceMemory<dfloat> &o_q, deviceMemory<dfloat> &o_rq) {
 }
 
 void sark5::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloat _dt) {
+  Profiler::Start("timeStepper Step");
 
   //RK step
   for(int rk=0;rk<Nrk;++rk){
@@ -291,6 +299,8 @@ void sark5::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloa
                    o_rkq,
                    o_rkerr);
   }
+
+  Profiler::Stop("timeStepper Step");
 }
 
 dfloat sark5::Estimater(deviceMemory<dfloat>& o_q){
@@ -482,6 +492,11 @@ void sark5::UpdateCoefficients() {
   }
 }
 
+void sark5::SetupCheckpoint(checkpoint_t& checkpoint) {
+  timeStepperBase_t::SetupCheckpoint(checkpoint);
+  checkpoint.AddScalar("facold", facold);
+}
+
 /**************************************************/
 /* PML version                                    */
 /**************************************************/
@@ -559,6 +574,7 @@ void sark5_pml::AcceptStep(deviceMemory<dfloat> &o_q, deviceMemory<dfloat> &o_rq
 }
 
 void sark5_pml::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloat _dt) {
+  Profiler::Start("timeStepper Step");
 
   //RK step
   for(int rk=0;rk<Nrk;++rk){
@@ -615,6 +631,15 @@ void sark5_pml::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, d
                          o_rkrhspmlq,
                          o_rkpmlq);
   }
+
+  Profiler::Stop("timeStepper Step");
+}
+
+void sark5_pml::SetupCheckpoint(checkpoint_t& checkpoint) {
+  sark5::SetupCheckpoint(checkpoint);
+  if (Npml) {
+    checkpoint.AddField("pmlq", o_pmlq);
+  }
 }
 
 } //namespace TimeStepper
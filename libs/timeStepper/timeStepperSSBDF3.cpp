@@ -77,8 +77,6 @@ void ssbdf3::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dflo
 
   dfloat time = start;
 
-  solver.Report(time,0);
-
   dfloat outputInterval=0.0;
   solver.settings.getSetting("OUTPUT INTERVAL", outputInterval);
 
@@ -86,6 +84,14 @@ void ssbdf3::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dflo
 
   int tstep=0;
   int order=0;
+
+  //load state if restarting from a checkpoint
+  checkpoint_t checkpoint;
+  checkpoint.AddScalar("order", order);
+  if (!Restart(checkpoint, solver, o_q, time, outputTime, tstep)) {
+    solver.Report(time,0);
+  }
+
   while (time < end) {
     Step(solver, o_q, time, dt, order);
     time += dt;
@@ -97,10 +103,13 @@ void ssbdf3::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dflo
       solver.Report(time,tstep);
       outputTime += outputInterval;
     }
+
+    checkpoint.Write(tstep);
   }
 }
 
 void ssbdf3::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloat _dt, int order) {
+  Profiler::Start("timeStepper Step");
 
   //BDF coefficients at current order
   deviceMemory<dfloat> o_B = o_ssbdf_b + order*(Nstages+1);
@@ -131,6 +140,15 @@ void ssbdf3::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dflo
 
   //rotate index
   shiftIndex = (shiftIndex+Nstages-1)%Nstages;
+
+  Profiler::Stop("timeStepper Step");
+}
+
+void ssbdf3::SetupCheckpoint(checkpoint_t& checkpoint) {
+  timeStepperBase_t::SetupCheckpoint(checkpoint);
+  checkpoint.AddScalar("shift index", shiftIndex);
+  checkpoint.AddField("qn", o_qn);
+  checkpoint.AddField("qhat", o_qhat);
 }
 
 } //namespace TimeStepper
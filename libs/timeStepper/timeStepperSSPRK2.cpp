@@ -74,17 +74,26 @@ void ssprk2::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dflo
 
   dfloat time = start;
 
-  solver.Report(time,0);
-
   dfloat outputInterval=0.0;
   solver.settings.getSetting("OUTPUT INTERVAL", outputInterval);
 
   dfloat outputTime = time + outputInterval;
 
   int tstep=0;
+
+  //load state if restarting from a checkpoint
+  checkpoint_t checkpoint;
+  if (!Restart(checkpoint, solver, o_q, time, outputTime, tstep)) {
+    solver.Report(time,0);
+  }
+
+  TimeStepUpdateSetup(solver);
+
   dfloat stepdt;
   while (time < end) {
 
+    const bool updating = TimeStepUpdateStart(solver, o_q, time, tstep);
+
     if (time<outputTime && time+dt>=outputTime) {
 
       //save current state
@@ -114,10 +123,15 @@ void ssprk2::Run(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat start, dflo
     Step(solver, o_q, time, stepdt);
     time += stepdt;
     tstep++;
+
+    TimeStepUpdateFinish(solver, updating);
+
+    checkpoint.Write(tstep);
   }
 }
 
 void ssprk2::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloat _dt) {
+  Profiler::Start("timeStepper Step");
 
   o_q1.copyFrom(o_q, N);
   for(int rk=0;rk<2;rk++){
@@ -129,6 +143,8 @@ void ssprk2::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dflo
     // update solution using Runge-Kutta
     updateKernel(N, _dt, rka[rk],o_rhsq, o_q, o_q1);
   }
+
+  Profiler::Stop("timeStepper Step");
 }
 
 
@@ -153,6 +169,7 @@ ssprk2_pml::ssprk2_pml(dlong _Nelements, dlong _NpmlElements, dlong _NhaloElemen
 }
 
 void ssprk2_pml::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time, dfloat _dt) {
+  Profiler::Start("timeStepper Step");
 
   // Low storage explicit Runge Kutta (5 stages, 4th order)
   for(int rk=0;rk<Nrk;++rk){
@@ -170,8 +187,17 @@ void ssprk2_pml::Step(solver_t& solver, deviceMemory<dfloat> &o_q, dfloat time,
       updateKernel(Npml, _dt, rka[rk], rkb[rk],
                    o_rhspmlq, o_respmlq, o_pmlq);
   }
+
+  Profiler::Stop("timeStepper Step");
 }
 */
+void ssprk2_pml::SetupCheckpoint(checkpoint_t& checkpoint) {
+  ssprk2::SetupCheckpoint(checkpoint);
+  if (Npml) {
+    checkpoint.AddField("pmlq", o_pmlq);
+  }
+}
+
 } //namespace TimeStepper
 
 } //namespace libp
@@ -54,7 +54,7 @@ for N in $NS
 do 
     for M in ../../meshes/circleh1.msh ../../meshes/circleh05.msh ../../meshes/circleh025.msh ../../meshes/circleh0125.msh ../../meshes/circleh00625.msh ../../meshes/circleh003125.msh;
     do
-        mpiexec -np 1 --map-by slot:PE=4 ./SWECMain setups/setupTri2D.rc $N $M $idx
+        mpiexec -np 1 --map-by slot:PE=4 ./SWEMain setups/setupTri2DConvergence.rc $N $M $idx
         ((idx++))
     done
 done
\ No newline at end of file
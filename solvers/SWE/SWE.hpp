@@ -50,17 +50,50 @@ public:
 class SWE_t: public solver_t {
 public:
   mesh_t mesh;
+  vtuWriter_t vtu;
+  mesh_t meshPatch;
 
   int Nfields;
+  int Ngrads;
   int cubature;
   int curvilinear;
 
+  //VISCOSITY TYPE: PHYSICAL or ARTIFICIAL are viscous
+  int viscous;
+  int artificialViscosity;
+
+  dfloat cfl;
+  dfloat hmin;
+
+  //set when resuming time integration after a rebalance
+  bool resuming=false;
+
   timeStepper_t timeStepper;
 
-  ogs::halo_t traceHalo;
+  ogs::halo_t fieldTraceHalo;
+  ogs::halo_t gradTraceHalo;
 
   memory<dfloat> q;
   deviceMemory<dfloat> o_q;
+  deviceMemory<dfloat> o_maxSpeed;
+
+  pinnedMemory<dfloat> h_maxSpeed;
+  Comm::request_t maxSpeedRequest;
+
+  memory<dfloat> gradq;
+  deviceMemory<dfloat> o_gradq;
+
+  memory<dfloat> mu;
+  deviceMemory<dfloat> o_mu;
+
+  //elements whose vertex patch is entirely local can be smoothed
+  // while the ring halo exchange is in flight
+  dlong NringInternalElements=0;
+  dlong NringHaloElements=0;
+  memory<dlong> ringInternalElementIds;
+  memory<dlong> ringHaloElementIds;
+  deviceMemory<dlong> o_ringInternalElementIds;
+  deviceMemory<dlong> o_ringHaloElementIds;
 
   deviceMemory<dfloat> o_Mq;
 
@@ -69,7 +102,14 @@ public:
   kernel_t cubatureVolumeKernel;
   kernel_t cubatureSurfaceKernel;
 
+  kernel_t gradVolumeKernel;
+  kernel_t gradSurfaceKernel;
+
   kernel_t initialConditionKernel;
+  kernel_t maxWaveSpeedKernel;
+
+  kernel_t viscosityKernel;
+  kernel_t viscositySmoothKernel;
 
   SWE_t() = default;
   SWE_t(platform_t &_platform, mesh_t &_mesh,
@@ -81,15 +121,51 @@ public:
   void Setup(platform_t& _platform, mesh_t& _mesh,
              SWESettings_t& _settings);
 
+  //(re)build solver data on the current mesh partition
+  void SetupSolver();
+
+  //build kernels, once per run
+  void SetupKernels();
+
   void Run();
 
+  //repartition the mesh if the measured rank cost is imbalanced,
+  // migrating the solution and rebuilding the solver
+  void Rebalance(const dfloat time);
+
+  //per-element cost, timed on each class of element
+  void ElementCosts(memory<dfloat>& cost, const dfloat time);
+
   void Report(dfloat time, int tstep);
 
-  void PlotFields(memory<dfloat> Q, const std::string fileName);
+  void PlotFields(deviceMemory<dfloat>& o_Q, const std::string name,
+                  const int frame, const dfloat time);
 
   void rhsf(deviceMemory<dfloat>& o_q, deviceMemory<dfloat>& o_rhs, const dfloat time);
 
-  dfloat MaxWaveSpeed();
+  //rhsf volume terms on all elements
+  void Volume(deviceMemory<dfloat>& o_Q, deviceMemory<dfloat>& o_RHS,
+              const dfloat T);
+
+  //rhsf pieces applied to a list of elements
+  void GradSurface(const dlong Nelements, deviceMemory<dlong>& o_elementIds,
+                   deviceMemory<dfloat>& o_Q, const dfloat T);
+  void ViscositySmooth(const dlong Nelements, deviceMemory<dlong>& o_elementIds);
+  void Surface(const dlong Nelements, deviceMemory<dlong>& o_elementIds,
+               deviceMemory<dfloat>& o_Q, deviceMemory<dfloat>& o_RHS,
+               const dfloat T);
+
+  dfloat MaxWaveSpeed(deviceMemory<dfloat>& o_Q, const dfloat T);
+
+  //non-blocking global max wave speed, for time step control
+  void MaxWaveSpeedStart(deviceMemory<dfloat>& o_Q, const dfloat T);
+  dfloat MaxWaveSpeedFinish();
+
+  //per-element wave speeds only, no global reduction
+  void ElementWaveSpeeds(deviceMemory<dfloat>& o_Q, const dfloat T);
+
+  void MaxTimeStepStart(deviceMemory<dfloat>& o_Q, const dfloat T);
+  dfloat MaxTimeStepFinish();
 };
 
 #endif
@@ -31,7 +31,8 @@ int main(int argc, char **argv){
   // start up MPI
   Comm::Init(argc, argv);
 
-  LIBP_ABORT("Usage: ./SWEMain setupfile", argc!=2);
+  LIBP_ABORT("Usage: ./SWEMain setupfile [degree meshfile idx]",
+             argc!=2 && argc!=5);
 
   { /*Scope so everything is destructed before MPI_Finalize */
     comm_t comm(Comm::World().Dup());
@@ -45,6 +46,14 @@ int main(int argc, char **argv){
     SWESettings.parseFromFile(platformSettings, meshSettings,
                               argv[1]);
 
+    //convergence studies override the degree, mesh, and output name
+    if (argc==5) {
+      meshSettings.changeSetting("POLYNOMIAL DEGREE", argv[2]);
+      meshSettings.changeSetting("MESH FILE", argv[3]);
+      SWESettings.changeSetting("OUTPUT FILE NAME",
+                                std::string("SWE") + argv[4]);
+    }
+
     // set up platform
     platform_t platform(platformSettings);
     
@@ -57,8 +66,12 @@ int main(int argc, char **argv){
     
     // set up SWE solver
     SWE_t SWE(platform, mesh, SWESettings);
-    // run
-    SWE.Run();
+    // run, unless only warming up the kernel cache
+    if (!platformSettings.compareSetting("WARM UP","TRUE"))
+      SWE.Run();
+
+    //report the profile while every rank is still here, before teardown
+    Profiler::Finalize();
   }
 
   // close down MPI
@@ -26,7 +26,7 @@ SOFTWARE.
 
 // Boundary conditions
 /* wall 1, outflow 2.0 */
-#define SWEAVDirichletConditions2D(bc, t, x, y, nx, ny, hM, qM, pM, hB, qB, pB) \
+#define SWEDirichletConditions2D(bc, t, x, y, nx, ny, hM, qM, pM, hB, qB, pB) \
 {                                       \
   if(bc==5){                            \
     *(hB) = cos(-t + x)*cos(-t + y) + 2.0; \
@@ -40,7 +40,7 @@ SOFTWARE.
 }
 
 /*
-#define SWEAVDerivativeConditions2D(bc, t, x, y, nx, ny, dhdxM, dhdyM, dqdxM, dqdyM, dpdxM, dpdyM, dhdxB, dhdyB, dqdxB, dqdyB, dpdxB, dpdyB) \
+#define SWEDerivativeConditions2D(bc, t, x, y, nx, ny, dhdxM, dhdyM, dqdxM, dqdyM, dpdxM, dpdyM, dhdxB, dhdyB, dqdxB, dqdyB, dpdxB, dpdyB) \
 {                                       \
   if(bc==1){                            \
     *dhdxB = sin(-x + t)*cos(-y + t);   \
@@ -59,13 +59,13 @@ SOFTWARE.
   }                                     \
 }*/
 
-#define SWEAVDerivativeConditions2D(bc, t, x, y, nx, ny, dhdxM, dhdyM, dqdxM, dqdyM, dpdxM, dpdyM, dhdxB, dhdyB, dqdxB, dqdyB, dpdxB, dpdyB) \
+#define SWEDerivativeConditions2D(bc, t, x, y, nx, ny, dhdxM, dhdyM, dqdxM, dqdyM, dpdxM, dpdyM, dhdxB, dhdyB, dqdxB, dqdyB, dpdxB, dpdyB) \
 {                                       \
   \
 }
 
 /*
-#define SWEAVDerivativeConditions2D(bc, t, x, y, nx, ny, dhdxM, dhdyM, dudxM, dudyM, dvdxM, dvdyM, dhdxB, dhdyB, dudxB, dudyB, dvdxB, dvdyB) \
+#define SWEDerivativeConditions2D(bc, t, x, y, nx, ny, dhdxM, dhdyM, dudxM, dudyM, dvdxM, dvdyM, dhdxB, dhdyB, dudxB, dudyB, dvdxB, dvdyB) \
 {                                                                                                              \
   if(bc==1){                                                                                                   \
     *dhdxB = sin(-x + t)*cos(-y + t);                                                                          \
@@ -87,7 +87,7 @@ SOFTWARE.
 
 /*
 // Initial conditions
-#define SWEAVInitialConditions2D(t, x, y, elementInfo, elementInfo2, h, q, p) \
+#define SWEInitialConditions2D(t, x, y, elementInfo, elementInfo2, h, q, p) \
 {                                           \
   *(h) = cos(-t + x)*cos(-t + y) + 2.0;     \
   *(q) = sin(x-t);                          \
@@ -95,7 +95,7 @@ SOFTWARE.
 } 
 */
 
-#define SWEAVInitialConditions2D(t, x, y, elementInfo, elementInfo2, h, q, p) \
+#define SWEInitialConditions2D(t, x, y, elementInfo, elementInfo2, h, q, p) \
 {                                   \
     if(x < 0) {                   \
         *(h) = 10;                  \
@@ -108,7 +108,7 @@ SOFTWARE.
 
 
 
-#define SWEAVSourceTerms2D(xl, yl, t, h, q, p, s1, s2, s3) \
+#define SWESourceTerms2D(xl, yl, t, h, q, p, s1, s2, s3) \
 {                                       \
   *s1=-sin(t-xl)*cos(t-yl)-cos(t-xl)*sin(t-yl)+cos(t-xl)+cos(t-yl); \
   *s2=-cos(-xl+t)-sin(-xl+t)*sin(-xl+t)*sin(-xl+t)*cos(-yl+t)/ ((cos(-xl+t)*cos(-yl+t)+2)*(cos(-xl+t)*cos(-yl+t)+2) ) -2*sin(-xl + t)*cos(-xl + t)/(cos(-xl + t)*cos(-yl + t) + 2) +p_grav*(cos(-xl + t)*cos(-yl + t) + 2)*sin(-xl + t)*cos(-yl + t) -sin(-yl + t)*sin(-yl + t)*sin(-xl + t)*cos(-xl + t)/((cos(-xl + t)*cos(-yl + t) + 2)*(cos(-xl + t)*cos(-yl + t) + 2))-cos(-yl + t)*sin(-xl + t)/(cos(-xl + t)*cos(-yl + t) + 2); \
@@ -26,7 +26,7 @@ SOFTWARE.
 
 // Boundary conditions
 /* wall 1, outflow 2 */
-#define SWEAVDirichletConditions2D(bc, t, x, y, nx, ny, hM, qM, pM, hB, qB, pB) \
+#define SWEDirichletConditions2D(bc, t, x, y, nx, ny, hM, qM, pM, hB, qB, pB) \
 {                                             \
   if(bc==1){                                  \
     *(hB) = -hM+2.0*0.5;                      \
@@ -36,13 +36,13 @@ SOFTWARE.
 }
 
 
-#define SWEAVDerivativeConditions2D(bc, t, x, y, nx, ny, dhdxM, dhdyM, dudxM, dudyM, dvdxM, dvdyM, dhdxB, dhdyB, dudxB, dudyB, dvdxB, dvdyB) \
+#define SWEDerivativeConditions2D(bc, t, x, y, nx, ny, dhdxM, dhdyM, dudxM, dudyM, dvdxM, dvdyM, dhdxB, dhdyB, dudxB, dudyB, dvdxB, dvdyB) \
 {                                       \
 }
 // Initial conditions
 
 /*
-#define SWEAVInitialConditions2D(t, x, y, elementInfo, elementInfo2, h, q, p) \
+#define SWEInitialConditions2D(t, x, y, elementInfo, elementInfo2, h, q, p) \
 {                                       \
     if(x*x+y*y <= 2.5*2.5) {            \
         *(h) = 2.5;                     \
@@ -53,7 +53,7 @@ SOFTWARE.
     *(p)=0;                             \
 }
 */
-#define SWEAVInitialConditions2D(t, x, y, elementInfo, elementInfo2, h, q, p) \
+#define SWEInitialConditions2D(t, x, y, elementInfo, elementInfo2, h, q, p) \
 {                                       \
     if(elementInfo2) {            \
         *(h) = 2.5;                     \
@@ -65,7 +65,7 @@ SOFTWARE.
 }
 
 
-#define SWEAVSourceTerms2D(xl, yl, t, h, q, p, s1, s2, s3) \
+#define SWESourceTerms2D(xl, yl, t, h, q, p, s1, s2, s3) \
 {         \
   *s1=0.0; \
   *s2=0.0; \
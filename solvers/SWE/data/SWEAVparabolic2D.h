@@ -26,7 +26,7 @@ SOFTWARE.
 
 // Boundary conditions
 /* wall 1, outflow 2 */
-#define SWEAVDirichletConditions2D(bc, t, x, y, nx, ny, hM, qM, pM, hB, qB, pB) \
+#define SWEDirichletConditions2D(bc, t, x, y, nx, ny, hM, qM, pM, hB, qB, pB) \
 {                                             \
   if(bc==1){                                  \
     *(qB) = -qM+2.0*0.18;                     \
@@ -41,7 +41,7 @@ SOFTWARE.
   }                                           \
 }
 
-#define SWEAVDerivativeConditions2D(bc, t, x, y, nx, ny, dhdxM, dhdyM, dudxM, dudyM, dvdxM, dvdyM, dhdxB, dhdyB, dudxB, dudyB, dvdxB, dvdyB) \
+#define SWEDerivativeConditions2D(bc, t, x, y, nx, ny, dhdxM, dhdyM, dudxM, dudyM, dvdxM, dvdyM, dhdxB, dhdyB, dudxB, dudyB, dvdxB, dvdyB) \
 {                                       \
   if(bc==3 || bc == 5){                            \
     *dhdxB = dhdxM - 2*nx*(nx*dhdxM + ny*dhdyM);   \
@@ -54,7 +54,7 @@ SOFTWARE.
 }
 // Initial conditions
 
-#define SWEAVInitialConditions2D(t, x, y, elementInfo, elementInfo2, h, q, p) \
+#define SWEInitialConditions2D(t, x, y, elementInfo, elementInfo2, h, q, p) \
 {                                         \
 if( (8.0<=x) && (x <= 12.0)) {          \
     *(h) =0.33-(0.2-0.05*(x-10)*(x-10));  \
@@ -66,7 +66,7 @@ if( (8.0<=x) && (x <= 12.0)) {          \
 }
 
 
-#define SWEAVSourceTerms2D(xl, yl, t, h, q, p, s1, s2, s3) \
+#define SWESourceTerms2D(xl, yl, t, h, q, p, s1, s2, s3) \
 {                                       \
 if( (8.0<=xl) && (xl <= 12.0)) {              \
     *s2=-p_grav*h*(-0.10*xl+1.0);        \
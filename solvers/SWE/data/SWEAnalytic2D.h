@@ -39,10 +39,24 @@ SOFTWARE.
   }                                     \
 }
 
+// Derivative conditions (only used with a VISCOSITY TYPE)
+#define SWEDerivativeConditions2D(bc, t, x, y, nx, ny, dhdxM, dhdyM, dudxM, dudyM, dvdxM, dvdyM, dhdxB, dhdyB, dudxB, dudyB, dvdxB, dvdyB) \
+{                                       \
+  \
+}
+
 // Initial conditions
-#define SWEInitialConditions2D(t, x, y, h, q, p) \
+#define SWEInitialConditions2D(t, x, y, elementInfo, elementInfo2, h, q, p) \
 {                                       \
   *(h) = cos(-t + x)*cos(-t + y) + 2.0;      \
   *(q) = sin(x-t);                          \
   *(p) = sin(y-t);                          \
 }
+
+// Source terms
+#define SWESourceTerms2D(xl, yl, t, h, q, p, s1, s2, s3) \
+{                                       \
+  *s1=-sin(t-xl)*cos(t-yl)-cos(t-xl)*sin(t-yl)+cos(t-xl)+cos(t-yl); \
+  *s2=-cos(-xl+t)-sin(-xl+t)*sin(-xl+t)*sin(-xl+t)*cos(-yl+t)/ ((cos(-xl+t)*cos(-yl+t)+2)*(cos(-xl+t)*cos(-yl+t)+2) ) -2*sin(-xl + t)*cos(-xl + t)/(cos(-xl + t)*cos(-yl + t) + 2) +p_grav*(cos(-xl + t)*cos(-yl + t) + 2)*sin(-xl + t)*cos(-yl + t) -sin(-yl + t)*sin(-yl + t)*sin(-xl + t)*cos(-xl + t)/((cos(-xl + t)*cos(-yl + t) + 2)*(cos(-xl + t)*cos(-yl + t) + 2))-cos(-yl + t)*sin(-xl + t)/(cos(-xl + t)*cos(-yl + t) + 2); \
+  *s3=-cos(-yl + t) - sin(-yl + t)*sin(-xl + t)*sin(-xl + t)*cos(-yl + t)/((cos(-xl + t)*cos(-yl + t) + 2)*(cos(-xl + t)*cos(-yl + t) + 2))- sin(-yl + t)*cos(-xl + t)/(cos(-xl + t)*cos(-yl + t) + 2)- sin(-yl + t)*sin(-yl + t)*sin(-yl + t)*cos(-xl + t)/((cos(-xl + t)*cos(-yl + t) + 2)*(cos(-xl + t)*cos(-yl + t) + 2))- 2*sin(-yl + t)*cos(-yl + t)/(cos(-xl + t)*cos(-yl + t) + 2)+ p_grav*(cos(-xl + t)*cos(-yl + t) + 2)*cos(-xl + t)*sin(-yl + t); \
+}
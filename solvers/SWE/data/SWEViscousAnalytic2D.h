@@ -60,10 +60,17 @@ SOFTWARE.
 
 
 // Initial conditions
-#define SWEInitialConditions2D(t, x, y, h, q, p) \
+#define SWEInitialConditions2D(t, x, y, elementInfo, elementInfo2, h, q, p) \
 {                                       \
   *(h) = cos(-t + x)*cos(-t + y) + 2.0;      \
   *(q) = sin(x-t);                          \
   *(p) = sin(y-t);                          \
 }
 
+// Source terms, including the unit viscous terms
+#define SWESourceTerms2D(xl, yl, t, h, q, p, s1, s2, s3) \
+{                                       \
+  *s1=-sin(-xl+t)*cos(-yl+t)-sin(-yl+t)*cos(-xl+t)+cos(-xl+t)+cos(-yl+t)+2*cos(-xl+t)*cos(-yl+t); \
+  *s2=-cos(-xl+t)-1/((cos(-xl+t)*cos(-yl+t)+2)*(cos(-xl+t)*cos(-yl+t)+2))*(sin(-xl+t)*sin(-xl+t)*sin(-xl+t))*cos(-yl+t)-2/(cos(-xl+t)*cos(-yl+t)+2)*sin(-xl+t)*cos(-xl+t)+p_grav*(cos(-xl+t)*cos(-yl+t)+2)*sin(-xl+t)*cos(-yl+t)-1/((cos(-xl+t)*cos(-yl+t)+2)*(cos(-xl+t)*cos(-yl+t)+2))*sin(-yl+t)*sin(-yl+t)*sin(-xl+t)*cos(-xl+t)-1/(cos(-xl+t)*cos(-yl+t)+2)*cos(-yl+t)*sin(-xl+t)-sin(-xl+t); \
+  *s3=-cos(-yl+t)-1/((cos(-xl+t)*cos(-yl+t)+2)*(cos(-xl+t)*cos(-yl+t)+2))*sin(-yl+t)*sin(-xl+t)*sin(-xl+t)*cos(-yl+t)-1/(cos(-xl+t)*cos(-yl+t)+2)*sin(-yl+t)*cos(-xl+t)-1/((cos(-xl+t)*cos(-yl+t)+2)*(cos(-xl+t)*cos(-yl+t)+2))*sin(-yl+t)*sin(-yl+t)*sin(-yl+t)*cos(-xl+t)-2/(cos(-xl+t)*cos(-yl+t)+2)*sin(-yl+t)*cos(-yl+t)+p_grav*(cos(-xl+t)*cos(-yl+t)+2)*sin(-yl+t)*cos(-xl+t)-sin(-yl+t); \
+}
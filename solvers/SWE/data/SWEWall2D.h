@@ -39,8 +39,14 @@ SOFTWARE.
   }                                     \
 }
 
+// Derivative conditions (only used with a VISCOSITY TYPE)
+#define SWEDerivativeConditions2D(bc, t, x, y, nx, ny, dhdxM, dhdyM, dudxM, dudyM, dvdxM, dvdyM, dhdxB, dhdyB, dudxB, dudyB, dvdxB, dvdyB) \
+{                                       \
+  \
+}
+
 // Initial conditions
-#define SWEInitialConditions2D(t, x, y, h, q, p) \
+#define SWEInitialConditions2D(t, x, y, elementInfo, elementInfo2, h, q, p) \
 {                                   \
     if(x < 105) {                   \
         *(h) = 10;                  \
@@ -50,3 +56,11 @@ SOFTWARE.
     *(q)=0;                         \
     *(p)=0;                          \
 }
+
+// Source terms
+#define SWESourceTerms2D(xl, yl, t, h, q, p, s1, s2, s3) \
+{                                       \
+  *s1=0.0; \
+  *s2=0.0; \
+  *s3=0.0; \
+}
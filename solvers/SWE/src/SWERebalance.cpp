@@ -0,0 +1,170 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "SWE.hpp"
+#include "timer.hpp"
+
+//Measure the per-element cost. Elements are grouped into classes by
+// the work they trigger: curved triangles take their own path through
+// the per-element cubature operators, and elements where the artificial
+// viscosity is switched on are the ones the shock capturing is working
+// on. The element-list parts of rhsf are timed on each class with the
+// current solution, so the costs follow the activity of the last window.
+// Timings are summed over all ranks before forming the ratios, so every
+// rank assigns the same cost to the same class of element and timing
+// noise on one rank cannot register as an imbalance.
+void SWE_t::ElementCosts(memory<dfloat>& cost, const dfloat time){
+
+  constexpr int Nclasses=4;
+  constexpr int curvedClass=2;
+  constexpr int activeClass=1;
+
+  //find where the viscosity is active
+  if (artificialViscosity) {
+    o_mu.copyTo(mu, mesh.Nelements);
+  }
+
+  //sort the local elements into classes
+  memory<int> elementClass(mesh.Nelements);
+  memory<dlong> classCounts(Nclasses);
+  for (int c=0;c<Nclasses;++c) classCounts[c]=0;
+
+  for (dlong e=0;e<mesh.Nelements;++e) {
+    int c=0;
+    if (mesh.elementType==Mesh::CURVEDTRIANGLES && mesh.mapCurv[e]>=0) c+=curvedClass;
+    if (artificialViscosity && mu[e]>0.0) c+=activeClass;
+    elementClass[e] = c;
+    classCounts[c]++;
+  }
+
+  memory<dlong> classOffsets(Nclasses+1);
+  classOffsets[0]=0;
+  for (int c=0;c<Nclasses;++c) classOffsets[c+1] = classOffsets[c]+classCounts[c];
+
+  memory<dlong> classIds(mesh.Nelements);
+  for (int c=0;c<Nclasses;++c) classCounts[c]=0;
+  for (dlong e=0;e<mesh.Nelements;++e) {
+    const int c = elementClass[e];
+    classIds[classOffsets[c] + classCounts[c]++] = e;
+  }
+
+  memory<hlong> classCountsGlobal(Nclasses);
+  for (int c=0;c<Nclasses;++c) classCountsGlobal[c]=classCounts[c];
+  comm.Allreduce(classCountsGlobal);
+
+  cost.malloc(mesh.Nelements);
+  for (dlong e=0;e<mesh.Nelements;++e) {
+    cost[e] = 1.0;
+  }
+
+  int NclassesPresent=0;
+  for (int c=0;c<Nclasses;++c) NclassesPresent += (classCountsGlobal[c]>0) ? 1 : 0;
+  if (NclassesPresent<2) return;
+
+  //the timed kernels write gradients and rhs for the listed elements only,
+  // rhsf recomputes both before they are next used
+  dlong Nlocal = mesh.Nelements*mesh.Np*Nfields;
+  deviceMemory<dfloat> o_rhs = platform.malloc<dfloat>(Nlocal);
+
+  auto classWork = [&](const dlong N, deviceMemory<dlong>& o_ids) {
+    if (viscous) GradSurface(N, o_ids, o_q, time);
+    if (artificialViscosity) ViscositySmooth(N, o_ids);
+    Surface(N, o_ids, o_q, o_rhs, time);
+  };
+
+  constexpr int Ntests=10;
+
+  memory<dfloat> classTimes(Nclasses);
+  for (int c=0;c<Nclasses;++c) {
+    classTimes[c]=0.0;
+    if (classCountsGlobal[c]==0) continue;
+
+    deviceMemory<dlong> o_ids = platform.malloc<dlong>(classCounts[c],
+                                                       classIds+classOffsets[c]);
+    //warm up
+    classWork(classCounts[c], o_ids);
+
+    timePoint_t start = PlatformTime(platform);
+    for (int n=0;n<Ntests;++n) {
+      classWork(classCounts[c], o_ids);
+    }
+    timePoint_t end = PlatformTime(platform);
+    classTimes[c] = ElapsedTime(start, end);
+  }
+  comm.Allreduce(classTimes);
+
+  //cost of each class relative to the cheapest one
+  dfloat minCost=-1.0;
+  memory<dfloat> classCosts(Nclasses);
+  for (int c=0;c<Nclasses;++c) {
+    classCosts[c] = 0.0;
+    if (classCountsGlobal[c]==0) continue;
+    classCosts[c] = classTimes[c]/classCountsGlobal[c];
+    minCost = (minCost<0.0) ? classCosts[c] : std::min(minCost, classCosts[c]);
+  }
+  if (minCost<=0.0) return;
+
+  for (dlong e=0;e<mesh.Nelements;++e) {
+    cost[e] = classCosts[elementClass[e]]/minCost;
+  }
+}
+
+void SWE_t::Rebalance(const dfloat time){
+
+  dfloat tolerance=1.1;
+  settings.getSetting("REBALANCE TOLERANCE", tolerance);
+
+  dfloat margin=0.05;
+  settings.getSetting("REBALANCE MARGIN", margin);
+
+  memory<dfloat> cost;
+  ElementCosts(cost, time);
+
+  //pull the solution to the host before the mesh changes under it
+  dlong Nlocal = mesh.Nelements*mesh.Np*Nfields;
+  memory<dfloat> qLocal(Nlocal);
+  o_q.copyTo(qLocal, Nlocal);
+
+  if (!mesh.Rebalance(cost, tolerance, margin)) return;
+
+  //move the solution with its elements
+  mesh.Migrate(qLocal, mesh.Np*Nfields);
+
+  //rebuild halos, fields, and time stepper on the new partition. The
+  // kernels, including any tuned configuration, are kept as they are
+  vtu.Remesh(mesh);
+  SetupSolver();
+
+  Nlocal = mesh.Nelements*mesh.Np*Nfields;
+  o_q.copyFrom(qLocal, Nlocal);
+
+  //the characteristic lengths are per element
+  hmin = mesh.MinCharacteristicLength();
+
+  MaxTimeStepStart(o_q, time);
+  timeStepper.SetTimeStep(MaxTimeStepFinish());
+}
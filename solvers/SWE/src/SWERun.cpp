@@ -37,22 +37,45 @@ void SWE_t::Run(){
                          mesh.o_x,
                          mesh.o_y,
                          mesh.o_z,
+                         mesh.o_elementInfo,
+                         mesh.o_elementInfo2,
                          o_q);
 
-  dfloat cfl=1.0;
+  cfl=1.0;
   settings.getSetting("CFL NUMBER", cfl);
 
   // set time step
-  dfloat hmin = mesh.MinCharacteristicLength();
-  dfloat vmax = MaxWaveSpeed();
+  hmin = mesh.MinCharacteristicLength();
 
-  dfloat dt = cfl*hmin/(vmax*(mesh.N+1.)*(mesh.N+1.));
+  MaxTimeStepStart(o_q, startTime);
+  dfloat dt = MaxTimeStepFinish();
   timeStepper.SetTimeStep(dt);
   printf("timestep = %17.15lg\n", dt);
 
   printf("hmin = %17.15lg\n", hmin);
 
-  timeStepper.Run(*this, o_q, startTime, finalTime);
+  dfloat rebalanceInterval=0.0;
+  settings.getSetting("REBALANCE INTERVAL", rebalanceInterval);
+
+  if (rebalanceInterval>0.0) {
+    LIBP_ABORT("SWE rebalancing requires TIME INTEGRATOR DOPRI5",
+               !settings.compareSetting("TIME INTEGRATOR","DOPRI5"));
+
+    //integrate in windows, checking the load balance between them
+    dfloat time = startTime;
+    while (time<finalTime) {
+      const dfloat endTime = std::min(time+rebalanceInterval, finalTime);
+      timeStepper.Run(*this, o_q, time, endTime);
+      time = endTime;
+
+      if (time<finalTime) {
+        Rebalance(time);
+        resuming = true;
+      }
+    }
+  } else {
+    timeStepper.Run(*this, o_q, startTime, finalTime);
+  }
 
   // output norm of final solution
   {
@@ -65,4 +88,7 @@ void SWE_t::Run(){
     if(mesh.rank==0)
       printf("Solution norm = %17.15lg\n", norm2);
   }
+
+  //wait for queued output to reach disk
+  vtu.Flush();
 }
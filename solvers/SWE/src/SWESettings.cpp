@@ -39,6 +39,11 @@ SWESettings_t::SWESettings_t(comm_t _comm):
              "Integration type for flux terms",
              {"COLLOCATION", "CUBATURE"});
 
+  newSetting("VISCOSITY TYPE",
+             "NONE",
+             "Viscous terms added to the flux",
+             {"NONE", "PHYSICAL", "ARTIFICIAL"});
+
   newSetting("TIME INTEGRATOR",
              "DOPRI5",
              "Time integration method",
@@ -67,6 +72,20 @@ SWESettings_t::SWESettings_t(comm_t _comm):
 
   newSetting("OUTPUT FILE NAME",
              "SWE");
+
+  newSetting("REBALANCE INTERVAL",
+             "0",
+             "Time between load balance checks (0 disables rebalancing)");
+
+  newSetting("REBALANCE TOLERANCE",
+             "1.1",
+             "Rank cost imbalance (max/avg) above which the mesh is repartitioned");
+
+  newSetting("REBALANCE MARGIN",
+             "0.05",
+             "Minimum drop in cost imbalance a repartition must give for elements to migrate");
+
+  TimeStepper::AddSettings(*this);
 }
 
 void SWESettings_t::report() {
@@ -74,12 +93,23 @@ void SWESettings_t::report() {
   if (comm.rank()==0) {
     std::cout << "SWE Settings:\n\n";
     reportSetting("DATA FILE");
+    reportSetting("ADVECTION TYPE");
+    reportSetting("VISCOSITY TYPE");
     reportSetting("TIME INTEGRATOR");
     reportSetting("START TIME");
     reportSetting("FINAL TIME");
     reportSetting("OUTPUT INTERVAL");
     reportSetting("OUTPUT TO FILE");
     reportSetting("OUTPUT FILE NAME");
+
+    dfloat rebalanceInterval=0.0;
+    getSetting("REBALANCE INTERVAL", rebalanceInterval);
+    if (rebalanceInterval>0.0) {
+      reportSetting("REBALANCE INTERVAL");
+      reportSetting("REBALANCE TOLERANCE");
+      reportSetting("REBALANCE MARGIN");
+    }
+    TimeStepper::ReportSettings(*this);
   }
 }
 
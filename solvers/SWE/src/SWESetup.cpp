@@ -34,17 +34,42 @@ void SWE_t::Setup(platform_t& _platform, mesh_t& _mesh,
   comm = _mesh.comm;
   settings = _settings;
 
+  //setup field output
+  vtu.Setup(mesh);
+
+  SetupSolver();
+  SetupKernels();
+}
+
+//build fields, halos, and time stepper on the current mesh partition
+void SWE_t::SetupSolver(){
+
   Nfields = (mesh.dim==3) ? 4:3;
+  Ngrads = 6;
 
   dlong Nlocal = mesh.Nelements*mesh.Np*Nfields;
   dlong Nhalo  = mesh.totalHaloPairs*mesh.Np*Nfields;
 
+  dlong NlocalGrads = mesh.Nelements*mesh.Np*Ngrads;
+  dlong NhaloGrads  = mesh.totalHaloPairs*mesh.Np*Ngrads;
 
+  cubature   = (settings.compareSetting("ADVECTION TYPE", "CUBATURE")) ? 1:0;
 
-  //Trigger JIT kernel builds
-  ogs::InitializeKernels(platform, ogs::Dfloat, ogs::Add);
+  artificialViscosity = (settings.compareSetting("VISCOSITY TYPE", "ARTIFICIAL")) ? 1:0;
+  viscous = (artificialViscosity
+             || settings.compareSetting("VISCOSITY TYPE", "PHYSICAL")) ? 1:0;
 
-  cubature   = (settings.compareSetting("ADVECTION TYPE", "CUBATURE")) ? 1:0;
+  if (cubature && mesh.elementType==Mesh::QUADRILATERALS) {
+    LIBP_FORCE_ABORT("SWE cubature kernels are only available for triangles, use ADVECTION TYPE COLLOCATION on quadrilaterals");
+  }
+
+  if (viscous && !cubature && mesh.elementType!=Mesh::QUADRILATERALS) {
+    LIBP_FORCE_ABORT("SWE viscous terms on triangles require ADVECTION TYPE CUBATURE");
+  }
+
+  //the viscosity sensor fits a decay rate to modes 1..N of each face
+  LIBP_ABORT("SWE artificial viscosity requires polynomial degree N>=2",
+             artificialViscosity && mesh.N<2);
 
   if (cubature) {
     mesh.CubatureSetup();
@@ -52,10 +77,48 @@ void SWE_t::Setup(platform_t& _platform, mesh_t& _mesh,
   }
 
   //setup linear algebra module
-  platform.linAlg().InitKernels({"innerProd"});
+  platform.linAlg().InitKernels({"innerProd","max"});
 
   /*setup trace halo exchange */
-  traceHalo = mesh.HaloTraceSetup(Nfields);
+  fieldTraceHalo = mesh.HaloTraceSetup(Nfields);
+  if (viscous) {
+    gradTraceHalo  = mesh.HaloTraceSetup(Ngrads);
+  }
+
+  //the viscosity smoother needs the vertex neighbors of each element
+  if (artificialViscosity) {
+    meshPatch = mesh.SetupRingPatch();
+
+    //split elements by whether any vertex neighbor lives in the ring
+    memory<int> ringFlag(mesh.Nelements);
+    NringHaloElements = 0;
+    for(dlong e=0;e<mesh.Nelements;++e){
+      ringFlag[e] = 0;
+      for(int v=0;v<mesh.Nverts;++v){
+        const dlong id = e*mesh.Nverts+v;
+        for(int i=0;i<meshPatch.Vcounts[id];++i){
+          if (meshPatch.EToN[id*mesh_t::maxVToE+i]>=mesh.Nelements)
+            ringFlag[e] = 1;
+        }
+      }
+      NringHaloElements += ringFlag[e];
+    }
+    NringInternalElements = mesh.Nelements - NringHaloElements;
+
+    ringInternalElementIds.malloc(NringInternalElements);
+    ringHaloElementIds.malloc(NringHaloElements);
+
+    NringHaloElements = 0, NringInternalElements = 0;
+    for(dlong e=0;e<mesh.Nelements;++e){
+      if (ringFlag[e])
+        ringHaloElementIds[NringHaloElements++] = e;
+      else
+        ringInternalElementIds[NringInternalElements++] = e;
+    }
+
+    o_ringInternalElementIds = platform.malloc<dlong>(ringInternalElementIds);
+    o_ringHaloElementIds = platform.malloc<dlong>(ringHaloElementIds);
+  }
 
   //setup timeStepper
   if (settings.compareSetting("TIME INTEGRATOR","AB3")){
@@ -74,20 +137,43 @@ void SWE_t::Setup(platform_t& _platform, mesh_t& _mesh,
     timeStepper.Setup<TimeStepper::ssprk2>(mesh.Nelements,
                                            mesh.totalHaloPairs,
                                            mesh.Np, Nfields, platform, comm);
+  } else {
+    LIBP_FORCE_ABORT("Requested TIME INTEGRATOR not found.");
   }
 
-  // set penalty parameter
-  dfloat Lambda2 = 0.5;
-  dfloat p_grav = 9.81;
-
   // compute samples of q at interpolation nodes
   q.malloc(Nlocal+Nhalo);
   o_q = platform.malloc<dfloat>(q);
 
+  if (viscous) {
+    gradq.malloc(NlocalGrads+NhaloGrads);
+    o_gradq = platform.malloc<dfloat>(gradq);
+  }
+
+  if (artificialViscosity) {
+    mu.malloc(mesh.Nelements+mesh.totalRingElements);
+    o_mu = platform.malloc<dfloat>(mu);
+  }
+
   //storage for M*q during reporting
   o_Mq = platform.malloc<dfloat>(q);
   mesh.MassMatrixKernelSetup(Nfields); // mass matrix operator
 
+  o_maxSpeed = platform.malloc<dfloat>(mesh.Nelements);
+  h_maxSpeed = platform.hostMalloc<dfloat>(1);
+}
+
+//build the solver kernels. Their defines do not depend on the mesh
+// partition, so they are kept when the mesh is rebalanced
+void SWE_t::SetupKernels(){
+
+  //Trigger JIT kernel builds
+  ogs::InitializeKernels(platform, ogs::Dfloat, ogs::Add);
+
+  // set penalty parameter
+  dfloat Lambda2 = 0.5;
+  dfloat p_grav = 9.81;
+
   // OCCA build stuff
   properties_t kernelInfo = mesh.props; //copy base occa properties
 
@@ -97,6 +183,7 @@ void SWE_t::Setup(platform_t& _platform, mesh_t& _mesh,
   kernelInfo["includes"] += dataFileName;
 
   kernelInfo["defines/" "p_Nfields"]= Nfields;
+  kernelInfo["defines/" "p_Ngrads"]= Ngrads;
 
   const dfloat p_half = 1./2.;
   kernelInfo["defines/" "p_half"]= p_half;
@@ -106,8 +193,13 @@ void SWE_t::Setup(platform_t& _platform, mesh_t& _mesh,
 
   kernelInfo["defines/" "p_grav"]= p_grav;
 
- 
-  
+  kernelInfo["defines/" "p_viscous"]= viscous;
+  kernelInfo["defines/" "p_artificialViscosity"]= artificialViscosity;
+
+  //viscosity is smoothed through a degree 2 element
+  const int NpSmooth = (mesh.elementType==Mesh::QUADRILATERALS) ? 9 : 6;
+  kernelInfo["defines/" "p_NSmooth"] = 2;
+  kernelInfo["defines/" "p_NpSmooth"]= NpSmooth;
 
   int maxNodes = std::max(mesh.Np, (mesh.Nfp*mesh.Nfaces));
   kernelInfo["defines/" "p_maxNodes"]= maxNodes;
@@ -123,7 +215,7 @@ void SWE_t::Setup(platform_t& _platform, mesh_t& _mesh,
 
   kernelInfo["defines/" "p_Lambda2"]= Lambda2;
 
-if (cubature) {
+  if (cubature) {
     int cubMaxNodes = std::max(mesh.Np, (mesh.intNfp*mesh.Nfaces));
     kernelInfo["defines/" "p_cubMaxNodes"]= cubMaxNodes;
     int cubMaxNodes1 = std::max(mesh.Np, (mesh.intNfp));
@@ -136,10 +228,6 @@ if (cubature) {
     kernelInfo["defines/" "p_cubNblockS"]= cubNblockS;
   }
 
-
-  
-  //kernelInfo["defines/" "g"] = g;
-
   // set kernel name suffix
   std::string suffix;
   if(mesh.elementType==Mesh::TRIANGLES)
@@ -158,21 +246,35 @@ if (cubature) {
 
   std::string fileName, kernelName;
 
-if (cubature) {
-  // kernels from volume file
+  if (viscous) {
+    // kernels from volume file
+    fileName   = oklFilePrefix + "SWEGradVolume" + suffix + oklFileSuffix;
+    kernelName = "SWEGradVolume" + suffix;
+
+    gradVolumeKernel =  platform.buildKernel(fileName, kernelName,
+                                             kernelInfo);
+    // kernels from surface file
+    fileName   = oklFilePrefix + "SWEGradSurface" + suffix + oklFileSuffix;
+    kernelName = "SWEGradSurface" + suffix;
+
+    gradSurfaceKernel = platform.buildKernel(fileName, kernelName,
+                                             kernelInfo);
+  }
+
+  if (cubature) {
+    // kernels from volume file
     fileName   = oklFilePrefix + "SWECubatureVolume" + suffix + oklFileSuffix;
     kernelName = "SWECubatureVolume" + suffix;
 
     cubatureVolumeKernel =  platform.buildKernel(fileName, kernelName,
-                                         kernelInfo);
+                                                 kernelInfo);
     // kernels from surface file
     fileName   = oklFilePrefix + "SWECubatureSurface" + suffix + oklFileSuffix;
     kernelName = "SWECubatureSurface" + suffix;
 
     cubatureSurfaceKernel = platform.buildKernel(fileName, kernelName,
-                                         kernelInfo);
-  }
-  else {
+                                                 kernelInfo);
+  } else {
     fileName   = oklFilePrefix + "SWEVolume" + suffix + oklFileSuffix;
     kernelName = "SWEVolume" + suffix;
 
@@ -182,8 +284,48 @@ if (cubature) {
     fileName   = oklFilePrefix + "SWESurface" + suffix + oklFileSuffix;
     kernelName = "SWESurface" + suffix;
 
-    surfaceKernel = platform.buildKernel(fileName, kernelName,
-                                         kernelInfo);
+    if (platform.settings().compareSetting("KERNEL TUNING", "TRUE")) {
+      //time the surface kernel over element block sizes on scratch data
+      std::vector<int> candidates;
+      for (int nb=1; nb*maxNodes<=1024 && nb<=64; nb*=2) candidates.push_back(nb);
+
+      dlong Nlocal = mesh.Nelements*mesh.Np*Nfields;
+      dlong Nhalo  = mesh.totalHaloPairs*mesh.Np*Nfields;
+      memory<dfloat> qTune(Nlocal+Nhalo, 1.0);
+      deviceMemory<dfloat> o_qTune   = platform.malloc<dfloat>(qTune);
+      deviceMemory<dfloat> o_rhsTune = platform.malloc<dfloat>(Nlocal);
+
+      //zeroed gradients, so the inviscid run does not read o_gradq unallocated
+      // and the viscous variant is not timed on uninitialized data
+      memory<dfloat> gradqTune((mesh.Nelements+mesh.totalHaloPairs)*mesh.Np*Ngrads, 0.0);
+      deviceMemory<dfloat> o_gradqTune = platform.malloc<dfloat>(gradqTune);
+
+      memory<dlong> elementIds(mesh.Nelements);
+      for (dlong e=0;e<mesh.Nelements;++e) elementIds[e] = e;
+      deviceMemory<dlong> o_elementIds = platform.malloc<dlong>(elementIds);
+
+      surfaceKernel = platform.tuneKernel(fileName, kernelName, kernelInfo,
+                                          "p_NblockS", candidates,
+                                          [&](kernel_t& kernel) {
+                                            kernel(mesh.Nelements,
+                                                   o_elementIds,
+                                                   mesh.o_sgeo,
+                                                   mesh.o_LIFT,
+                                                   mesh.o_vmapM,
+                                                   mesh.o_vmapP,
+                                                   mesh.o_EToB,
+                                                   0.0,
+                                                   mesh.o_x,
+                                                   mesh.o_y,
+                                                   mesh.o_z,
+                                                   o_qTune,
+                                                   o_gradqTune,
+                                                   o_rhsTune);
+                                          });
+    } else {
+      surfaceKernel = platform.buildKernel(fileName, kernelName,
+                                           kernelInfo);
+    }
   }
 
   if (mesh.dim==2) {
@@ -196,4 +338,58 @@ if (cubature) {
 
   initialConditionKernel = platform.buildKernel(fileName, kernelName,
                                                   kernelInfo);
+
+  //wave speeds only read nodal values, so curved triangles share the
+  // straight-sided kernel
+  const std::string waveSpeedSuffix =
+    (mesh.elementType==Mesh::CURVEDTRIANGLES) ? "Tri2D" : suffix;
+  fileName   = oklFilePrefix + "SWEMaxWaveSpeed" + waveSpeedSuffix + oklFileSuffix;
+  kernelName = "SWEMaxWaveSpeed" + waveSpeedSuffix;
+
+  maxWaveSpeedKernel = platform.buildKernel(fileName, kernelName,
+                                            kernelInfo);
+
+  if (artificialViscosity) {
+    fileName   = oklFilePrefix + "SWEViscosity" + suffix + oklFileSuffix;
+    kernelName = "SWEViscosity" + suffix;
+
+    viscosityKernel = platform.buildKernel(fileName, kernelName,
+                                           kernelInfo);
+
+    fileName   = oklFilePrefix + "SWEViscositySmooth" + suffix + oklFileSuffix;
+    kernelName = "SWEViscositySmooth" + suffix;
+
+    viscositySmoothKernel = platform.buildKernel(fileName, kernelName,
+                                                 kernelInfo);
+  }
+
+  //leading order bytes and flops per element of the rhs kernels, for
+  // the profiler. Quadrilaterals store geometric factors per node and
+  // differentiate and lift one line of nodes at a time, triangles store
+  // them per element and face and apply dense element matrices
+  const bool quad = (mesh.elementType==Mesh::QUADRILATERALS);
+  const double b  = sizeof(dfloat);
+  const double bi = sizeof(dlong);
+  const double Nfp   = mesh.Nfaces*mesh.Nfp;
+  const double vgeo  = quad ? mesh.Nvgeo*mesh.Np : mesh.Nvgeo;
+  const double sgeo  = quad ? mesh.Nsgeo*Nfp : mesh.Nsgeo*mesh.Nfaces;
+  const double line  = quad ? mesh.Nq : mesh.Np;
+  const double lift  = quad ? 1 : mesh.Np;
+  const double grads = viscous ? mesh.Np*Ngrads : 0;
+  const double faceGrads = viscous ? 2*Nfp*Ngrads : 0;
+  const double faceBytes = bi*(1 + 2*Nfp) + b*(sgeo + 2*Nfp*Nfields + faceGrads
+                                               + 2*mesh.Np*Nfields);
+
+  if (cubature) {
+    const double cubNfp = mesh.Nfaces*mesh.intNfp;
+    cubatureVolumeKernel.SetModel(b*(vgeo + 2*mesh.Np*Nfields + grads),
+                                  6.0*mesh.cubNp*mesh.Np*Nfields);
+    cubatureSurfaceKernel.SetModel(faceBytes,
+                                   4.0*cubNfp*mesh.Nfp*Nfields + 2.0*mesh.Np*cubNfp*Nfields);
+  } else {
+    volumeKernel.SetModel(b*(vgeo + 2*mesh.Np + 2*mesh.Np*Nfields + grads),
+                          8.0*line*mesh.Np*Nfields);
+    surfaceKernel.SetModel(faceBytes, 2.0*lift*Nfp*Nfields);
+  }
 }
+
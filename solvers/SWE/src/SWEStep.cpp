@@ -26,20 +26,112 @@ SOFTWARE.
 
 #include "SWE.hpp"
 
-dfloat SWE_t::MaxWaveSpeed(){
-  //wavespeed is constant 1 everywhere
-  const dfloat vmax = 1.0;
-  return vmax;
+void SWE_t::ElementWaveSpeeds(deviceMemory<dfloat>& o_Q, const dfloat T){
+  maxWaveSpeedKernel(mesh.Nelements,
+                     mesh.o_vgeo,
+                     mesh.o_sgeo,
+                     mesh.o_vmapM,
+                     mesh.o_EToB,
+                     T,
+                     mesh.o_x,
+                     mesh.o_y,
+                     mesh.o_z,
+                     o_Q,
+                     mesh.o_hs,
+                     o_maxSpeed);
 }
 
-//evaluate ODE rhs = f(q,t)
-void SWE_t::rhsf(deviceMemory<dfloat>& o_Q, deviceMemory<dfloat>& o_RHS, const dfloat T){
+void SWE_t::MaxWaveSpeedStart(deviceMemory<dfloat>& o_Q, const dfloat T){
+  ElementWaveSpeeds(o_Q, T);
+
+  h_maxSpeed[0] = platform.linAlg().max(mesh.Nelements, o_maxSpeed);
+  mesh.comm.Iallreduce(h_maxSpeed, Comm::Max, 1, maxSpeedRequest);
+}
+
+dfloat SWE_t::MaxWaveSpeedFinish(){
+  mesh.comm.Wait(maxSpeedRequest);
+  return h_maxSpeed[0];
+}
+
+dfloat SWE_t::MaxWaveSpeed(deviceMemory<dfloat>& o_Q, const dfloat T){
+  MaxWaveSpeedStart(o_Q, T);
+  return MaxWaveSpeedFinish();
+}
+
+//CFL stable time step from the current wave speeds
+void SWE_t::MaxTimeStepStart(deviceMemory<dfloat>& o_Q, const dfloat T){
+  MaxWaveSpeedStart(o_Q, T);
+}
+
+dfloat SWE_t::MaxTimeStepFinish(){
+  const dfloat vmax = MaxWaveSpeedFinish();
+  return cfl*hmin/(vmax*(mesh.N+1.)*(mesh.N+1.));
+}
+
+//lift the gradient surface terms for a subset of elements
+void SWE_t::GradSurface(const dlong Nelements, deviceMemory<dlong>& o_elementIds,
+                        deviceMemory<dfloat>& o_Q, const dfloat T){
+  if (!Nelements) return;
 
-  // extract q halo on DEVICE
-  
-  traceHalo.ExchangeStart(o_Q, 1);
   if (cubature) {
-        cubatureVolumeKernel(mesh.Nelements,
+    gradSurfaceKernel(Nelements,
+                      o_elementIds,
+                      mesh.o_cubsgeo,
+                      mesh.o_cubsgeoCurv,
+                      mesh.o_mapCurv,
+                      mesh.o_LIFT,
+                      mesh.o_vmapM,
+                      mesh.o_vmapP,
+                      mesh.o_EToB,
+                      mesh.o_x,
+                      mesh.o_y,
+                      mesh.o_z,
+                      mesh.o_intInterp,
+                      mesh.o_intLIFT,
+                      mesh.o_intLIFTs,
+                      mesh.o_intx,
+                      mesh.o_inty,
+                      mesh.o_intz,
+                      T,
+                      o_Q,
+                      o_gradq);
+  } else {
+    gradSurfaceKernel(Nelements,
+                      o_elementIds,
+                      mesh.o_sgeo,
+                      mesh.o_LIFT,
+                      mesh.o_vmapM,
+                      mesh.o_vmapP,
+                      mesh.o_EToB,
+                      mesh.o_x,
+                      mesh.o_y,
+                      mesh.o_z,
+                      T,
+                      o_Q,
+                      o_gradq);
+  }
+}
+
+//scale the gradients by the smoothed viscosity for a subset of elements
+void SWE_t::ViscositySmooth(const dlong Nelements, deviceMemory<dlong>& o_elementIds){
+  if (!Nelements) return;
+
+  viscositySmoothKernel(Nelements,
+                        o_elementIds,
+                        meshPatch.o_vmapP,
+                        mesh.o_muInterp,
+                        meshPatch.o_EToN,
+                        meshPatch.o_Vcounts,
+                        o_mu,
+                        o_gradq);
+}
+
+//volume terms for all elements
+void SWE_t::Volume(deviceMemory<dfloat>& o_Q, deviceMemory<dfloat>& o_RHS,
+                   const dfloat T){
+
+  if (cubature) {
+    cubatureVolumeKernel(mesh.Nelements,
                          mesh.o_cubvgeo,
                          mesh.o_cubvgeoCurv,
                          mesh.o_mapCurv,
@@ -53,41 +145,49 @@ void SWE_t::rhsf(deviceMemory<dfloat>& o_Q, deviceMemory<dfloat>& o_RHS, const d
                          mesh.o_z,
                          T,
                          o_Q,
+                         o_gradq,
                          o_RHS);
-  }
-  else {
+  } else {
     volumeKernel(mesh.Nelements,
-               mesh.o_vgeo,
-               mesh.o_D,
-               T,
-               mesh.o_x,
-               mesh.o_y,
-               o_Q,
-               o_RHS);
+                 mesh.o_vgeo,
+                 mesh.o_D,
+                 T,
+                 mesh.o_x,
+                 mesh.o_y,
+                 o_Q,
+                 o_gradq,
+                 o_RHS);
   }
+}
 
-  traceHalo.ExchangeFinish(o_Q, 1);
+//lift the flux surface terms for a subset of elements
+void SWE_t::Surface(const dlong Nelements, deviceMemory<dlong>& o_elementIds,
+                    deviceMemory<dfloat>& o_Q, deviceMemory<dfloat>& o_RHS,
+                    const dfloat T){
+  if (!Nelements) return;
 
-    if (cubature) {
-            cubatureSurfaceKernel(mesh.Nelements,
-                            mesh.o_cubsgeo,
-                            mesh.o_cubsgeoCurv,
-                            mesh.o_mapCurv,
-                            mesh.o_vmapM,
-                            mesh.o_vmapP,
-                            mesh.o_EToB,
-                            mesh.o_intInterp,
-                            mesh.o_intLIFT,
-                            mesh.o_intLIFTs,
-                            mesh.o_intx,
-                            mesh.o_inty,
-                            mesh.o_intz,
-                            T,
-                            o_Q,
-                            o_RHS);
-    }
-    else {
-          surfaceKernel(mesh.Nelements,
+  if (cubature) {
+    cubatureSurfaceKernel(Nelements,
+                          o_elementIds,
+                          mesh.o_cubsgeo,
+                          mesh.o_cubsgeoCurv,
+                          mesh.o_mapCurv,
+                          mesh.o_vmapM,
+                          mesh.o_vmapP,
+                          mesh.o_EToB,
+                          mesh.o_intInterp,
+                          mesh.o_intLIFT,
+                          mesh.o_intLIFTs,
+                          mesh.o_intx,
+                          mesh.o_inty,
+                          mesh.o_intz,
+                          T,
+                          o_Q,
+                          o_gradq,
+                          o_RHS);
+  } else {
+    surfaceKernel(Nelements,
+                  o_elementIds,
                   mesh.o_sgeo,
                   mesh.o_LIFT,
                   mesh.o_vmapM,
@@ -98,6 +198,90 @@ void SWE_t::rhsf(deviceMemory<dfloat>& o_Q, deviceMemory<dfloat>& o_RHS, const d
                   mesh.o_y,
                   mesh.o_z,
                   o_Q,
+                  o_gradq,
                   o_RHS);
   }
 }
+
+//evaluate ODE rhs = f(q,t)
+// Interior elements are processed while the field, ring, and gradient
+// halo exchanges are in flight; halo elements are finished afterwards.
+void SWE_t::rhsf(deviceMemory<dfloat>& o_Q, deviceMemory<dfloat>& o_RHS, const dfloat T){
+
+  Profiler::Start("SWE rhs");
+
+  fieldTraceHalo.ExchangeStart(o_Q, 1);
+
+  if (artificialViscosity) {
+    // the viscosity only needs the local element wave speeds; the global
+    // max is reduced separately, and only when the time step is updated
+    ElementWaveSpeeds(o_Q, T);
+
+    viscosityKernel(mesh.Nelements,
+                    mesh.o_sgeo,
+                    mesh.o_sgeoCurv,
+                    mesh.o_mapCurv,
+                    mesh.o_vmapM,
+                    mesh.o_hs,
+                    mesh.o_invV1Ds,
+                    mesh.o_MM1Ds,
+                    o_maxSpeed,
+                    mesh.o_perfectDecay2,
+                    o_Q,
+                    o_mu);
+
+    mesh.ringHalo.ExchangeStart(o_mu,1);
+  }
+
+  if (viscous) {
+    if (cubature) {
+      gradVolumeKernel(mesh.Nelements,
+                       mesh.o_cubvgeo,
+                       mesh.o_cubvgeoCurv,
+                       mesh.o_mapCurv,
+                       mesh.o_Dw,
+                       mesh.o_cubPDT,
+                       mesh.o_cubPDTs,
+                       mesh.o_cubInterp,
+                       o_Q,
+                       o_gradq);
+    } else {
+      gradVolumeKernel(mesh.Nelements,
+                       mesh.o_vgeo,
+                       mesh.o_D,
+                       o_Q,
+                       o_gradq);
+    }
+
+    GradSurface(mesh.NinternalElements, mesh.o_internalElementIds, o_Q, T);
+
+    // elements with no ring neighbors only need the local viscosity
+    if (artificialViscosity)
+      ViscositySmooth(NringInternalElements, o_ringInternalElementIds);
+
+    fieldTraceHalo.ExchangeFinish(o_Q, 1);
+
+    GradSurface(mesh.NhaloElements, mesh.o_haloElementIds, o_Q, T);
+
+    if (artificialViscosity) {
+      mesh.ringHalo.ExchangeFinish(o_mu,1);
+      ViscositySmooth(NringHaloElements, o_ringHaloElementIds);
+    }
+
+    gradTraceHalo.ExchangeStart(o_gradq, 1);
+  }
+
+  Volume(o_Q, o_RHS, T);
+
+  Surface(mesh.NinternalElements, mesh.o_internalElementIds, o_Q, o_RHS, T);
+
+  if (viscous) {
+    gradTraceHalo.ExchangeFinish(o_gradq, 1);
+  } else {
+    fieldTraceHalo.ExchangeFinish(o_Q, 1);
+  }
+
+  Surface(mesh.NhaloElements, mesh.o_haloElementIds, o_Q, o_RHS, T);
+
+  Profiler::Stop("SWE rhs");
+}
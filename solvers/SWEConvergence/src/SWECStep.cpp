@@ -1,185 +0,0 @@
-/*
-
-The MIT License (MIT)
-
-Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-
-*/
-
-#include "SWEC.hpp"
-
-dfloat SWEC_t::MaxWaveSpeed(deviceMemory<dfloat>& o_Q, const dfloat T){
-  //Note: if this is on the critical path in the future, we should pre-allocate this
-  maxWaveSpeedKernel(mesh.Nelements,
-                     mesh.o_vgeo,
-                     mesh.o_sgeo,
-                     mesh.o_vmapM,
-                     mesh.o_EToB,
-                     T,
-                     mesh.o_x,
-                     mesh.o_y,
-                     mesh.o_z,
-                     o_Q,
-                     mesh.o_hs,
-                     o_maxSpeed);
-  
-  const dfloat vmax = platform.linAlg().max(mesh.Nelements, o_maxSpeed, mesh.comm);
-  return vmax;
-}
-
-//evaluate ODE rhs = f(q,t)
-void SWEC_t::rhsf(deviceMemory<dfloat>& o_Q, deviceMemory<dfloat>& o_RHS, const dfloat T){
-  
-  fieldTraceHalo.ExchangeStart(o_Q, 1);
-
-  MaxWaveSpeed(o_Q, T);
-
-
-  viscosityKernel(mesh.Nelements,
-                  mesh.o_sgeo,
-                  mesh.o_sgeoCurv,
-                  mesh.o_mapCurv,
-                  mesh.o_vmapM,
-                  mesh.o_hs,
-                  mesh.o_invV1Ds,
-                  mesh.o_MM1Ds,
-                  o_maxSpeed,
-                  mesh.o_perfectDecay2,
-                  o_Q,
-                  o_mu);
-
-  //mesh.halo.ExchangeStart(o_mu,1);
-  mesh.ringHalo.ExchangeStart(o_mu,1);
-
-  gradVolumeKernel(mesh.Nelements,
-                   mesh.o_cubvgeo,
-                   mesh.o_cubvgeoCurv,
-                   mesh.o_mapCurv,
-                   mesh.o_Dw,
-                   mesh.o_cubPDT,
-                   mesh.o_cubPDTs,
-                   mesh.o_cubInterp,
-                   o_Q,
-                   o_gradq);
-
-
-  fieldTraceHalo.ExchangeFinish(o_Q, 1);
-
-  gradSurfaceKernel(mesh.Nelements,
-                    mesh.o_cubsgeo,
-                    mesh.o_cubsgeoCurv,
-                    mesh.o_mapCurv,
-                    mesh.o_LIFT,
-                    mesh.o_vmapM,
-                    mesh.o_vmapP,
-                    mesh.o_EToB,
-                    mesh.o_x,
-                    mesh.o_y,
-                    mesh.o_z,
-                    mesh.o_intInterp,
-                    mesh.o_intLIFT,
-                    mesh.o_intLIFTs,
-                    mesh.o_intx,
-                    mesh.o_inty,
-                    mesh.o_intz,
-                    T,
-                    o_Q,
-                    o_gradq);
-
-
-  //mesh.halo.ExchangeFinish(o_mu,1);
-  mesh.ringHalo.ExchangeFinish(o_mu,1);
-  viscositySmoothKernel(mesh.Nelements,
-                  meshPatch.o_vmapP,
-                  mesh.o_muInterp,
-                  meshPatch.o_EToN,
-                  meshPatch.o_Vcounts,
-                  o_mu,
-                  o_gradq);
-
-  
-  gradTraceHalo.ExchangeStart(o_gradq, 1);
-  if (cubature) {
-        cubatureVolumeKernel(mesh.Nelements,
-                         mesh.o_cubvgeo,
-                         mesh.o_cubvgeoCurv,
-                         mesh.o_mapCurv,
-                         mesh.o_cubD,
-                         mesh.o_cubPDT,
-                         mesh.o_cubPDTs,
-                         mesh.o_cubInterp,
-                         mesh.o_cubProject,
-                         mesh.o_x,
-                         mesh.o_y,
-                         mesh.o_z,
-                         T,
-                         o_Q,
-                         o_gradq,
-                         o_RHS);
-  }
-  else {
-    volumeKernel(mesh.Nelements,
-               mesh.o_vgeo,
-               mesh.o_D,
-               T,
-               mesh.o_x,
-               mesh.o_y,
-               o_Q,
-               o_RHS);
-  }
-
-  gradTraceHalo.ExchangeFinish(o_gradq, 1);
-
-
-  if (cubature) {
-          cubatureSurfaceKernel(mesh.Nelements,
-                          mesh.o_cubsgeo,
-                          mesh.o_cubsgeoCurv,
-                          mesh.o_mapCurv,
-                          mesh.o_vmapM,
-                          mesh.o_vmapP,
-                          mesh.o_EToB,
-                          mesh.o_intInterp,
-                          mesh.o_intLIFT,
-                          mesh.o_intLIFTs,
-                          mesh.o_intx,
-                          mesh.o_inty,
-                          mesh.o_intz,
-                          T,
-                          o_Q,
-                          o_gradq,
-                          o_RHS);
-    }
-    else {
-          surfaceKernel(mesh.Nelements,
-                  mesh.o_sgeo,
-                  mesh.o_LIFT,
-                  mesh.o_vmapM,
-                  mesh.o_vmapP,
-                  mesh.o_EToB,
-                  T,
-                  mesh.o_x,
-                  mesh.o_y,
-                  mesh.o_z,
-                  o_Q,
-                  o_RHS);
-  }
-}
@@ -58,8 +58,12 @@ int main(int argc, char **argv){
     // set up acoustics solver
     acoustics_t acoustics(platform, mesh, acousticsSettings);
 
-    // run
-    acoustics.Run();
+    // run, unless only warming up the kernel cache
+    if (!platformSettings.compareSetting("WARM UP","TRUE"))
+      acoustics.Run();
+
+    //report the profile while every rank is still here, before teardown
+    Profiler::Finalize();
   }
 
   // close down MPI
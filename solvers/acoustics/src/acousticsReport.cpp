@@ -28,8 +28,6 @@ SOFTWARE.
 
 void acoustics_t::Report(dfloat time, int tstep){
 
-  static int frame=0;
-
   //compute q.M*q
   mesh.MassMatrixApply(o_q, o_Mq);
 
@@ -41,15 +39,9 @@ void acoustics_t::Report(dfloat time, int tstep){
 
   if (settings.compareSetting("OUTPUT TO FILE","TRUE")) {
 
-    // copy data back to host
-    o_q.copyTo(q);
-
     // output field files
     std::string name;
     settings.getSetting("OUTPUT FILE NAME", name);
-    char fname[BUFSIZ];
-    sprintf(fname, "%s_%04d_%04d.vtu", name.c_str(), mesh.rank, frame++);
-
-    PlotFields(q, std::string(fname));
+    PlotFields(o_q, name, outputFrame++, time);
   }
 }
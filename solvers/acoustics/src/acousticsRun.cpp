@@ -62,4 +62,7 @@ void acoustics_t::Run(){
     if(mesh.rank==0)
       printf("Solution norm = %17.15lg\n", norm2);
   }
+
+  //wait for queued output to reach disk
+  vtu.Flush();
 }
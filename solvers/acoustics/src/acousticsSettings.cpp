@@ -62,6 +62,8 @@ acousticsSettings_t::acousticsSettings_t(comm_t _comm):
 
   newSetting("OUTPUT FILE NAME",
              "acoustics");
+
+  TimeStepper::AddSettings(*this);
 }
 
 void acousticsSettings_t::report() {
@@ -75,6 +77,7 @@ void acousticsSettings_t::report() {
     reportSetting("OUTPUT INTERVAL");
     reportSetting("OUTPUT TO FILE");
     reportSetting("OUTPUT FILE NAME");
+    TimeStepper::ReportSettings(*this);
   }
 }
 
@@ -34,6 +34,9 @@ void acoustics_t::Setup(platform_t& _platform, mesh_t& _mesh,
   comm = _mesh.comm;
   settings = _settings;
 
+  //setup field output
+  vtu.Setup(mesh);
+
   Nfields = (mesh.dim==3) ? 4:3;
 
   dlong Nlocal = mesh.Nelements*mesh.Np*Nfields;
@@ -50,6 +50,7 @@ public:
 class advection_t: public solver_t {
 public:
   mesh_t mesh;
+  vtuWriter_t vtu;
   timeStepper_t timeStepper;
 
   ogs::halo_t traceHalo;
@@ -79,7 +80,8 @@ public:
 
   void Report(dfloat time, int tstep);
 
-  void PlotFields(memory<dfloat> Q, const std::string fileName);
+  void PlotFields(deviceMemory<dfloat>& o_Q, const std::string name,
+                  const int frame, const dfloat time);
 
   void rhsf(deviceMemory<dfloat>& o_q, deviceMemory<dfloat>& o_rhs, const dfloat time);
 
@@ -57,8 +57,12 @@ int main(int argc, char **argv){
     // set up advection solver
     advection_t advection(platform, mesh, advectionSettings);
 
-    // run
-    advection.Run();
+    // run, unless only warming up the kernel cache
+    if (!platformSettings.compareSetting("WARM UP","TRUE"))
+      advection.Run();
+
+    //report the profile while every rank is still here, before teardown
+    Profiler::Finalize();
   }
 
   // close down MPI
@@ -62,4 +62,6 @@ void advection_t::Run(){
       printf("Solution norm = %17.15lg\n", norm2);
   }
 
+  //wait for queued output to reach disk
+  vtu.Flush();
 }
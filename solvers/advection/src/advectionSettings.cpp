@@ -62,6 +62,8 @@ advectionSettings_t::advectionSettings_t(comm_t _comm):
 
   newSetting("OUTPUT FILE NAME",
              "advection");
+
+  TimeStepper::AddSettings(*this);
 }
 
 void advectionSettings_t::report() {
@@ -75,6 +77,7 @@ void advectionSettings_t::report() {
     reportSetting("OUTPUT INTERVAL");
     reportSetting("OUTPUT TO FILE");
     reportSetting("OUTPUT FILE NAME");
+    TimeStepper::ReportSettings(*this);
   }
 }
 
@@ -34,6 +34,9 @@ void advection_t::Setup(platform_t& _platform, mesh_t& _mesh,
   comm = mesh.comm;
   settings = _settings;
 
+  //setup field output
+  vtu.Setup(mesh);
+
   dlong Nlocal = mesh.Nelements*mesh.Np;
   dlong Nhalo  = mesh.totalHaloPairs*mesh.Np;
 
@@ -50,6 +50,7 @@ public:
 class bns_t: public solver_t {
 public:
   mesh_t mesh;
+  vtuWriter_t vtu;
 
   int Nfields;
   int Npmlfields;
@@ -111,7 +112,8 @@ public:
 
   void Report(dfloat time, int tstep);
 
-  void PlotFields(memory<dfloat>& Q, memory<dfloat>& V, std::string fileName);
+  void PlotFields(memory<dfloat>& Q, memory<dfloat>& V, const std::string name,
+                  const int frame, const dfloat time);
 
   dfloat MaxWaveSpeed();
 
@@ -58,8 +58,12 @@ int main(int argc, char **argv){
     // set up bns solver
     bns_t bns(platform, mesh, bnsSettings);
 
-    // run
-    bns.Run();
+    // run, unless only warming up the kernel cache
+    if (!platformSettings.compareSetting("WARM UP","TRUE"))
+      bns.Run();
+
+    //report the profile while every rank is still here, before teardown
+    Profiler::Finalize();
   }
 
   // close down MPI
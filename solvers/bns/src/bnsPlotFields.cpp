@@ -27,183 +27,35 @@ SOFTWARE.
 #include "bns.hpp"
 
 // interpolate data to plot nodes and save to file (one per process)
-void bns_t::PlotFields(memory<dfloat>& Q, memory<dfloat>& V, std::string fileName){
-
-  FILE *fp;
-
-  fp = fopen(fileName.c_str(), "w");
-
-  fprintf(fp, "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"BigEndian\">\n");
-  fprintf(fp, "  <UnstructuredGrid>\n");
-  fprintf(fp, "    <Piece NumberOfPoints=\"%d\" NumberOfCells=\"%d\">\n",
-          mesh.Nelements*mesh.plotNp,
-          mesh.Nelements*mesh.plotNelements);
-
-  // write out nodes
-  fprintf(fp, "      <Points>\n");
-  fprintf(fp, "        <DataArray type=\"Float32\" NumberOfComponents=\"3\" Format=\"ascii\">\n");
-
-  //scratch space for interpolation
-  size_t Nscratch = std::max(mesh.Np, mesh.plotNp);
-  memory<dfloat> scratch(2*Nscratch);
-
-  memory<dfloat> Ix(mesh.plotNp);
-  memory<dfloat> Iy(mesh.plotNp);
-  memory<dfloat> Iz(mesh.plotNp);
-
-  // compute plot node coordinates on the fly
-  for(dlong e=0;e<mesh.Nelements;++e){
-    mesh.PlotInterp(mesh.x + e*mesh.Np, Ix, scratch);
-    mesh.PlotInterp(mesh.y + e*mesh.Np, Iy, scratch);
-    if(mesh.dim==3)
-      mesh.PlotInterp(mesh.z + e*mesh.Np, Iz, scratch);
-
-    if (mesh.dim==2) {
-      for(int n=0;n<mesh.plotNp;++n){
-        fprintf(fp, "       ");
-        fprintf(fp, "%g %g %g\n", Ix[n],Iy[n],0.0);
-      }
-    } else {
-      for(int n=0;n<mesh.plotNp;++n){
-        fprintf(fp, "       ");
-        fprintf(fp, "%g %g %g\n", Ix[n],Iy[n],Iz[n]);
-      }
-    }
-  }
-  fprintf(fp, "        </DataArray>\n");
-  fprintf(fp, "      </Points>\n");
-
-  memory<dfloat> u(mesh.Np);
-  memory<dfloat> v(mesh.Np);
-  memory<dfloat> w(mesh.Np);
-
-  memory<dfloat> Ip(mesh.plotNp);
-  memory<dfloat> Iu(mesh.plotNp);
-  memory<dfloat> Iv(mesh.plotNp);
-  memory<dfloat> Iw(mesh.plotNp);
+void bns_t::PlotFields(memory<dfloat>& Q, memory<dfloat>& V, const std::string name,
+                       const int frame, const dfloat time){
 
   if (Q.length()!=0) {
-    // write out density
-    fprintf(fp, "      <PointData Scalars=\"scalars\">\n");
-    fprintf(fp, "        <DataArray type=\"Float32\" Name=\"Density\" Format=\"ascii\">\n");
-    for(dlong e=0;e<mesh.Nelements;++e){
-      mesh.PlotInterp(Q + e*mesh.Np*Nfields, Ip, scratch);
+    // compute velocity and pressure
+    memory<dfloat> U(mesh.Nelements*mesh.Np*mesh.dim);
+    memory<dfloat> P(mesh.Nelements*mesh.Np);
 
-      for(int n=0;n<mesh.plotNp;++n){
-        fprintf(fp, "       ");
-        fprintf(fp, "%g\n", Ip[n]);
-      }
-    }
-    fprintf(fp, "       </DataArray>\n");
-
-    // write out velocity
-    fprintf(fp, "        <DataArray type=\"Float32\" Name=\"Velocity\" NumberOfComponents=\"%d\" Format=\"ascii\">\n", mesh.dim);
+    #pragma omp parallel for
     for(dlong e=0;e<mesh.Nelements;++e){
       for(int n=0;n<mesh.Np;++n){
         const dfloat rm = Q[e*mesh.Np*Nfields+n];
-        u[n] = c*Q[e*mesh.Np*Nfields+n+mesh.Np*1]/rm;
-        v[n] = c*Q[e*mesh.Np*Nfields+n+mesh.Np*2]/rm;
-        if(mesh.dim==3)
-          w[n] = c*Q[e*mesh.Np*Nfields+n+mesh.Np*3]/rm;
-      }
-
-      mesh.PlotInterp(u, Iu, scratch);
-      mesh.PlotInterp(v, Iv, scratch);
-      if(mesh.dim==3)
-        mesh.PlotInterp(w, Iw, scratch);
-
-      for(int n=0;n<mesh.plotNp;++n){
-        fprintf(fp, "       ");
-        fprintf(fp, "       ");
-        if (mesh.dim==2)
-          fprintf(fp, "%g %g\n", Iu[n], Iv[n]);
-        else
-          fprintf(fp, "%g %g %g\n", Iu[n], Iv[n], Iw[n]);
+        for(int i=0;i<mesh.dim;++i)
+          U[e*mesh.Np*mesh.dim+n+mesh.Np*i] = c*Q[e*mesh.Np*Nfields+n+mesh.Np*(i+1)]/rm;
+        P[e*mesh.Np+n] = RT*rm;
       }
     }
-    fprintf(fp, "       </DataArray>\n");
-
-    // write out pressure
-    fprintf(fp, "        <DataArray type=\"Float32\" Name=\"Pressure\" Format=\"ascii\">\n");
-    for(dlong e=0;e<mesh.Nelements;++e){
-      mesh.PlotInterp(Q + e*mesh.Np*Nfields, Ip, scratch);
 
-      for(int n=0;n<mesh.plotNp;++n){
-        fprintf(fp, "       ");
-        fprintf(fp, "%g\n", RT*Ip[n]);
-      }
-    }
-    fprintf(fp, "       </DataArray>\n");
+    vtu.AddField("Density",  Q, Nfields, 0);
+    vtu.AddField("Velocity", U, mesh.dim, 0, mesh.dim);
+    vtu.AddField("Pressure", P);
   }
 
   if (V.length()!=0) {
-    // write out vorticity
-    if(mesh.dim==2){
-      fprintf(fp, "        <DataArray type=\"Float32\" Name=\"Vorticity\" Format=\"ascii\">\n");
-      for(dlong e=0;e<mesh.Nelements;++e){
-        mesh.PlotInterp(V + e*mesh.Np, Ip, scratch);
-
-        for(int n=0;n<mesh.plotNp;++n){
-          fprintf(fp, "       ");
-          fprintf(fp, "%g\n", Ip[n]);
-        }
-      }
-    } else {
-      fprintf(fp, "        <DataArray type=\"Float32\" Name=\"Vorticity\" NumberOfComponents=\"3\" Format=\"ascii\">\n");
-      for(dlong e=0;e<mesh.Nelements;++e){
-        mesh.PlotInterp(V + 0*mesh.Np + e*mesh.Np*3, Iu, scratch);
-        mesh.PlotInterp(V + 1*mesh.Np + e*mesh.Np*3, Iv, scratch);
-        mesh.PlotInterp(V + 2*mesh.Np + e*mesh.Np*3, Iw, scratch);
-
-        for(int n=0;n<mesh.plotNp;++n){
-          fprintf(fp, "       ");
-          fprintf(fp, "       ");
-          fprintf(fp, "%g %g %g\n", Iu[n], Iv[n], Iw[n]);
-        }
-      }
-    }
-    fprintf(fp, "       </DataArray>\n");
+    if(mesh.dim==2)
+      vtu.AddField("Vorticity", V);
+    else
+      vtu.AddField("Vorticity", V, 3, 0, 3);
   }
-  fprintf(fp, "     </PointData>\n");
 
-  fprintf(fp, "    <Cells>\n");
-  fprintf(fp, "      <DataArray type=\"Int32\" Name=\"connectivity\" Format=\"ascii\">\n");
-
-  for(dlong e=0;e<mesh.Nelements;++e){
-    for(int n=0;n<mesh.plotNelements;++n){
-      fprintf(fp, "       ");
-      for(int m=0;m<mesh.plotNverts;++m){
-        fprintf(fp, "%d ", e*mesh.plotNp + mesh.plotEToV[n*mesh.plotNverts+m]);
-      }
-      fprintf(fp, "\n");
-    }
-  }
-  fprintf(fp, "        </DataArray>\n");
-
-  fprintf(fp, "        <DataArray type=\"Int32\" Name=\"offsets\" Format=\"ascii\">\n");
-  dlong cnt = 0;
-  for(dlong e=0;e<mesh.Nelements;++e){
-    for(int n=0;n<mesh.plotNelements;++n){
-      cnt += mesh.plotNverts;
-      fprintf(fp, "       ");
-      fprintf(fp, "%d\n", cnt);
-    }
-  }
-  fprintf(fp, "       </DataArray>\n");
-
-  fprintf(fp, "       <DataArray type=\"Int32\" Name=\"types\" Format=\"ascii\">\n");
-  for(dlong e=0;e<mesh.Nelements;++e){
-    for(int n=0;n<mesh.plotNelements;++n){
-      if(mesh.dim==2)
-        fprintf(fp, "5\n");
-      else
-        fprintf(fp, "10\n");
-    }
-  }
-  fprintf(fp, "        </DataArray>\n");
-  fprintf(fp, "      </Cells>\n");
-  fprintf(fp, "    </Piece>\n");
-  fprintf(fp, "  </UnstructuredGrid>\n");
-  fprintf(fp, "</VTKFile>\n");
-  fclose(fp);
+  vtu.Write(name, frame, time);
 }
@@ -28,8 +28,6 @@ SOFTWARE.
 
 void bns_t::Report(dfloat time, int tstep){
 
-  static int frame=0;
-
   //compute vorticity
   vorticityKernel(mesh.Nelements, mesh.o_vgeo, mesh.o_D, o_q, c, o_Vort);
 
@@ -51,10 +49,7 @@ void bns_t::Report(dfloat time, int tstep){
     // output field files
     std::string name;
     settings.getSetting("OUTPUT FILE NAME", name);
-    char fname[BUFSIZ];
-    sprintf(fname, "%s_%04d_%04d.vtu", name.c_str(), mesh.rank, frame++);
-
-    PlotFields(q, Vort, std::string(fname));
+    PlotFields(q, Vort, name, outputFrame++, time);
   }
 
   /*
@@ -115,7 +110,7 @@ void bns_t::Report(dfloat time, int tstep){
           bnsIsoPlotVTU(bns, bns->isoNtris[0], bns->isoq, fname);
         }
       }
-      bns->frame++;
+      bns->outputFrame++;
     }
   }
   */
@@ -75,6 +75,9 @@ void bns_t::Run(){
     if(mesh.rank==0)
       printf("Solution norm = %17.15lg\n", norm2);
   }
+
+  //wait for queued output to reach disk
+  vtu.Flush();
 }
 
 
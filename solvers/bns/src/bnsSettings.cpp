@@ -91,6 +91,8 @@ bnsSettings_t::bnsSettings_t(comm_t& _comm):
 
   newSetting("OUTPUT FILE NAME",
              "bns");
+
+  TimeStepper::AddSettings(*this);
 }
 
 void bnsSettings_t::report() {
@@ -111,6 +113,7 @@ void bnsSettings_t::report() {
     reportSetting("OUTPUT INTERVAL");
     reportSetting("OUTPUT TO FILE");
     reportSetting("OUTPUT FILE NAME");
+    TimeStepper::ReportSettings(*this);
   }
 }
 
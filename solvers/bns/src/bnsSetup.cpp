@@ -34,6 +34,9 @@ void bns_t::Setup(platform_t& _platform, mesh_t& _mesh,
   comm = _mesh.comm;
   settings = _settings;
 
+  //setup field output
+  vtu.Setup(mesh);
+
   //get physical paramters
   settings.getSetting("SPEED OF SOUND", c);
   settings.getSetting("VISCOSITY", nu);
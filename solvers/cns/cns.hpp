@@ -50,6 +50,7 @@ public:
 class cns_t: public solver_t {
 public:
   mesh_t mesh;
+  vtuWriter_t vtu;
 
   int Nfields;
   int Ngrads;
@@ -105,7 +106,8 @@ public:
 
   void Report(dfloat time, int tstep) override;
 
-  void PlotFields(memory<dfloat> Q, memory<dfloat> V, std::string fileName);
+  void PlotFields(memory<dfloat> Q, memory<dfloat> V, const std::string name,
+                  const int frame, const dfloat time);
 
   void rhsf(deviceMemory<dfloat>& o_q, deviceMemory<dfloat>& o_rhs, const dfloat time);
 
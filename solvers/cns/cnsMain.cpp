@@ -58,8 +58,12 @@ int main(int argc, char **argv){
     // set up cns solver
     cns_t cns(platform, mesh, cnsSettings);
 
-    // run
-    cns.Run();
+    // run, unless only warming up the kernel cache
+    if (!platformSettings.compareSetting("WARM UP","TRUE"))
+      cns.Run();
+
+    //report the profile while every rank is still here, before teardown
+    Profiler::Finalize();
   }
 
   // close down MPI
@@ -28,8 +28,6 @@ SOFTWARE.
 
 void cns_t::Report(dfloat time, int tstep){
 
-  static int frame=0;
-
   //compute vorticity
   vorticityKernel(mesh.Nelements, mesh.o_vgeo, mesh.o_D, o_q, o_Vort);
 
@@ -51,9 +49,6 @@ void cns_t::Report(dfloat time, int tstep){
     // output field files
     std::string name;
     settings.getSetting("OUTPUT FILE NAME", name);
-    char fname[BUFSIZ];
-    sprintf(fname, "%s_%04d_%04d.vtu", name.c_str(), mesh.rank, frame++);
-
-    PlotFields(q, Vort, std::string(fname));
+    PlotFields(q, Vort, name, outputFrame++, time);
   }
 }
@@ -68,4 +68,6 @@ void cns_t::Run(){
       printf("Solution norm = %17.15lg\n", norm2);
   }
 
+  //wait for queued output to reach disk
+  vtu.Flush();
 }
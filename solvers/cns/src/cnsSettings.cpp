@@ -80,6 +80,8 @@ cnsSettings_t::cnsSettings_t(comm_t _comm):
 
   newSetting("OUTPUT FILE NAME",
              "cns");
+
+  TimeStepper::AddSettings(*this);
 }
 
 void cnsSettings_t::report() {
@@ -98,6 +100,7 @@ void cnsSettings_t::report() {
     reportSetting("OUTPUT INTERVAL");
     reportSetting("OUTPUT TO FILE");
     reportSetting("OUTPUT FILE NAME");
+    TimeStepper::ReportSettings(*this);
   }
 }
 
@@ -56,6 +56,7 @@ void ellipticAddSettings(settings_t& settings,
 class elliptic_t: public solver_t {
 public:
   mesh_t mesh;
+  vtuWriter_t vtu;
 
   dlong Ndofs, Nhalo;
   int Nfields;
@@ -103,9 +104,22 @@ public:
 
   kernel_t maskKernel;
   kernel_t partialAxKernel;
+
+  //partial Ax kernel variant and its elements per threadblock
+  std::string axKernelName;
+  int axNblockV=1;
+
+  //geometric factors passed to partialAxKernel. These are the mesh's
+  // dfloat factors, or float copies on single precision MG levels
+  deviceMemory<char> o_wJAx, o_ggeoAx;
   kernel_t partialGradientKernel;
   kernel_t partialIpdgKernel;
 
+  //block Ax for NblockRhs right-hand sides
+  int NblockRhs=0;
+  deviceMemory<dfloat> o_AqBlockL;
+  kernel_t partialBlockAxKernel;
+
   elliptic_t() = default;
   elliptic_t(platform_t &_platform, mesh_t &_mesh,
               settings_t& _settings, dfloat _lambda,
@@ -120,14 +134,32 @@ public:
 
   void BoundarySetup();
 
+  void SetupPrecon();
+
+  //change lambda after setup. An AMG preconditioner keeps its hierarchy
+  // and only has its values recomputed, others are rebuilt
+  void UpdateLambda(const dfloat _lambda);
+
+  void SetupBlockOperator(const int Nrhs);
+
+  void SetupSinglePrecisionOperator();
+
+  void TuneAxKernel(properties_t& kernelInfo);
+
   void Run();
 
   int Solve(linearSolver_t& linearSolver, deviceMemory<dfloat> &o_x, deviceMemory<dfloat> &o_r,
             const dfloat tol, const int MAXIT, const int verbose);
 
-  void PlotFields(memory<dfloat>& Q, std::string fileName);
+  int BlockSolve(linearSolver_t& linearSolver, deviceMemory<dfloat> &o_x, deviceMemory<dfloat> &o_r,
+                 const int Nrhs, memory<int> Niters,
+                 const dfloat tol, const int MAXIT, const int verbose);
+
+  void PlotFields(memory<dfloat>& Q, const std::string name);
 
   void Operator(deviceMemory<dfloat>& o_q, deviceMemory<dfloat>& o_Aq);
+  void BlockOperator(deviceMemory<dfloat>& o_q, deviceMemory<dfloat>& o_Aq,
+                     const int Nrhs, const dlong offset);
 
   void BuildOperatorMatrixIpdg(parAlmond::parCOO& A);
   void BuildOperatorMatrixContinuous(parAlmond::parCOO& A);
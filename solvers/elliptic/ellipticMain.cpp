@@ -70,8 +70,18 @@ int main(int argc, char **argv){
     elliptic_t elliptic(platform, mesh, ellipticSettings,
                         lambda, NBCTypes, BCType);
 
-    // run
+    // optionally change lambda after setup, e.g. to exercise the AMG numeric update
+    if (!ellipticSettings.compareSetting("LAMBDA UPDATE", "NONE")) {
+      dfloat newLambda = 0.0;
+      ellipticSettings.getSetting("LAMBDA UPDATE", newLambda);
+      elliptic.UpdateLambda(newLambda);
+    }
+
+    // run (a warm up run builds the solver kernels and stops early)
     elliptic.Run();
+
+    //report the profile while every rank is still here, before teardown
+    Profiler::Finalize();
   }
 
   // close down MPI
@@ -37,10 +37,14 @@ private:
 
   deviceMemory<dfloat> o_invDiagA;
 
+  kernel_t blockJacobiDiagonalKernel;
+
 public:
   JacobiPrecon() = default;
   JacobiPrecon(elliptic_t& elliptic);
   void Operator(deviceMemory<dfloat>& o_r, deviceMemory<dfloat>& o_Mr);
+  void BlockOperator(deviceMemory<dfloat>& o_r, deviceMemory<dfloat>& o_Mr,
+                     const int Nrhs, const dlong offset);
 };
 
 //Inverse Mass Matrix preconditioner
@@ -77,6 +81,9 @@ public:
   ParAlmondPrecon() = default;
   ParAlmondPrecon(elliptic_t& elliptic);
   void Operator(deviceMemory<dfloat>& o_r, deviceMemory<dfloat>& o_Mr);
+
+  //numeric-only AMG re-setup for a new lambda
+  void Update(const dfloat lambda);
 };
 
 // Matrix-free p-Multigrid levels followed by AMG
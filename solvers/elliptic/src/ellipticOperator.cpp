@@ -28,6 +28,8 @@
 
 void elliptic_t::Operator(deviceMemory<dfloat> &o_q, deviceMemory<dfloat> &o_Aq){
 
+  Profiler::Start("elliptic Operator");
+
   if(disc_c0){
     // int mapType = (mesh.elementType==Mesh::HEXAHEDRA &&
     //                mesh.settings.compareSetting("ELEMENT MAP", "TRILINEAR")) ? 1:0;
@@ -43,7 +45,7 @@ void elliptic_t::Operator(deviceMemory<dfloat> &o_q, deviceMemory<dfloat> &o_Aq)
           partialAxKernel(mesh.NlocalGatherElements/2,
                           mesh.o_localGatherElementList,
                           o_GlobalToLocal,
-                          mesh.o_wJ, mesh.o_ggeo,
+                          o_wJAx, o_ggeoAx,
                           mesh.o_D, mesh.o_S,
                           mesh.o_MM, lambda, o_q, o_AqL);
         /* NC: disabling until we re-add treatment of affine elements
@@ -73,7 +75,7 @@ void elliptic_t::Operator(deviceMemory<dfloat> &o_q, deviceMemory<dfloat> &o_Aq)
           partialAxKernel(mesh.NglobalGatherElements,
                           mesh.o_globalGatherElementList,
                           o_GlobalToLocal,
-                          mesh.o_wJ, mesh.o_ggeo,
+                          o_wJAx, o_ggeoAx,
                           mesh.o_D, mesh.o_S,
                           mesh.o_MM, lambda, o_q, o_AqL);
         /* NC: disabling until we re-add treatment of affine elements
@@ -98,7 +100,7 @@ void elliptic_t::Operator(deviceMemory<dfloat> &o_q, deviceMemory<dfloat> &o_Aq)
       partialAxKernel((mesh.NlocalGatherElements+1)/2,
                       mesh.o_localGatherElementList+(mesh.NlocalGatherElements/2),
                       o_GlobalToLocal,
-                      mesh.o_wJ, mesh.o_ggeo,
+                      o_wJAx, o_ggeoAx,
                       mesh.o_D, mesh.o_S,
                       mesh.o_MM, lambda, o_q, o_AqL);
     }
@@ -155,5 +157,57 @@ void elliptic_t::Operator(deviceMemory<dfloat> &o_q, deviceMemory<dfloat> &o_Aq)
                         o_Aq);
     }
   }
+
+  //approximate traffic: read q, write Aq, read the local-to-global map and
+  // geometric factors. Derivatives are sum factored on quads and hexes
+  const double Nnodes = static_cast<double>(mesh.Nelements)*mesh.Np;
+  const bool tensor = (mesh.elementType==Mesh::QUADRILATERALS
+                    || mesh.elementType==Mesh::HEXAHEDRA);
+  const double bytes = Nnodes*(2*sizeof(dfloat) + sizeof(dlong) + mesh.Nggeo*sizeof(dfloat));
+  const double flops = Nnodes*(4.0*mesh.dim*(tensor ? mesh.Nq : mesh.Np)
+                             + 2.0*mesh.dim*mesh.dim + 2.0*mesh.dim);
+  Profiler::Stop("elliptic Operator", bytes, flops);
 }
 
+void elliptic_t::BlockOperator(deviceMemory<dfloat> &o_q, deviceMemory<dfloat> &o_Aq,
+                               const int Nrhs, const dlong offset){
+
+  // no block kernel for this discretization, apply Ax to each rhs in turn
+  if (Nrhs!=NblockRhs) {
+    operator_t::BlockOperator(o_q, o_Aq, Nrhs, offset);
+    return;
+  }
+
+  const dlong offsetL = mesh.Np*mesh.Nelements;
+
+  // the halo exchanges share one buffer, so go one rhs at a time
+  for (int n=0;n<Nrhs;++n) {
+    gHalo.Exchange(o_q + n*offset, 1);
+  }
+
+  if(mesh.NlocalGatherElements){
+    partialBlockAxKernel(mesh.NlocalGatherElements,
+                         offset, offsetL,
+                         mesh.o_localGatherElementList,
+                         o_GlobalToLocal,
+                         mesh.o_wJ, mesh.o_ggeo,
+                         mesh.o_D, mesh.o_S,
+                         mesh.o_MM, lambda, o_q, o_AqBlockL);
+  }
+
+  if(mesh.NglobalGatherElements) {
+    partialBlockAxKernel(mesh.NglobalGatherElements,
+                         offset, offsetL,
+                         mesh.o_globalGatherElementList,
+                         o_GlobalToLocal,
+                         mesh.o_wJ, mesh.o_ggeo,
+                         mesh.o_D, mesh.o_S,
+                         mesh.o_MM, lambda, o_q, o_AqBlockL);
+  }
+
+  //gather each result to Aq
+  for (int n=0;n<Nrhs;++n) {
+    ogsMasked.Gather(o_Aq + n*offset, o_AqBlockL + n*offsetL,
+                     1, ogs::Add, ogs::Trans);
+  }
+}
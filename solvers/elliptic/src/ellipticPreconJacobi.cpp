@@ -37,6 +37,10 @@ JacobiPrecon::JacobiPrecon(elliptic_t& _elliptic):
     invDiagA[n] = 1.0/diagA[n];
 
   o_invDiagA = elliptic.platform.malloc<dfloat>(invDiagA);
+
+  properties_t kernelInfo = elliptic.mesh.props; //copy base occa properties
+  blockJacobiDiagonalKernel = elliptic.platform.buildKernel(DELLIPTIC "/okl/ellipticPreconJacobi.okl",
+                                                            "blockJacobiDiagonal", kernelInfo);
 }
 
 void JacobiPrecon::Operator(deviceMemory<dfloat>& o_r, deviceMemory<dfloat>& o_Mr) {
@@ -49,3 +53,20 @@ void JacobiPrecon::Operator(deviceMemory<dfloat>& o_r, deviceMemory<dfloat>& o_M
   // zero mean of RHS
   if(elliptic.allNeumann) elliptic.ZeroMean(o_Mr);
 }
+
+void JacobiPrecon::BlockOperator(deviceMemory<dfloat>& o_r, deviceMemory<dfloat>& o_Mr,
+                                 const int Nrhs, const dlong offset) {
+
+  // Mr = invDiag.*r for all rhs in one pass
+  if (elliptic.Ndofs)
+    blockJacobiDiagonalKernel(elliptic.Ndofs, Nrhs, offset,
+                              o_invDiagA, o_r, o_Mr);
+
+  // zero mean of RHS
+  if(elliptic.allNeumann) {
+    for (int n=0;n<Nrhs;++n) {
+      deviceMemory<dfloat> o_Mrn = o_Mr + n*offset;
+      elliptic.ZeroMean(o_Mrn);
+    }
+  }
+}
@@ -231,6 +231,10 @@ MGLevel::MGLevel(elliptic_t& _elliptic,
   elliptic(_elliptic),
   mesh(_elliptic.mesh) {
 
+  //apply this level's operator with float geometric factors
+  if (settings.compareSetting("PRECONDITIONER PRECISION", "SINGLE"))
+    elliptic.SetupSinglePrecisionOperator();
+
   SetupSmoother();
   AllocateStorage();
 
@@ -72,3 +72,18 @@ ParAlmondPrecon::ParAlmondPrecon(elliptic_t& _elliptic):
   dlong parAlmondNhalo = parAlmondNcols - parAlmondNrows;
   _elliptic.Nhalo = std::max(_elliptic.Nhalo, parAlmondNhalo);
 }
+
+void ParAlmondPrecon::Update(const dfloat lambda) {
+
+  elliptic.lambda = lambda;
+
+  //the operator matrix keeps its sparsity pattern and entry ordering
+  parAlmond::parCOO A(elliptic.platform, elliptic.mesh.comm);
+  if (settings.compareSetting("DISCRETIZATION", "IPDG")) {
+    elliptic.BuildOperatorMatrixIpdg(A);
+  } else if (settings.compareSetting("DISCRETIZATION", "CONTINUOUS")) {
+    elliptic.BuildOperatorMatrixContinuous(A);
+  }
+
+  parAlmond.AMGUpdate(A);
+}
@@ -37,11 +37,21 @@ void elliptic_t::Run(){
     NglobalDofs = mesh.NelementsGlobal*mesh.Np*Nfields;
   }
 
+  //number of right-hand sides solved together
+  int Nrhs = 1;
+  settings.getSetting("NUMBER OF RHS", Nrhs);
+  LIBP_ABORT("NUMBER OF RHS > 1 requires LINEAR SOLVER BPCG",
+             Nrhs>1 && !settings.compareSetting("LINEAR SOLVER","BPCG"));
+
   linearSolver_t linearSolver;
   if (settings.compareSetting("LINEAR SOLVER","NBPCG")){
     linearSolver.Setup<LinearSolver::nbpcg>(Ndofs, Nhalo, platform, settings, comm);
   } else if (settings.compareSetting("LINEAR SOLVER","NBFPCG")){
     linearSolver.Setup<LinearSolver::nbfpcg>(Ndofs, Nhalo, platform, settings, comm);
+  } else if (settings.compareSetting("LINEAR SOLVER","PIPECG")){
+    linearSolver.Setup<LinearSolver::pipecg>(Ndofs, Nhalo, platform, settings, comm);
+  } else if (settings.compareSetting("LINEAR SOLVER","BPCG")){
+    linearSolver.Setup<LinearSolver::bpcg>(Ndofs, Nhalo, platform, settings, comm, Nrhs);
   } else if (settings.compareSetting("LINEAR SOLVER","PCG")){
     linearSolver.Setup<LinearSolver::pcg>(Ndofs, Nhalo, platform, settings, comm);
   } else if (settings.compareSetting("LINEAR SOLVER","PGMRES")){
@@ -184,31 +194,56 @@ void elliptic_t::Run(){
     ogsMasked.Gather(o_x, o_xL, 1, ogs::Add, ogs::NoTrans);
   }
 
+  //the n-th system of a block has n times the rhs, and so n times the
+  // solution. The first system is zero, which converges immediately
+  const dlong Ntotal = Ndofs + Nhalo;
+  deviceMemory<dfloat> o_rBlock, o_xBlock;
+  memory<int> Niters(Nrhs);
+  if (Nrhs>1) {
+    SetupBlockOperator(Nrhs);
+
+    o_rBlock = platform.malloc<dfloat>(Nrhs*Ntotal);
+    o_xBlock = platform.malloc<dfloat>(Nrhs*Ntotal);
+    for (int n=0;n<Nrhs;++n) {
+      o_rBlock.copyFrom(o_r, Ntotal, n*Ntotal);
+      o_xBlock.copyFrom(o_x, Ntotal, n*Ntotal);
+      platform.linAlg().scale(Ntotal, static_cast<dfloat>(n), o_rBlock + n*Ntotal);
+    }
+  }
+
   int maxIter = 5000;
   int verbose = settings.compareSetting("VERBOSE", "TRUE") ? 1 : 0;
 
-  timePoint_t start = GlobalPlatformTime(platform);
-
-  //call the solver
   dfloat tol = (sizeof(dfloat)==sizeof(double)) ? 1.0e-8 : 1.0e-5;
-  int iter = Solve(linearSolver, o_x, o_r, tol, maxIter, verbose);
 
-  //add the boundary data to the masked nodes
-  if(settings.compareSetting("DISCRETIZATION","CONTINUOUS")){
-    // scatter x to LocalDofs if c0
-    ogsMasked.Scatter(o_xL, o_x, 1, ogs::NoTrans);
-    //fill masked nodes with BC data
-    addBCKernel(mesh.Nelements,
-                mesh.o_x,
-                mesh.o_y,
-                mesh.o_z,
-                o_mapB,
-                o_xL);
+  //a warm up run stops after one iteration, which is enough to build every
+  // kernel of the linear solver, operator, and preconditioner
+  if (platform.settings().compareSetting("WARM UP","TRUE")) {
+    if (Nrhs==1)
+      Solve(linearSolver, o_x, o_r, tol, 1, 0);
+    else
+      BlockSolve(linearSolver, o_xBlock, o_rBlock, Nrhs, Niters, tol, 1, 0);
+    platform.finish();
+    return;
   }
 
+  timePoint_t start = GlobalPlatformTime(platform);
+
+  //call the solver
+  int iter;
+  if (Nrhs==1)
+    iter = Solve(linearSolver, o_x, o_r, tol, maxIter, verbose);
+  else
+    iter = BlockSolve(linearSolver, o_xBlock, o_rBlock, Nrhs, Niters, tol, maxIter, verbose);
+
   timePoint_t end = GlobalPlatformTime(platform);
   double elapsedTime = ElapsedTime(start, end);
 
+  if ((mesh.rank==0) && verbose && Nrhs>1){
+    for (int n=0;n<Nrhs;++n)
+      printf("rhs %d: %d iterations\n", n, Niters[n]);
+  }
+
   if ((mesh.rank==0) && verbose){
     printf("%d, " hlongFormat ", %g, %d, %g, %g; global: N, dofs, elapsed, iterations, time per node, nodes*iterations/time %s\n",
            mesh.N,
@@ -220,22 +255,28 @@ void elliptic_t::Run(){
            (char*) settings.getSetting("PRECONDITIONER").c_str());
   }
 
-  if (settings.compareSetting("OUTPUT TO FILE","TRUE")) {
+  // output norm of each final solution, scaled back to the single rhs one.
+  // The zero system is left unscaled, so its norm should be zero
+  for (int n=0;n<Nrhs;++n) {
+    if (Nrhs>1) {
+      //o_x is o_xL for IPDG
+      o_x.copyFrom(o_xBlock + n*Ntotal, Ntotal);
+      if (n>0) platform.linAlg().scale(Ntotal, 1.0/n, o_x);
+    }
+
+    if(settings.compareSetting("DISCRETIZATION","CONTINUOUS")){
+      // scatter x to LocalDofs if c0
+      ogsMasked.Scatter(o_xL, o_x, 1, ogs::NoTrans);
+      //fill masked nodes with BC data, which is zero for the zero system
+      if (Nrhs==1 || n>0)
+        addBCKernel(mesh.Nelements,
+                    mesh.o_x,
+                    mesh.o_y,
+                    mesh.o_z,
+                    o_mapB,
+                    o_xL);
+    }
 
-    // copy data back to host
-    o_xL.copyTo(xL);
-
-    // output field files
-    std::string name;
-    settings.getSetting("OUTPUT FILE NAME", name);
-    char fname[BUFSIZ];
-    sprintf(fname, "%s_%04d.vtu", name.c_str(), mesh.rank);
-
-    PlotFields(xL, fname);
-  }
-
-  // output norm of final solution
-  {
     //compute q.M*q
     mesh.MassMatrixApply(o_xL, o_MxL);
 
@@ -245,4 +286,18 @@ void elliptic_t::Run(){
     if(mesh.rank==0)
       printf("Solution norm = %17.15lg\n", norm2);
   }
+
+  if (settings.compareSetting("OUTPUT TO FILE","TRUE")) {
+
+    // copy data back to host
+    o_xL.copyTo(xL);
+
+    // output field files
+    std::string name;
+    settings.getSetting("OUTPUT FILE NAME", name);
+    PlotFields(xL, name);
+  }
+
+  //wait for queued output to reach disk
+  vtu.Flush();
 }
@@ -45,6 +45,14 @@ void ellipticAddRunSettings(settings_t& settings) {
                       "1.0",
                       "Coefficient in Screened Poisson Equation");
 
+  settings.newSetting("LAMBDA UPDATE",
+                      "NONE",
+                      "Coefficient to update lambda to after setup, before solving (NONE disables)");
+
+  settings.newSetting("NUMBER OF RHS",
+                      "1",
+                      "Number of right-hand sides solved as one block with BPCG. The n-th is the forcing scaled by n");
+
   settings.newSetting("OUTPUT TO FILE",
                       "FALSE",
                       "Flag for writing fields to VTU files",
@@ -64,18 +72,30 @@ void ellipticAddSettings(settings_t& settings,
   settings.newSetting(prefix+"LINEAR SOLVER",
                       "PCG",
                       "Iterative Linear Solver to use for solve",
-                      {"PCG", "FPCG", "NBPCG", "NBFPCG", "PGMRES", "PMINRES"});
+                      {"PCG", "FPCG", "NBPCG", "NBFPCG", "PIPECG", "BPCG", "PGMRES", "PMINRES"});
 
   settings.newSetting(prefix+"LINEAR SOLVER STOPPING CRITERION",
                       "ABS/REL-INITRESID",
                       "Stopping criterion for the linear solver",
                       {"ABS/REL-INITRESID", "ABS/REL-RHS-2NORM"});
 
+  settings.newSetting(prefix+"AX KERNEL TUNING",
+                      "FALSE",
+                      "Benchmark the Ax kernel variants at setup and cache the fastest",
+                      {"TRUE", "FALSE"});
+
   settings.newSetting(prefix+"PRECONDITIONER",
                       "NONE",
                       "Preconditioning Strategy",
                       {"NONE", "JACOBI", "MASSMATRIX", "PARALMOND", "MULTIGRID", "SEMFEM", "OAS"});
 
+  settings.newSetting(prefix+"PRECONDITIONER PRECISION",
+                      "DOUBLE",
+                      "Storage precision of the multigrid level operators. SINGLE stores only "
+                      "AMG matrix values and p-multigrid geometric factors in float, to halve "
+                      "their memory traffic. Smoothing vectors and all arithmetic stay in double",
+                      {"DOUBLE", "SINGLE"});
+
   /* MULTIGRID options */
   settings.newSetting(prefix+"MULTIGRID COARSENING",
                       "HALFDOFS",
@@ -104,8 +124,13 @@ void ellipticSettings_t::report() {
     reportSetting("DATA FILE");
 
     reportSetting("LAMBDA");
+    if (!compareSetting("LAMBDA UPDATE","NONE"))
+      reportSetting("LAMBDA UPDATE");
     reportSetting("DISCRETIZATION");
     reportSetting("LINEAR SOLVER");
+    if (compareSetting("LINEAR SOLVER","BPCG"))
+      reportSetting("NUMBER OF RHS");
+    reportSetting("AX KERNEL TUNING");
     reportSetting("PRECONDITIONER");
 
     if (compareSetting("PRECONDITIONER","MULTIGRID")) {
@@ -116,8 +141,10 @@ void ellipticSettings_t::report() {
     }
 
     if (compareSetting("PRECONDITIONER","MULTIGRID")
-      ||compareSetting("PRECONDITIONER","PARALMOND"))
+      ||compareSetting("PRECONDITIONER","PARALMOND")) {
+      reportSetting("PRECONDITIONER PRECISION");
       parAlmond::ReportSettings(*this);
+    }
 
     reportSetting("OUTPUT TO FILE");
     reportSetting("OUTPUT FILE NAME");
@@ -35,6 +35,10 @@ void elliptic_t::Setup(platform_t& _platform, mesh_t& _mesh,
   mesh = _mesh;
   comm = _mesh.comm;
   settings = _settings;
+
+  //setup field output
+  vtu.Setup(mesh);
+
   lambda = _lambda;
 
   Nfields = 1;
@@ -136,8 +140,19 @@ void elliptic_t::Setup(platform_t& _platform, mesh_t& _mesh,
       kernelName = "ellipticPartialAx" + suffix;
     }
 
-    partialAxKernel = platform.buildKernel(fileName, kernelName,
-                                           kernelInfo);
+    axKernelName = kernelName;
+    axNblockV = NblockV;
+    if (settings.compareSetting("AX KERNEL TUNING", "TRUE"))
+      TuneAxKernel(kernelInfo);
+
+    properties_t axKernelInfo = kernelInfo;
+    axKernelInfo["defines/" "p_NblockV"]= axNblockV;
+
+    partialAxKernel = platform.buildKernel(fileName, axKernelName,
+                                           axKernelInfo);
+
+    o_wJAx   = mesh.o_wJ;
+    o_ggeoAx = mesh.o_ggeo;
 
   } else if (settings.compareSetting("DISCRETIZATION","IPDG")) {
     int Nmax = std::max(mesh.Np, mesh.Nfaces*mesh.Nfp);
@@ -163,6 +178,10 @@ void elliptic_t::Setup(platform_t& _platform, mesh_t& _mesh,
     Nhalo = mesh.totalHaloPairs*mesh.Np*Nfields;
   }
 
+  SetupPrecon();
+}
+
+void elliptic_t::SetupPrecon(){
   if       (settings.compareSetting("PRECONDITIONER", "JACOBI"))
     precon.Setup<JacobiPrecon>(*this);
   else if(settings.compareSetting("PRECONDITIONER", "MASSMATRIX"))
@@ -178,3 +197,106 @@ void elliptic_t::Setup(platform_t& _platform, mesh_t& _mesh,
   else if(settings.compareSetting("PRECONDITIONER", "NONE"))
     precon.Setup<IdentityPrecon>(Ndofs);
 }
+
+void elliptic_t::UpdateLambda(const dfloat _lambda){
+
+  //the null space handling is fixed at setup
+  LIBP_ABORT("Elliptic lambda cannot be changed to or from zero after setup",
+             (lambda==0.0) != (_lambda==0.0));
+
+  lambda = _lambda;
+
+  if (settings.compareSetting("PRECONDITIONER", "PARALMOND")) {
+    //keep the AMG hierarchy and only recompute its values
+    precon.Get<ParAlmondPrecon>().Update(lambda);
+  } else {
+    SetupPrecon();
+  }
+}
+
+// Build the block Ax kernel for Nrhs right-hand sides. Only the continuous
+// discretization of Tri2D, Quad2D, Tet3D, and (non-trilinear) Hex3D meshes
+// has one, other cases fall back to applying Ax to each rhs in turn.
+void elliptic_t::SetupBlockOperator(const int Nrhs){
+
+  NblockRhs = 0;
+
+  if (!disc_c0) return;
+  if (mesh.elementType==Mesh::HEXAHEDRA &&
+      mesh.settings.compareSetting("ELEMENT MAP", "TRILINEAR")) return;
+
+  std::string suffix;
+  if(mesh.elementType==Mesh::TRIANGLES && mesh.dim==2)
+    suffix = "Tri2D";
+  else if(mesh.elementType==Mesh::QUADRILATERALS && mesh.dim==2)
+    suffix = "Quad2D";
+  else if(mesh.elementType==Mesh::TETRAHEDRA)
+    suffix = "Tet3D";
+  else if(mesh.elementType==Mesh::HEXAHEDRA)
+    suffix = "Hex3D";
+  else
+    return;
+
+  properties_t kernelInfo = mesh.props; //copy base occa properties
+
+  int blockMax = 256;
+  if (platform.device.mode() == "CUDA") blockMax = 512;
+
+  int NblockV = std::max(1,blockMax/mesh.Np);
+  kernelInfo["defines/" "p_NblockV"]= NblockV;
+  kernelInfo["defines/" "p_Nrhs"]= Nrhs;
+
+  partialBlockAxKernel = platform.buildKernel(DELLIPTIC "/okl/ellipticBlockAx" + suffix + ".okl",
+                                              "ellipticPartialBlockAx" + suffix,
+                                              kernelInfo);
+
+  //buffer for local block Ax
+  o_AqBlockL = platform.malloc<dfloat>(Nrhs*mesh.Np*mesh.Nelements);
+
+  NblockRhs = Nrhs;
+}
+
+// Store the Ax geometric factors in float for a multigrid level. Only the
+// factor loads are reduced, the Ax kernel still reads and writes dfloat
+// vectors and computes in dfloat.
+void elliptic_t::SetupSinglePrecisionOperator(){
+
+  //the trilinear hex and IPDG operators keep their dfloat factors
+  if (!disc_c0) return;
+  if (mesh.elementType==Mesh::HEXAHEDRA &&
+      mesh.settings.compareSetting("ELEMENT MAP", "TRILINEAR")) return;
+
+  std::string suffix;
+  if(mesh.elementType==Mesh::TRIANGLES){
+    if(mesh.dim==2)
+      suffix = "Tri2D";
+    else
+      suffix = "Tri3D";
+  } else if(mesh.elementType==Mesh::QUADRILATERALS){
+    if(mesh.dim==2)
+      suffix = "Quad2D";
+    else
+      suffix = "Quad3D";
+  } else if(mesh.elementType==Mesh::TETRAHEDRA)
+    suffix = "Tet3D";
+  else if(mesh.elementType==Mesh::HEXAHEDRA)
+    suffix = "Hex3D";
+
+  //float copies of the geometric factors
+  memory<float> wJf(mesh.wJ.length());
+  memory<float> ggeof(mesh.ggeo.length());
+  for (size_t n=0;n<wJf.length();++n)   wJf[n]   = static_cast<float>(mesh.wJ[n]);
+  for (size_t n=0;n<ggeof.length();++n) ggeof[n] = static_cast<float>(mesh.ggeo[n]);
+
+  o_wJAx   = platform.malloc<float>(wJf);
+  o_ggeoAx = platform.malloc<float>(ggeof);
+
+  properties_t kernelInfo = mesh.props; //copy base occa properties
+
+  kernelInfo["defines/" "p_NblockV"]= axNblockV;
+  kernelInfo["defines/" "gfloat"]= "float";
+
+  partialAxKernel = platform.buildKernel(DELLIPTIC "/okl/ellipticAx" + suffix + ".okl",
+                                         axKernelName,
+                                         kernelInfo);
+}
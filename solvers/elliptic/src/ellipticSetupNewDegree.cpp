@@ -110,8 +110,19 @@ elliptic_t elliptic_t::SetupNewDegree(mesh_t& meshC){
       kernelName = "ellipticPartialAx" + suffix;
     }
 
-    elliptic.partialAxKernel = platform.buildKernel(fileName, kernelName,
-                                            kernelInfo);
+    elliptic.axKernelName = kernelName;
+    elliptic.axNblockV = NblockV;
+    if (settings.compareSetting("AX KERNEL TUNING", "TRUE"))
+      elliptic.TuneAxKernel(kernelInfo);
+
+    properties_t axKernelInfo = kernelInfo;
+    axKernelInfo["defines/" "p_NblockV"]= elliptic.axNblockV;
+
+    elliptic.partialAxKernel = platform.buildKernel(fileName, elliptic.axKernelName,
+                                                    axKernelInfo);
+
+    elliptic.o_wJAx   = meshC.o_wJ;
+    elliptic.o_ggeoAx = meshC.o_ggeo;
 
   } else if (settings.compareSetting("DISCRETIZATION","IPDG")) {
     int Nmax = std::max(meshC.Np, meshC.Nfaces*meshC.Nfp);
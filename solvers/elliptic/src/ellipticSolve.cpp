@@ -33,7 +33,30 @@ int elliptic_t::Solve(linearSolver_t& linearSolver,
   // if there is a nullspace, remove the constant vector from r
   if(allNeumann) ZeroMean(o_r);
 
+  Profiler::Start("elliptic Solve");
   int Niter = linearSolver.Solve(*this, precon, o_x, o_r, tol, MAXIT, verbose);
+  Profiler::Stop("elliptic Solve");
+
+  return Niter;
+}
+
+int elliptic_t::BlockSolve(linearSolver_t& linearSolver,
+                           deviceMemory<dfloat> &o_x, deviceMemory<dfloat> &o_r,
+                           const int Nrhs, memory<int> Niters,
+                           const dfloat tol, const int MAXIT, const int verbose){
+
+  // if there is a nullspace, remove the constant vector from each r
+  if(allNeumann) {
+    for (int n=0;n<Nrhs;++n) {
+      deviceMemory<dfloat> o_rn = o_r + n*(Ndofs+Nhalo);
+      ZeroMean(o_rn);
+    }
+  }
+
+  Profiler::Start("elliptic BlockSolve");
+  int Niter = linearSolver.BlockSolve(*this, precon, o_x, o_r, Nrhs, Niters,
+                                      tol, MAXIT, verbose);
+  Profiler::Stop("elliptic BlockSolve");
 
   return Niter;
 }
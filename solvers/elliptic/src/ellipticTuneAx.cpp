@@ -0,0 +1,165 @@
+/*
+
+The MIT License (MIT)
+
+Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+#include "elliptic.hpp"
+#include "timer.hpp"
+
+namespace {
+
+struct axVariant_t {
+  std::string kernelName;
+  int NblockV;
+};
+
+} //namespace
+
+// Pick the fastest partial Ax kernel variant for this element type, degree,
+// and device. The choice is kept in the platform's kernel registry, and the
+// candidates are only timed when the registry has no entry for them.
+void elliptic_t::TuneAxKernel(properties_t& kernelInfo){
+
+  if (!disc_c0) return;
+
+  std::string suffix;
+  if (mesh.elementType==Mesh::QUADRILATERALS && mesh.dim==2)
+    suffix = "Quad2D";
+  else if (mesh.elementType==Mesh::HEXAHEDRA &&
+          !mesh.settings.compareSetting("ELEMENT MAP", "TRILINEAR"))
+    suffix = "Hex3D";
+  else
+    return;
+
+  const std::string fileName = DELLIPTIC "/okl/ellipticAx" + suffix + ".okl";
+  const std::string baseName = "ellipticPartialAx" + suffix;
+
+  //build the list of candidate variants
+  constexpr int maxThreads = 1024;
+  std::vector<axVariant_t> variants;
+  variants.push_back({baseName, 1});
+  if (mesh.elementType==Mesh::HEXAHEDRA) {
+    if (mesh.Nq*mesh.Nq*mesh.Nq <= maxThreads)
+      variants.push_back({baseName + "_shared3D", 1});
+    for (int nb=2; nb<=8; nb*=2) {
+      if (nb*mesh.Nq*mesh.Nq <= maxThreads)
+        variants.push_back({baseName + "_blocked", nb});
+    }
+  } else {
+    for (int nb=2; nb<=32; nb*=2) {
+      if (nb*mesh.Nq*mesh.Nq <= maxThreads)
+        variants.push_back({baseName + "_blocked", nb});
+    }
+  }
+  const int Nvariants = static_cast<int>(variants.size());
+
+  //look for an earlier result in the kernel registry
+  kernelRegistry_t& registry = platform.kernelRegistry();
+  const std::string key = registry.Key(fileName, baseName, kernelInfo);
+
+  int best = -1;
+  kernelRegistry_t::entry_t entry;
+  if (registry.Find(key, entry)) {
+    for (int v=0;v<Nvariants;++v) {
+      const std::string config = variants[v].kernelName
+                               + " p_NblockV=" + std::to_string(variants[v].NblockV);
+      if (config==entry.config) best = v;
+    }
+
+    //re-tune if the recorded binary has changed
+    if (best!=-1) {
+      properties_t variantInfo = kernelInfo;
+      variantInfo["defines/" "p_NblockV"]= variants[best].NblockV;
+      kernel_t kernel = platform.buildKernel(fileName, variants[best].kernelName,
+                                             variantInfo);
+      if (!registry.Verify(key, entry, kernel.binaryFilename())) best = -1;
+    }
+  }
+
+  if (best==-1) {
+    //time each variant on the local elements of this mesh
+    const dlong Nelements = mesh.Nelements;
+    const dlong Nlocal = ogsMasked.Ngather + gHalo.Nhalo;
+
+    memory<dlong> elementList(Nelements);
+    for (dlong e=0;e<Nelements;++e) elementList[e] = e;
+    deviceMemory<dlong> o_elementList = platform.malloc<dlong>(elementList);
+
+    memory<dfloat> q(Nlocal, 1.0);
+    deviceMemory<dfloat> o_q = platform.malloc<dfloat>(q);
+
+    constexpr int Ntests = 10;
+
+    std::vector<kernel_t> kernels(Nvariants);
+    memory<double> times(Nvariants);
+    for (int v=0;v<Nvariants;++v) {
+      properties_t variantInfo = kernelInfo;
+      variantInfo["defines/" "p_NblockV"]= variants[v].NblockV;
+
+      kernels[v] = platform.buildKernel(fileName, variants[v].kernelName,
+                                        variantInfo);
+      kernel_t& kernel = kernels[v];
+
+      //warm up
+      if (Nelements)
+        kernel(Nelements, o_elementList, o_GlobalToLocal,
+               mesh.o_wJ, mesh.o_ggeo, mesh.o_D, mesh.o_S,
+               mesh.o_MM, lambda, o_q, o_AqL);
+
+      timePoint_t start = PlatformTime(platform);
+      for (int n=0;n<Ntests;++n) {
+        if (Nelements)
+          kernel(Nelements, o_elementList, o_GlobalToLocal,
+                 mesh.o_wJ, mesh.o_ggeo, mesh.o_D, mesh.o_S,
+                 mesh.o_MM, lambda, o_q, o_AqL);
+      }
+      timePoint_t end = PlatformTime(platform);
+
+      times[v] = ElapsedTime(start, end)/Ntests;
+    }
+
+    //the slowest rank decides
+    comm.Allreduce(times, Comm::Max);
+
+    best = 0;
+    for (int v=1;v<Nvariants;++v) {
+      if (times[v] < times[best]) best = v;
+    }
+
+    entry.config = variants[best].kernelName
+                 + " p_NblockV=" + std::to_string(variants[best].NblockV);
+    entry.time = times[best];
+    if (comm.rank()==0)
+      entry.binaryHash = occa::hashFile(kernels[best].binaryFilename()).getString();
+    registry.Record(key, entry);
+  }
+
+  axKernelName = variants[best].kernelName;
+  axNblockV = variants[best].NblockV;
+
+  if (comm.rank()==0 && settings.compareSetting("VERBOSE", "TRUE"))
+    printf("Using %s with %d elements per block for degree %d\n",
+           axKernelName.c_str(), axNblockV, mesh.N);
+}
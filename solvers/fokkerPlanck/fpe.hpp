@@ -71,6 +71,7 @@ public:
 class fpe_t: public solver_t {
 public:
   mesh_t mesh;
+  vtuWriter_t vtu;
   timeStepper_t timeStepper;
 
   ogs::halo_t traceHalo;
@@ -122,7 +123,8 @@ public:
 
   void Report(dfloat time, int tstep);
 
-  void PlotFields(memory<dfloat>& Q, std::string fileName);
+  void PlotFields(deviceMemory<dfloat>& o_Q, const std::string name,
+                  const int frame, const dfloat time);
 
   dfloat MaxWaveSpeed(deviceMemory<dfloat>& o_Q, const dfloat T);
 
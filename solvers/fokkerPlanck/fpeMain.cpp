@@ -57,8 +57,12 @@ int main(int argc, char **argv){
     // set up fpe solver
     fpe_t fpe(platform, mesh, fpeSettings);
 
-    // run
-    fpe.Run();
+    // run, unless only warming up the kernel cache
+    if (!platformSettings.compareSetting("WARM UP","TRUE"))
+      fpe.Run();
+
+    //report the profile while every rank is still here, before teardown
+    Profiler::Finalize();
   }
 
   // close down MPI
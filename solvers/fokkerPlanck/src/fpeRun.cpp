@@ -74,4 +74,7 @@ void fpe_t::Run(){
     if(mesh.rank==0)
       printf("Solution norm = %17.15lg\n", norm2);
   }
+
+  //wait for queued output to reach disk
+  vtu.Flush();
 }
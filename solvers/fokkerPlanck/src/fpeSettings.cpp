@@ -81,6 +81,8 @@ fpeSettings_t::fpeSettings_t(comm_t& _comm):
   newSetting("OUTPUT FILE NAME",
              "fpe");
 
+  TimeStepper::AddSettings(*this);
+
   ellipticAddSettings(*this, "ELLIPTIC ");
   parAlmond::AddSettings(*this, "ELLIPTIC ");
 }
@@ -104,6 +106,7 @@ void fpeSettings_t::report() {
     reportSetting("OUTPUT INTERVAL");
     reportSetting("OUTPUT TO FILE");
     reportSetting("OUTPUT FILE NAME");
+    TimeStepper::ReportSettings(*this);
 
     std::cout << "\nElliptic Solver Settings:\n\n";
 
@@ -120,6 +123,7 @@ void fpeSettings_t::report() {
 
     if (compareSetting("ELLIPTIC PRECONDITIONER","MULTIGRID")
       ||compareSetting("ELLIPTIC PRECONDITIONER","PARALMOND")) {
+      reportSetting("ELLIPTIC PRECONDITIONER PRECISION");
       reportSetting("ELLIPTIC PARALMOND CYCLE");
       reportSetting("ELLIPTIC PARALMOND SMOOTHER");
       reportSetting("ELLIPTIC PARALMOND CHEBYSHEV DEGREE");
@@ -34,6 +34,9 @@ void fpe_t::Setup(platform_t& _platform, mesh_t& _mesh,
   comm = _mesh.comm;
   settings = _settings;
 
+  //setup field output
+  vtu.Setup(mesh);
+
   //Trigger JIT kernel builds
   ogs::InitializeKernels(platform, ogs::Dfloat, ogs::Add);
 
@@ -113,6 +116,12 @@ void fpe_t::Setup(platform_t& _platform, mesh_t& _mesh,
     } else if (ellipticSettings.compareSetting("LINEAR SOLVER","NBFPCG")){
       linearSolver.Setup<LinearSolver::nbfpcg>(elliptic.Ndofs, elliptic.Nhalo,
                                               platform, ellipticSettings, comm);
+    } else if (ellipticSettings.compareSetting("LINEAR SOLVER","PIPECG")){
+      linearSolver.Setup<LinearSolver::pipecg>(elliptic.Ndofs, elliptic.Nhalo,
+                                              platform, ellipticSettings, comm);
+    } else if (ellipticSettings.compareSetting("LINEAR SOLVER","BPCG")){
+      linearSolver.Setup<LinearSolver::bpcg>(elliptic.Ndofs, elliptic.Nhalo,
+                                              platform, ellipticSettings, comm);
     } else if (ellipticSettings.compareSetting("LINEAR SOLVER","PCG")){
       linearSolver.Setup<LinearSolver::pcg>(elliptic.Ndofs, elliptic.Nhalo,
                                               platform, ellipticSettings, comm);
@@ -265,6 +274,12 @@ void fpe_t::Setup(platform_t& _platform, mesh_t& _mesh,
     subcycler.comm = comm;
     subcycler.settings = settings;
 
+    //subcycles are restarted with the outer time step, never checkpointed,
+    // and keep the fixed sub-step the outer step divides into
+    subcycler.settings.changeSetting("CHECKPOINT INTERVAL", "0");
+    subcycler.settings.changeSetting("RESTART FROM CHECKPOINT", "FALSE");
+    subcycler.settings.changeSetting("TIME STEP UPDATE INTERVAL", "0");
+
     subcycler.cubature = cubature;
     subcycler.traceHalo = traceHalo;
     subcycler.advectionVolumeKernel = advectionVolumeKernel;
@@ -48,6 +48,7 @@ public:
 class gradient_t: public solver_t {
 public:
   mesh_t mesh;
+  vtuWriter_t vtu;
 
   int Nfields;
 
@@ -58,8 +58,12 @@ int main(int argc, char **argv){
     // set up gradient solver
     gradient_t gradient(platform, mesh, gradientSettings);
 
-    // run
-    gradient.Run();
+    // run, unless only warming up the kernel cache
+    if (!platformSettings.compareSetting("WARM UP","TRUE"))
+      gradient.Run();
+
+    //report the profile while every rank is still here, before teardown
+    Profiler::Finalize();
   }
 
   // close down MPI
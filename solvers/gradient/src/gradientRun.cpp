@@ -54,4 +54,6 @@ void gradient_t::Run(){
       printf("Solution norm = %17.15lg\n", norm2);
   }
 
+  //wait for queued output to reach disk
+  vtu.Flush();
 }
@@ -34,6 +34,9 @@ void gradient_t::Setup(platform_t& _platform, mesh_t& _mesh,
   comm = mesh.comm;
   settings = _settings;
 
+  //setup field output
+  vtu.Setup(mesh);
+
   Nfields = mesh.dim;
 
   dlong Nlocal = mesh.Nelements*mesh.Np;
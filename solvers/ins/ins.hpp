@@ -81,6 +81,7 @@ public:
 class ins_t: public solver_t {
 public:
   mesh_t mesh;
+  vtuWriter_t vtu;
   timeStepper_t timeStepper;
 
   ogs::halo_t vTraceHalo;
@@ -99,6 +100,10 @@ public:
 
   int NiterU, NiterV, NiterW, NiterP;
 
+  //solve the velocity components as one block
+  int vBlockSolve;
+  memory<int> vNiters;
+
   int cubature, pressureIncrement;
   int vDisc_c0, pDisc_c0;
   dfloat velTOL, presTOL;
@@ -170,7 +175,10 @@ public:
 
   void Report(dfloat time, int tstep);
 
-  void PlotFields(memory<dfloat>& U, memory<dfloat>& P, memory<dfloat>& V, std::string fileName);
+  void SetupCheckpoint(checkpoint_t& checkpoint);
+
+  void PlotFields(deviceMemory<dfloat>& o_U, deviceMemory<dfloat>& o_P, deviceMemory<dfloat>& o_V,
+                  const std::string name, const int frame, const dfloat time);
 
   dfloat MaxWaveSpeed(deviceMemory<dfloat>& o_U, const dfloat T);
 
@@ -57,8 +57,12 @@ int main(int argc, char **argv){
     // set up ins solver
     ins_t ins(platform, mesh, insSettings);
 
-    // run
-    ins.Run();
+    // run, unless only warming up the kernel cache
+    if (!platformSettings.compareSetting("WARM UP","TRUE"))
+      ins.Run();
+
+    //report the profile while every rank is still here, before teardown
+    Profiler::Finalize();
   }
 
   // close down MPI
@@ -24,32 +24,10 @@ SOFTWARE.
 
 */
 
-#include "SWEC.hpp"
+#include "ins.hpp"
 
-void SWEC_t::Report(dfloat time, int tstep){
-
-  static int frame=0;
-
-  //compute q.M*q
-  mesh.MassMatrixApply(o_q, o_Mq);
-
-  dlong Nentries = mesh.Nelements*mesh.Np*Nfields;
-  dfloat norm2 = sqrt(platform.linAlg().innerProd(Nentries, o_q, o_Mq, mesh.comm));
-
-  if(mesh.rank==0)
-    printf("%5.2f (%d), %5.2f (time, timestep, norm)\n", time, tstep, norm2);
-
-  if (settings.compareSetting("OUTPUT TO FILE","TRUE")) {
-
-    // copy data back to host
-    o_q.copyTo(q);
-
-    // output field files
-    std::string name;
-    settings.getSetting("OUTPUT FILE NAME", name);
-    char fname[BUFSIZ];
-    sprintf(fname, "%s_%04d_%04d.vtu", name.c_str(), mesh.rank, frame++);
-
-    PlotFields(q, std::string(fname));
-  }
+// pressure is carried between time steps, either as the base of the
+// pressure increment or as the initial guess of the pressure solve
+void ins_t::SetupCheckpoint(checkpoint_t& checkpoint){
+  checkpoint.AddField("p", o_p);
 }
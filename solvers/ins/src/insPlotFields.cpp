@@ -26,162 +26,22 @@ SOFTWARE.
 
 #include "ins.hpp"
 
-// interpolate data to plot nodes and save to file (one per process
-void ins_t::PlotFields(memory<dfloat>& U, memory<dfloat>& P, memory<dfloat>& V, std::string fileName){
+// interpolate data to plot nodes and save to file (one per process)
+void ins_t::PlotFields(deviceMemory<dfloat>& o_U, deviceMemory<dfloat>& o_P, deviceMemory<dfloat>& o_V,
+                       const std::string name, const int frame, const dfloat time){
 
-  FILE *fp;
+  if (o_U.length()!=0)
+    vtu.AddField("Velocity", o_U, NVfields, 0, mesh.dim);
 
-  fp = fopen(fileName.c_str(), "w");
+  if (o_P.length()!=0)
+    vtu.AddField("Pressure", o_P);
 
-  fprintf(fp, "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"BigEndian\">\n");
-  fprintf(fp, "  <UnstructuredGrid>\n");
-  fprintf(fp, "    <Piece NumberOfPoints=\"%d\" NumberOfCells=\"%d\">\n",
-          mesh.Nelements*mesh.plotNp,
-          mesh.Nelements*mesh.plotNelements);
-
-  // write out nodes
-  fprintf(fp, "      <Points>\n");
-  fprintf(fp, "        <DataArray type=\"Float32\" NumberOfComponents=\"3\" Format=\"ascii\">\n");
-
-  //scratch space for interpolation
-  size_t Nscratch = std::max(mesh.Np, mesh.plotNp);
-  memory<dfloat> scratch(2*Nscratch);
-
-  memory<dfloat> Ix(mesh.plotNp);
-  memory<dfloat> Iy(mesh.plotNp);
-  memory<dfloat> Iz(mesh.plotNp);
-
-  // compute plot node coordinates on the fly
-  for(dlong e=0;e<mesh.Nelements;++e){
-    mesh.PlotInterp(mesh.x + e*mesh.Np, Ix, scratch);
-    mesh.PlotInterp(mesh.y + e*mesh.Np, Iy, scratch);
-    if(mesh.dim==3)
-      mesh.PlotInterp(mesh.z + e*mesh.Np, Iz, scratch);
-
-    if (mesh.dim==2) {
-      for(int n=0;n<mesh.plotNp;++n){
-        fprintf(fp, "       ");
-        fprintf(fp, "%g %g %g\n", Ix[n],Iy[n],0.0);
-      }
-    } else {
-      for(int n=0;n<mesh.plotNp;++n){
-        fprintf(fp, "       ");
-        fprintf(fp, "%g %g %g\n", Ix[n],Iy[n],Iz[n]);
-      }
-    }
-  }
-  fprintf(fp, "        </DataArray>\n");
-  fprintf(fp, "      </Points>\n");
-
-  memory<dfloat> Ip(mesh.plotNp);
-  memory<dfloat> Iu(mesh.plotNp);
-  memory<dfloat> Iv(mesh.plotNp);
-  memory<dfloat> Iw(mesh.plotNp);
-
-  fprintf(fp, "      <PointData Scalars=\"scalars\">\n");
-  if (U.length()!=0) {
-    // write out velocity
-    fprintf(fp, "        <DataArray type=\"Float32\" Name=\"Velocity\" NumberOfComponents=\"%d\" Format=\"ascii\">\n", mesh.dim);
-    for(dlong e=0;e<mesh.Nelements;++e){
-      mesh.PlotInterp(U + 0*mesh.Np + e*mesh.Np*NVfields, Iu, scratch);
-      mesh.PlotInterp(U + 1*mesh.Np + e*mesh.Np*NVfields, Iv, scratch);
-      if(mesh.dim==3)
-        mesh.PlotInterp(U + 2*mesh.Np + e*mesh.Np*NVfields, Iw, scratch);
-
-      for(int n=0;n<mesh.plotNp;++n){
-        fprintf(fp, "       ");
-        fprintf(fp, "       ");
-        if (mesh.dim==2)
-          fprintf(fp, "%g %g\n", Iu[n], Iv[n]);
-        else
-          fprintf(fp, "%g %g %g\n", Iu[n], Iv[n], Iw[n]);
-      }
-    }
-    fprintf(fp, "       </DataArray>\n");
-  }
-
-  if (P.length()!=0) {
-    // write out pressure
-    fprintf(fp, "        <DataArray type=\"Float32\" Name=\"Pressure\" Format=\"ascii\">\n");
-    for(dlong e=0;e<mesh.Nelements;++e){
-      mesh.PlotInterp(P + e*mesh.Np, Ip, scratch);
-
-      for(int n=0;n<mesh.plotNp;++n){
-        fprintf(fp, "       ");
-        fprintf(fp, "%g\n", Ip[n]);
-      }
-    }
-    fprintf(fp, "       </DataArray>\n");
-  }
-
-  if (V.length()!=0) {
-    // write out vorticity
-    if(mesh.dim==2){
-      fprintf(fp, "        <DataArray type=\"Float32\" Name=\"Vorticity\" Format=\"ascii\">\n");
-      for(dlong e=0;e<mesh.Nelements;++e){
-        mesh.PlotInterp(V + e*mesh.Np, Ip, scratch);
-
-        for(int n=0;n<mesh.plotNp;++n){
-          fprintf(fp, "       ");
-          fprintf(fp, "%g\n", Ip[n]);
-        }
-      }
-    } else {
-      fprintf(fp, "        <DataArray type=\"Float32\" Name=\"Vorticity\" NumberOfComponents=\"3\" Format=\"ascii\">\n");
-      for(dlong e=0;e<mesh.Nelements;++e){
-        mesh.PlotInterp(V + 0*mesh.Np + e*mesh.Np*3, Iu, scratch);
-        mesh.PlotInterp(V + 1*mesh.Np + e*mesh.Np*3, Iv, scratch);
-        mesh.PlotInterp(V + 2*mesh.Np + e*mesh.Np*3, Iw, scratch);
-
-        for(int n=0;n<mesh.plotNp;++n){
-          fprintf(fp, "       ");
-          fprintf(fp, "       ");
-          fprintf(fp, "%g %g %g\n", Iu[n], Iv[n], Iw[n]);
-        }
-      }
-    }
-    fprintf(fp, "       </DataArray>\n");
+  if (o_V.length()!=0) {
+    if(mesh.dim==2)
+      vtu.AddField("Vorticity", o_V);
+    else
+      vtu.AddField("Vorticity", o_V, 3, 0, 3);
   }
-  fprintf(fp, "     </PointData>\n");
-
-  fprintf(fp, "    <Cells>\n");
-  fprintf(fp, "      <DataArray type=\"Int32\" Name=\"connectivity\" Format=\"ascii\">\n");
 
-  for(dlong e=0;e<mesh.Nelements;++e){
-    for(int n=0;n<mesh.plotNelements;++n){
-      fprintf(fp, "       ");
-      for(int m=0;m<mesh.plotNverts;++m){
-        fprintf(fp, "%d ", e*mesh.plotNp + mesh.plotEToV[n*mesh.plotNverts+m]);
-      }
-      fprintf(fp, "\n");
-    }
-  }
-  fprintf(fp, "        </DataArray>\n");
-
-  fprintf(fp, "        <DataArray type=\"Int32\" Name=\"offsets\" Format=\"ascii\">\n");
-  dlong cnt = 0;
-  for(dlong e=0;e<mesh.Nelements;++e){
-    for(int n=0;n<mesh.plotNelements;++n){
-      cnt += mesh.plotNverts;
-      fprintf(fp, "       ");
-      fprintf(fp, "%d\n", cnt);
-    }
-  }
-  fprintf(fp, "       </DataArray>\n");
-
-  fprintf(fp, "       <DataArray type=\"Int32\" Name=\"types\" Format=\"ascii\">\n");
-  for(dlong e=0;e<mesh.Nelements;++e){
-    for(int n=0;n<mesh.plotNelements;++n){
-      if(mesh.dim==2)
-        fprintf(fp, "5\n");
-      else
-        fprintf(fp, "10\n");
-    }
-  }
-  fprintf(fp, "        </DataArray>\n");
-  fprintf(fp, "      </Cells>\n");
-  fprintf(fp, "    </Piece>\n");
-  fprintf(fp, "  </UnstructuredGrid>\n");
-  fprintf(fp, "</VTKFile>\n");
-  fclose(fp);
+  vtu.Write(name, frame, time);
 }
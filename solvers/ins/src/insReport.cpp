@@ -28,8 +28,6 @@ SOFTWARE.
 
 void ins_t::Report(dfloat time, int tstep){
 
-  static int frame=0;
-
   //compute U.M*U
   mesh.MassMatrixApply(o_u, o_MU);
 
@@ -43,17 +41,9 @@ void ins_t::Report(dfloat time, int tstep){
     //compute vorticity
     vorticityKernel(mesh.Nelements, mesh.o_vgeo, mesh.o_D, o_u, o_Vort);
 
-    // copy data back to host
-    o_u.copyTo(u);
-    o_p.copyTo(p);
-    o_Vort.copyTo(Vort);
-
     // output field files
     std::string name;
     settings.getSetting("OUTPUT FILE NAME", name);
-    char fname[BUFSIZ];
-    sprintf(fname, "%s_%04d_%04d.vtu", name.c_str(), mesh.rank, frame++);
-
-    PlotFields(u, p, Vort, std::string(fname));
+    PlotFields(o_u, o_p, o_Vort, name, outputFrame++, time);
   }
 }
@@ -77,4 +77,6 @@ void ins_t::Run(){
       printf("Solution norm = %17.15lg\n", norm2);
   }
 
+  //wait for queued output to reach disk
+  vtu.Flush();
 }
@@ -86,6 +86,8 @@ insSettings_t::insSettings_t(comm_t& _comm):
   newSetting("OUTPUT FILE NAME",
              "ins");
 
+  TimeStepper::AddSettings(*this);
+
   ellipticAddSettings(*this, "VELOCITY ");
   parAlmond::AddSettings(*this, "VELOCITY ");
   InitialGuess::AddSettings(*this, "VELOCITY ");
@@ -115,6 +117,7 @@ void insSettings_t::report() {
     reportSetting("OUTPUT INTERVAL");
     reportSetting("OUTPUT TO FILE");
     reportSetting("OUTPUT FILE NAME");
+    TimeStepper::ReportSettings(*this);
 
     std::cout << "\nVelocity Solver Settings:\n\n";
 
@@ -133,6 +136,7 @@ void insSettings_t::report() {
 
     if (compareSetting("VELOCITY PRECONDITIONER","MULTIGRID")
       ||compareSetting("VELOCITY PRECONDITIONER","PARALMOND")) {
+      reportSetting("VELOCITY PRECONDITIONER PRECISION");
       reportSetting("VELOCITY PARALMOND CYCLE");
       reportSetting("VELOCITY PARALMOND SMOOTHER");
       reportSetting("VELOCITY PARALMOND CHEBYSHEV DEGREE");
@@ -155,6 +159,7 @@ void insSettings_t::report() {
 
     if (compareSetting("PRESSURE PRECONDITIONER","MULTIGRID")
       ||compareSetting("PRESSURE PRECONDITIONER","PARALMOND")) {
+      reportSetting("PRESSURE PRECONDITIONER PRECISION");
       reportSetting("PRESSURE PARALMOND CYCLE");
       reportSetting("PRESSURE PARALMOND SMOOTHER");
       reportSetting("PRESSURE PARALMOND CHEBYSHEV DEGREE");
@@ -34,6 +34,9 @@ void ins_t::Setup(platform_t& _platform, mesh_t& _mesh,
   comm = _mesh.comm;
   settings = _settings;
 
+  //setup field output
+  vtu.Setup(mesh);
+
   //Trigger JIT kernel builds
   ogs::InitializeKernels(platform, ogs::Dfloat, ogs::Add);
 
@@ -143,6 +146,21 @@ void ins_t::Setup(platform_t& _platform, mesh_t& _mesh,
     vNhalo = vSolver.Nhalo;
     if (mesh.dim == 3) wNhalo = wSolver.Nhalo;
 
+    //u, v, and w share one mask, and can be solved as one block, unless
+    // there are slip boundaries. Block solves also need a stateless initial guess
+    vBlockSolve = 0;
+    if (vDisc_c0 && vSettings.compareSetting("LINEAR SOLVER","BPCG")
+        && (vSettings.compareSetting("INITIAL GUESS STRATEGY", "NONE")
+          ||vSettings.compareSetting("INITIAL GUESS STRATEGY", "ZERO"))) {
+      int slip = 0;
+      for (dlong n=0;n<mesh.Nelements*mesh.Nfaces;++n) {
+        const int bc = mesh.EToB[n];
+        if (bc==4 || bc==5 || bc==6) slip = 1;
+      }
+      comm.Allreduce(slip, Comm::Max);
+      vBlockSolve = !slip;
+    }
+
     if (vSettings.compareSetting("LINEAR SOLVER","NBPCG")){
 
       uLinearSolver.Setup<LinearSolver::nbpcg>(uNlocal, uNhalo, platform, vSettings, comm);
@@ -157,6 +175,26 @@ void ins_t::Setup(platform_t& _platform, mesh_t& _mesh,
       if (mesh.dim==3)
         wLinearSolver.Setup<LinearSolver::nbfpcg>(wNlocal, wNhalo, platform, vSettings, comm);
 
+    } else if (vSettings.compareSetting("LINEAR SOLVER","PIPECG")){
+
+      uLinearSolver.Setup<LinearSolver::pipecg>(uNlocal, uNhalo, platform, vSettings, comm);
+      vLinearSolver.Setup<LinearSolver::pipecg>(vNlocal, vNhalo, platform, vSettings, comm);
+      if (mesh.dim==3)
+        wLinearSolver.Setup<LinearSolver::pipecg>(wNlocal, wNhalo, platform, vSettings, comm);
+
+    } else if (vSettings.compareSetting("LINEAR SOLVER","BPCG")){
+
+      if (vBlockSolve) {
+        //one solver for all velocity components
+        uLinearSolver.Setup<LinearSolver::bpcg>(uNlocal, uNhalo, platform, vSettings, comm, NVfields);
+        uSolver.SetupBlockOperator(NVfields);
+      } else {
+        uLinearSolver.Setup<LinearSolver::bpcg>(uNlocal, uNhalo, platform, vSettings, comm);
+        vLinearSolver.Setup<LinearSolver::bpcg>(vNlocal, vNhalo, platform, vSettings, comm);
+        if (mesh.dim==3)
+          wLinearSolver.Setup<LinearSolver::bpcg>(wNlocal, wNhalo, platform, vSettings, comm);
+      }
+
     } else if (vSettings.compareSetting("LINEAR SOLVER","PCG")){
 
       uLinearSolver.Setup<LinearSolver::pcg>(uNlocal, uNhalo, platform, vSettings, comm);
@@ -218,6 +256,7 @@ void ins_t::Setup(platform_t& _platform, mesh_t& _mesh,
 
   } else {
     vDisc_c0 = 0;
+    vBlockSolve = 0;
 
     //set penalty
     if (mesh.elementType==Mesh::TRIANGLES ||
@@ -262,6 +301,10 @@ void ins_t::Setup(platform_t& _platform, mesh_t& _mesh,
       pLinearSolver.Setup<LinearSolver::nbpcg>(pNlocal, pNhalo, platform, pSettings, comm);
     } else if (pSettings.compareSetting("LINEAR SOLVER","NBFPCG")){
       pLinearSolver.Setup<LinearSolver::nbfpcg>(pNlocal, pNhalo, platform, pSettings, comm);
+    } else if (pSettings.compareSetting("LINEAR SOLVER","PIPECG")){
+      pLinearSolver.Setup<LinearSolver::pipecg>(pNlocal, pNhalo, platform, pSettings, comm);
+    } else if (pSettings.compareSetting("LINEAR SOLVER","BPCG")){
+      pLinearSolver.Setup<LinearSolver::bpcg>(pNlocal, pNhalo, platform, pSettings, comm);
     } else if (pSettings.compareSetting("LINEAR SOLVER","PCG")){
       pLinearSolver.Setup<LinearSolver::pcg>(pNlocal, pNhalo, platform, pSettings, comm);
     } else if (pSettings.compareSetting("LINEAR SOLVER","PGMRES")){
@@ -324,7 +367,20 @@ void ins_t::Setup(platform_t& _platform, mesh_t& _mesh,
     if (mesh.dim==3)
       o_rhsW = platform.malloc<dfloat>(Nlocal+Nhalo, u);
 
-    if (vDisc_c0) {
+    if (vDisc_c0 && vBlockSolve) {
+      //stack the components, as the block solver expects
+      o_GUH = platform.malloc<dfloat>((uNlocal+uNhalo)*NVfields, u);
+      o_GVH = o_GUH + (uNlocal+uNhalo);
+      if (mesh.dim==3)
+        o_GWH = o_GUH + 2*(uNlocal+uNhalo);
+
+      o_GrhsU = platform.malloc<dfloat>((uNlocal+uNhalo)*NVfields, u);
+      o_GrhsV = o_GrhsU + (uNlocal+uNhalo);
+      if (mesh.dim==3)
+        o_GrhsW = o_GrhsU + 2*(uNlocal+uNhalo);
+
+      vNiters.malloc(NVfields);
+    } else if (vDisc_c0) {
       o_GUH = platform.malloc<dfloat>(uNlocal+uNhalo, u);
       o_GVH = platform.malloc<dfloat>(vNlocal+vNhalo, u);
       if (mesh.dim==3)
@@ -439,6 +495,12 @@ void ins_t::Setup(platform_t& _platform, mesh_t& _mesh,
     subcycler.comm = comm;
     subcycler.settings = settings;
 
+    //subcycles are restarted with the outer time step, never checkpointed,
+    // and keep the fixed sub-step the outer step divides into
+    subcycler.settings.changeSetting("CHECKPOINT INTERVAL", "0");
+    subcycler.settings.changeSetting("RESTART FROM CHECKPOINT", "FALSE");
+    subcycler.settings.changeSetting("TIME STEP UPDATE INTERVAL", "0");
+
     subcycler.NVfields = NVfields;
     subcycler.nu = nu;
     subcycler.cubature = cubature;
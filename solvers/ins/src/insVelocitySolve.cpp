@@ -69,7 +69,26 @@ void ins_t::VelocitySolve(deviceMemory<dfloat>& o_U, deviceMemory<dfloat>& o_RHS
   wSolver.lambda = gamma/nu;
 
   //  Solve lambda*U - Laplacian*U = rhs
-  if (vDisc_c0){
+  if (vDisc_c0 && vBlockSolve){
+    // gather all components, solve them together, scatter
+    uSolver.ogsMasked.Gather(o_GrhsU, o_rhsU, 1, ogs::Add, ogs::Trans);
+    uSolver.ogsMasked.Gather(o_GrhsV, o_rhsV, 1, ogs::Add, ogs::Trans);
+    if (mesh.dim==3)
+      uSolver.ogsMasked.Gather(o_GrhsW, o_rhsW, 1, ogs::Add, ogs::Trans);
+
+    uSolver.BlockSolve(uLinearSolver, o_GUH, o_GrhsU, NVfields, vNiters,
+                       velTOL, maxIter, verbose);
+
+    uSolver.ogsMasked.Scatter(o_UH, o_GUH, 1, ogs::NoTrans);
+    uSolver.ogsMasked.Scatter(o_VH, o_GVH, 1, ogs::NoTrans);
+    if (mesh.dim==3)
+      uSolver.ogsMasked.Scatter(o_WH, o_GWH, 1, ogs::NoTrans);
+
+    NiterU = vNiters[0];
+    NiterV = vNiters[1];
+    if (mesh.dim==3) NiterW = vNiters[2];
+
+  } else if (vDisc_c0){
     // gather, solve, scatter
     uSolver.ogsMasked.Gather(o_GrhsU, o_rhsU, 1, ogs::Add, ogs::Trans);
     NiterU = uSolver.Solve(uLinearSolver, o_GUH, o_GrhsU, velTOL, maxIter, verbose);
@@ -50,6 +50,7 @@ public:
 class lbs_t: public solver_t {
 public:
   mesh_t mesh;
+  vtuWriter_t vtu;
 
   int Nfields;
   int Nmacro;
@@ -133,7 +134,8 @@ public:
 
   void Report(dfloat time, int tstep);
 
-  void PlotFields(memory<dfloat>& Q, memory<dfloat>& V, std::string fileName);
+  void PlotFields(deviceMemory<dfloat>& o_Q, deviceMemory<dfloat>& o_V, const std::string name,
+                  const int frame, const dfloat time);
 
   dfloat MaxWaveSpeed();
 
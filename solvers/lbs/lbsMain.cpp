@@ -58,8 +58,12 @@ int main(int argc, char **argv){
     // set up lbs solver
     lbs_t lbs(platform, mesh, lbsSettings);
 
-    // run
-    lbs.Run();
+    // run, unless only warming up the kernel cache
+    if (!platformSettings.compareSetting("WARM UP","TRUE"))
+      lbs.Run();
+
+    //report the profile while every rank is still here, before teardown
+    Profiler::Finalize();
   }
 
   // close down MPI
@@ -27,7 +27,6 @@
 #include "lbs.hpp"
 
 void lbs_t::Report(dfloat time, int tstep){
-  static int frame=0;
   // Compute velocity and density
   momentsKernel(mesh.Nelements, o_LBM, o_q, o_U); 
 
@@ -45,18 +44,9 @@ void lbs_t::Report(dfloat time, int tstep){
 
   if (settings.compareSetting("OUTPUT TO FILE","TRUE")) {
 
-    // copy data back to host
-    // o_q.copyTo(q);
-    o_U.copyTo(U);
-    o_Vort.copyTo(Vort);
-
     // output field files
     std::string name;
     settings.getSetting("OUTPUT FILE NAME", name);
-    char fname[BUFSIZ];
-    sprintf(fname, "%s_%04d_%04d.vtu", name.c_str(), mesh.rank, frame++);
-
-    // PlotFields(o_q, Vort, fname);
-    PlotFields(U, Vort, std::string(fname));
+    PlotFields(o_U, o_Vort, name, outputFrame++, time);
   }
 }
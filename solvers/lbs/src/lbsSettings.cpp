@@ -92,6 +92,8 @@ lbsSettings_t::lbsSettings_t(comm_t& _comm):
 
   newSetting("OUTPUT FILE NAME",
              "lbs");
+
+  TimeStepper::AddSettings(*this);
 }
 
 void lbsSettings_t::report() {
@@ -112,6 +114,7 @@ void lbsSettings_t::report() {
     reportSetting("OUTPUT INTERVAL");
     reportSetting("OUTPUT TO FILE");
     reportSetting("OUTPUT FILE NAME");
+    TimeStepper::ReportSettings(*this);
   }
 }
 
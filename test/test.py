@@ -47,6 +47,7 @@ cnsDir           = solverDir + "/cns"
 bnsDir           = solverDir + "/bns"
 lbsDir           = solverDir + "/lbs"
 insDir           = solverDir + "/ins"
+SWEDir           = solverDir + "/SWE"
 
 gradientBin  = gradientDir      + "/gradientMain"
 advectionBin = advectionDir     + "/advectionMain"
@@ -57,6 +58,7 @@ cnsBin       = cnsDir           + "/cnsMain"
 bnsBin       = bnsDir           + "/bnsMain"
 lbsBin       = lbsDir           + "/lbsMain"
 insBin       = insDir           + "/insMain"
+SWEBin       = SWEDir           + "/SWEMain"
 
 inputRC = testDir + "/setup.rc"
 
@@ -98,67 +100,83 @@ def writeSetup(filename, settings):
   file.write(str_settings)
   file.close()
 
-def test(name, cmd, settings, referenceNorm, ranks=1):
+def dumpRun(name, run):
+  print(bcolors.WARNING + name + " stdout:" + bcolors.ENDC)
+  print(run.stdout.decode())
+  print(bcolors.WARNING + name + " stderr:" + bcolors.ENDC)
+  print(run.stderr.decode())
 
+def runSetup(cmd, settings, ranks=1):
   #create input file
   writeSetup("setup",settings)
 
-  #print test name
-  print(bcolors.TEST + f"{name:.<{alignWidth}}" + bcolors.ENDC, end="", flush=True)
-
   #run test
   run = subprocess.run(["mpirun", "--oversubscribe", "-np", str(ranks), cmd, inputRC],
                         stdout=subprocess.PIPE, stderr=subprocess.PIPE)
 
-  if len(run.stdout.decode().splitlines())==0:
+  #clean up
+  os.remove(inputRC)
+  return run
+
+def runNorm(name, run, settings):
+  #collect last norm line of output, skipping any profiler report printed at exit
+  lines = run.stdout.decode().splitlines()
+  normLines = [line for line in lines if "Solution norm = " in line]
+  if len(normLines)==0:
     #this failure is bad, dump the whole output for debug
     print(bcolors.FAIL + "FAIL" + bcolors.ENDC)
-    print(bcolors.WARNING + name + " stdout:" + bcolors.ENDC)
-    print(run.stdout.decode())
-    print(bcolors.WARNING + name + " stderr:" + bcolors.ENDC)
-    print(run.stderr.decode())
+    dumpRun(name, run)
     #save the setup for reproducibility
     writeSetup(name,settings)
-    failed = 1
-  else:
-    #collect last line of output
-    output = run.stdout.decode().splitlines()[-1]
-
-    #check last line's syntax
-    failed=0;
-    if "Solution norm = " in output:
-      norm = float(output.split()[3])
-      if abs(norm - referenceNorm) < TOL:
-        print(bcolors.PASS + "PASS" + bcolors.ENDC)
-      else:
-        #failed residual check
-        print(bcolors.FAIL + "FAIL" + bcolors.ENDC)
-        print(bcolors.WARNING + "Expected Result: " + str(referenceNorm) + bcolors.ENDC)
-        print(bcolors.WARNING + "Observed Result: " + str(norm) + bcolors.ENDC)
-        #save the setup for reproducibility
-        writeSetup(name,settings)
-        failed = 1
-    else:
-      #this failure is worse, so dump the whole output for debug
-      print(bcolors.FAIL + "FAIL" + bcolors.ENDC)
-      print(bcolors.WARNING + name + " stdout:" + bcolors.ENDC)
-      print(run.stdout.decode())
-      print(bcolors.WARNING + name + " stderr:" + bcolors.ENDC)
-      print(run.stderr.decode())
-      #save the setup for reproducibility
-      writeSetup(name,settings)
-      failed = 1
-
-  # writeSetup(name,settings)
-  # print(bcolors.WARNING + name + " stdout:" + bcolors.ENDC)
-  # print(run.stdout.decode())
-  # print(bcolors.WARNING + name + " stderr:" + bcolors.ENDC)
-  # print(run.stderr.decode())
+    return None
 
-  #clean up
-  os.remove(inputRC)
+  return float(normLines[-1].split()[3])
+
+def solutionNorm(name, cmd, settings, ranks=1):
+  #run a setup and return its final solution norm, or None on failure
+  return runNorm(name, runSetup(cmd, settings, ranks), settings)
+
+def checkNorm(name, settings, norm, referenceNorm, tol):
+  if abs(norm - referenceNorm) < tol:
+    print(bcolors.PASS + "PASS" + bcolors.ENDC)
+    return 0
+
+  #failed residual check
+  print(bcolors.FAIL + "FAIL" + bcolors.ENDC)
+  print(bcolors.WARNING + "Expected Result: " + str(referenceNorm) + bcolors.ENDC)
+  print(bcolors.WARNING + "Observed Result: " + str(norm) + bcolors.ENDC)
+  #save the setup for reproducibility
+  writeSetup(name,settings)
+  return 1
+
+def test(name, cmd, settings, referenceNorm, ranks=1):
+
+  #print test name
+  print(bcolors.TEST + f"{name:.<{alignWidth}}" + bcolors.ENDC, end="", flush=True)
+
+  norm = solutionNorm(name, cmd, settings, ranks)
+  if norm is None:
+    return 1
+
+  return checkNorm(name, settings, norm, referenceNorm, TOL)
+
+def testCompare(name, cmd, settings, referenceSettings, ranks=1,
+                referenceRanks=1, tol=TOL):
+  #compare against the norm of a reference setup run with the same binary,
+  # for features whose result should match an existing configuration
+
+  #print test name
+  print(bcolors.TEST + f"{name:.<{alignWidth}}" + bcolors.ENDC, end="", flush=True)
+
+  referenceNorm = solutionNorm(name + "_reference", cmd, referenceSettings, referenceRanks)
+  if referenceNorm is None:
+    return 1
+
+  norm = solutionNorm(name, cmd, settings, ranks)
+  if norm is None:
+    return 1
 
-  return failed
+  return checkNorm(name, settings, norm, referenceNorm, tol)
 
 if __name__ == "__main__":
   import testMesh
@@ -171,6 +189,7 @@ if __name__ == "__main__":
   import testBns
   import testLbs
   import testIns
+  import testSWE
   import testTimeStepper
   import testLinearSolver
   import testParAlmond
@@ -189,6 +208,7 @@ if __name__ == "__main__":
   failCount+=testBns.main()
   failCount+=testLbs.main()
   failCount+=testIns.main()
+  failCount+=testSWE.main()
   failCount+=testInitialGuess.main()
   failCount+=testTimeStepper.main()
   failCount+=testLinearSolver.main()
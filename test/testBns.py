@@ -119,7 +119,7 @@ def main():
 
   #clean up
   for file_name in os.listdir(testDir):
-    if file_name.endswith('.vtu'):
+    if file_name.endswith(('.vtu', '.pvtu', '.pvd')):
       os.remove(testDir + "/" + file_name)
 
   return failCount
@@ -34,15 +34,21 @@ ellipticData3D = ellipticDir + "/data/ellipticSine3D.h"
 def ellipticSettings(rcformat="2.0", data_file=ellipticData2D,
                      mesh="BOX", dim=2, element=4, nx=10, ny=10, nz=10, boundary_flag=1,
                      degree=4, thread_model=device, platform_number=0, device_number=0,
+                     profiler="NONE", profiler_output_file="profile",
                      Lambda=1.0,
                      discretization="CONTINUOUS",
                      linear_solver="PCG",
+                     ax_kernel_tuning="FALSE",
                      precon="MULTIGRID",
+                     precon_precision="DOUBLE",
                      multigrid_smoother="CHEBYSHEV",
                      paralmond_cycle="VCYCLE",
                      paralmond_strength="SYMMETRIC",
                      paralmond_aggregation="UNSMOOTHED",
                      paralmond_smoother="CHEBYSHEV",
+                     paralmond_coarse_solver="EXACT",
+                     paralmond_coarse_size=10000,
+                     paralmond_agglomeration_size=0,
                      output_to_file="FALSE"):
   return [setting_t("FORMAT", rcformat),
           setting_t("DATA FILE", data_file),
@@ -60,17 +66,77 @@ def ellipticSettings(rcformat="2.0", data_file=ellipticData2D,
           setting_t("THREAD MODEL", thread_model),
           setting_t("PLATFORM NUMBER", platform_number),
           setting_t("DEVICE NUMBER", device_number),
+          setting_t("PROFILER", profiler),
+          setting_t("PROFILER OUTPUT FILE", profiler_output_file),
           setting_t("DISCRETIZATION", discretization),
           setting_t("LINEAR SOLVER", linear_solver),
+          setting_t("AX KERNEL TUNING", ax_kernel_tuning),
           setting_t("PRECONDITIONER", precon),
+          setting_t("PRECONDITIONER PRECISION", precon_precision),
           setting_t("MULTIGRID SMOOTHER", multigrid_smoother),
           setting_t("PARALMOND CYCLE", paralmond_cycle),
           setting_t("PARALMOND STRENGTH", paralmond_strength),
           setting_t("PARALMOND AGGREGATION", paralmond_aggregation),
           setting_t("PARALMOND SMOOTHER", paralmond_smoother),
+          setting_t("PARALMOND COARSE SOLVER", paralmond_coarse_solver),
+          setting_t("PARALMOND COARSE SIZE", paralmond_coarse_size),
+          setting_t("PARALMOND AGGLOMERATION SIZE", paralmond_agglomeration_size),
           setting_t("OUTPUT TO FILE", "FALSE"),
           setting_t("VERBOSE", output_to_file)]
 
+def registryEntries(cacheDir):
+  fileName = cacheDir + "/kernelRegistry.dat"
+  if not os.path.exists(fileName):
+    return 0
+  with open(fileName) as f:
+    return len(f.readlines())
+
+def testRegistryRoundTrip():
+  #the first tuned run in an empty kernel cache records its choice in the
+  # kernel registry, the second must find it there and record nothing new
+  import shutil
+  cacheDir = testDir + "/registryCache"
+  shutil.rmtree(cacheDir, ignore_errors=True)
+
+  oldCacheDir = os.environ.get("LIBP_CACHE_DIR")
+  os.environ["LIBP_CACHE_DIR"] = cacheDir
+
+  settings = ellipticSettings(element=12,data_file=ellipticData3D,dim=3,
+                              precon="MULTIGRID",
+                              ax_kernel_tuning="TRUE")
+
+  failCount = 0
+  failCount += test(name="testEllipticHex_C0_Registry_Record",
+                    cmd=ellipticBin,
+                    settings=settings,
+                    referenceNorm=0.353553400508458)
+  Nrecorded = registryEntries(cacheDir)
+
+  failCount += test(name="testEllipticHex_C0_Registry_Lookup",
+                    cmd=ellipticBin,
+                    settings=settings,
+                    referenceNorm=0.353553400508458)
+  Nlookup = registryEntries(cacheDir)
+
+  name = "testEllipticHex_C0_Registry_Entries"
+  print(bcolors.TEST + f"{name:.<{alignWidth}}" + bcolors.ENDC, end="", flush=True)
+  if Nrecorded>0 and Nlookup==Nrecorded:
+    print(bcolors.PASS + "PASS" + bcolors.ENDC)
+  else:
+    print(bcolors.FAIL + "FAIL" + bcolors.ENDC)
+    print(bcolors.WARNING + "Registry entries after first run: " + str(Nrecorded) + bcolors.ENDC)
+    print(bcolors.WARNING + "Registry entries after second run: " + str(Nlookup) + bcolors.ENDC)
+    failCount += 1
+
+  #clean up
+  if oldCacheDir is None:
+    del os.environ["LIBP_CACHE_DIR"]
+  else:
+    os.environ["LIBP_CACHE_DIR"] = oldCacheDir
+  shutil.rmtree(cacheDir, ignore_errors=True)
+
+  return failCount
+
 def main():
   failCount=0;
 
@@ -211,6 +277,27 @@ def main():
                     settings=ellipticSettings(element=12,data_file=ellipticData3D,dim=3,
                                               precon="MULTIGRID"),
                     referenceNorm=0.353553400508458)
+  failCount += test(name="testEllipticHex_C0_Multigrid_Tuned",
+                    cmd=ellipticBin,
+                    settings=ellipticSettings(element=12,data_file=ellipticData3D,dim=3,
+                                              precon="MULTIGRID",
+                                              ax_kernel_tuning="TRUE"),
+                    referenceNorm=0.353553400508458)
+  failCount += testRegistryRoundTrip()
+  failCount += test(name="testEllipticHex_C0_Multigrid_Single",
+                    cmd=ellipticBin,
+                    settings=ellipticSettings(element=12,data_file=ellipticData3D,dim=3,
+                                              precon="MULTIGRID",
+                                              precon_precision="SINGLE"),
+                    referenceNorm=0.353553400508458)
+  failCount += test(name="testEllipticHex_C0_Multigrid_Profiled",
+                    cmd=ellipticBin,
+                    settings=ellipticSettings(element=12,data_file=ellipticData3D,dim=3,
+                                              precon="MULTIGRID",
+                                              profiler="TRACE",
+                                              profiler_output_file=testDir + "/profile"),
+                    referenceNorm=0.353553400508458,
+                    ranks=2)
   failCount += test(name="testEllipticHex_C0_Semfem",
                     cmd=ellipticBin,
                     settings=ellipticSettings(element=12,data_file=ellipticData3D,dim=3,
@@ -431,7 +518,9 @@ def main():
 
   #clean up
   for file_name in os.listdir(testDir):
-    if file_name.endswith('.vtu'):
+    if file_name.endswith(('.vtu', '.pvtu', '.pvd')):
+      os.remove(testDir + "/" + file_name)
+    if file_name.startswith('profile') and file_name.endswith('.json'):
       os.remove(testDir + "/" + file_name)
 
   return failCount
@@ -27,6 +27,7 @@
 #####################################################################################
 
 from test import *
+import shutil
 
 gradientData2D = gradientDir + "/data/gradientCos2D.h"
 gradientData3D = gradientDir + "/data/gradientCos3D.h"
@@ -34,7 +35,10 @@ gradientData3D = gradientDir + "/data/gradientCos3D.h"
 def gradientSettings(rcformat="2.0", data_file=gradientData2D,
                      mesh="BOX", dim=2, element=4, nx=10, ny=10, nz=10, boundary_flag=1,
                      degree=4, thread_model=device, platform_number=0, device_number=0,
+                     kernel_build="SHARED", local_cache_dir=testDir + "/.occa_local",
                      paradogs_partitioning="NONE",
+                     partition_constraints="ELEMENTS",
+                     partitioned_mesh_output="NONE",
                      output_to_file="FALSE"):
   return [setting_t("FORMAT", rcformat),
           setting_t("DATA FILE", data_file),
@@ -49,7 +53,11 @@ def gradientSettings(rcformat="2.0", data_file=gradientData2D,
           setting_t("THREAD MODEL", thread_model),
           setting_t("PLATFORM NUMBER", platform_number),
           setting_t("DEVICE NUMBER", device_number),
+          setting_t("KERNEL BUILD", kernel_build),
+          setting_t("LOCAL CACHE DIR", local_cache_dir),
           setting_t("PARADOGS PARTITIONING", paradogs_partitioning),
+          setting_t("PARTITION CONSTRAINTS", partition_constraints),
+          setting_t("PARTITIONED MESH OUTPUT", partitioned_mesh_output),
           setting_t("OUTPUT TO FILE", output_to_file)]
 
 def main():
@@ -75,10 +83,25 @@ def main():
                     settings=gradientSettings(element=12,data_file=gradientData3D,dim=3),
                     referenceNorm=12.1673360264757)
 
+  failCount += test(name="testGradientQuad_NodeBuild",
+                    cmd=gradientBin,
+                    settings=gradientSettings(element=4,data_file=gradientData2D,dim=2,
+                                              kernel_build="NODE"),
+                    referenceNorm=4.44288293763069,
+                    ranks=2)
+
+  failCount += test(name="testGradientQuad_BroadcastBuild",
+                    cmd=gradientBin,
+                    settings=gradientSettings(element=4,data_file=gradientData2D,dim=2,
+                                              kernel_build="BROADCAST"),
+                    referenceNorm=4.44288293763069,
+                    ranks=2)
+
   #clean up
   for file_name in os.listdir(testDir):
-    if file_name.endswith('.vtu'):
+    if file_name.endswith(('.vtu', '.pvtu', '.pvd')):
       os.remove(testDir + "/" + file_name)
+  shutil.rmtree(testDir + "/.occa_local", ignore_errors=True)
 
   return failCount
 
@@ -117,6 +117,20 @@ def main():
                                          nx=6, ny=6, nz=6, degree=2),
                     referenceNorm=1.19564704164048)
 
+  #block BPCG velocity solves
+  failCount += test(name="testInsTri_BPCG",
+                    cmd=insBin,
+                    settings=insSettings(element=3,data_file=insData2D,dim=2,
+                                         velocity_linear_solver="BPCG"),
+                    referenceNorm=0.821033993848522)
+
+  failCount += test(name="testInsHex_BPCG",
+                    cmd=insBin,
+                    settings=insSettings(element=12,data_file=insData3D,dim=3,
+                                         nx=6, ny=6, nz=6, degree=2,
+                                         velocity_linear_solver="BPCG"),
+                    referenceNorm=1.19564704164048)
+
   #test cubature
   failCount += test(name="testInsTri_cub",
                     cmd=insBin,
@@ -210,7 +224,7 @@ def main():
 
   #clean up
   for file_name in os.listdir(testDir):
-    if file_name.endswith('.vtu'):
+    if file_name.endswith(('.vtu', '.pvtu', '.pvd')):
       os.remove(testDir + "/" + file_name)
 
   return failCount
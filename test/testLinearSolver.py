@@ -29,6 +29,30 @@
 from test import *
 from testElliptic import *
 
+def testBlock(name, cmd, settings, referenceNorms, ranks=1):
+  #check the norm of every solution of a block solve, in order
+
+  #print test name
+  print(bcolors.TEST + f"{name:.<{alignWidth}}" + bcolors.ENDC, end="", flush=True)
+
+  run = runSetup(cmd, settings, ranks)
+  if runNorm(name, run, settings) is None:
+    return 1
+
+  lines = run.stdout.decode().splitlines()
+  norms = [float(line.split()[3]) for line in lines if "Solution norm = " in line]
+  if len(norms)==len(referenceNorms) and \
+     all(abs(norm - referenceNorm) < TOL for norm, referenceNorm in zip(norms, referenceNorms)):
+    print(bcolors.PASS + "PASS" + bcolors.ENDC)
+    return 0
+
+  print(bcolors.FAIL + "FAIL" + bcolors.ENDC)
+  print(bcolors.WARNING + "Expected Result: " + str(referenceNorms) + bcolors.ENDC)
+  print(bcolors.WARNING + "Observed Result: " + str(norms) + bcolors.ENDC)
+  #save the setup for reproducibility
+  writeSetup(name,settings)
+  return 1
+
 def main():
   failCount=0;
 
@@ -56,6 +80,42 @@ def main():
                                               precon="NONE", linear_solver="NBFPCG"),
                     referenceNorm=0.500000001211135)
 
+  failCount += test(name="testLinearSolver_PIPECG",
+                    cmd=ellipticBin,
+                    settings=ellipticSettings(element=3,data_file=ellipticData2D,dim=2,
+                                              precon="NONE", linear_solver="PIPECG"),
+                    referenceNorm=0.500000001211135)
+
+  failCount += test(name="testLinearSolver_BPCG",
+                    cmd=ellipticBin,
+                    settings=ellipticSettings(element=3,data_file=ellipticData2D,dim=2,
+                                              precon="NONE", linear_solver="BPCG"),
+                    referenceNorm=0.500000001211135)
+
+  # the first rhs of a block is zero, and is frozen from the start
+  failCount += testBlock(name="testLinearSolver_BPCG_block",
+                         cmd=ellipticBin,
+                         settings=ellipticSettings(element=3,data_file=ellipticData2D,dim=2,
+                                                   precon="NONE", linear_solver="BPCG")
+                                  + [setting_t("NUMBER OF RHS", 3)],
+                         referenceNorms=[0.0, 0.500000001211135, 0.500000001211135])
+
+  failCount += testBlock(name="testLinearSolver_BPCG_block_Jacobi_MPI", ranks=4,
+                         cmd=ellipticBin,
+                         settings=ellipticSettings(element=3,data_file=ellipticData2D,dim=2,
+                                                   precon="JACOBI", linear_solver="BPCG")
+                                  + [setting_t("NUMBER OF RHS", 4)],
+                         referenceNorms=[0.0] + 3*[0.500000001211135])
+
+  # no block Ax kernel for IPDG, the operator is applied per rhs
+  failCount += testBlock(name="testLinearSolver_BPCG_block_Ipdg",
+                         cmd=ellipticBin,
+                         settings=ellipticSettings(element=3,data_file=ellipticData2D,dim=2,
+                                                   precon="JACOBI", linear_solver="BPCG",
+                                                   discretization="IPDG")
+                                  + [setting_t("NUMBER OF RHS", 2)],
+                         referenceNorms=[0.0, 0.500000001211135])
+
   failCount += test(name="testLinearSolver_PGMRES",
                     cmd=ellipticBin,
                     settings=ellipticSettings(element=3,data_file=ellipticData2D,dim=2,
@@ -113,6 +113,36 @@ def main():
                                               mesh=testDir+"/cubeHex.msh"),
                     referenceNorm=0.942816869518335)
 
+  failCount += test(name="testMeshTri_ReadMshBinary_MPI", ranks=2,
+                    cmd=gradientBin,
+                    settings=gradientSettings(element=3,data_file=gradientData2D,dim=2,
+                                              mesh=testDir+"/squareTriBinary.msh"),
+                    referenceNorm=0.580787485719841)
+
+  failCount += test(name="testMeshHex_ReadMshBinary_MPI", ranks=2,
+                    cmd=gradientBin,
+                    settings=gradientSettings(element=12,data_file=gradientData3D,dim=3,
+                                              mesh=testDir+"/cubeHexBinary.msh"),
+                    referenceNorm=0.942816869518335)
+
+  failCount += test(name="testMeshTet_SavePartitioned_MPI", ranks=2,
+                    cmd=gradientBin,
+                    settings=gradientSettings(element=6,data_file=gradientData3D,dim=3,
+                                              mesh=testDir+"/cubeTet.msh",
+                                              partitioned_mesh_output="cubeTet.pmsh"),
+                    referenceNorm=0.942816947760423)
+
+  failCount += test(name="testMeshTet_LoadPartitioned_MPI", ranks=2,
+                    cmd=gradientBin,
+                    settings=gradientSettings(element=6,data_file=gradientData3D,dim=3,
+                                              mesh="cubeTet.pmsh"),
+                    referenceNorm=0.942816947760423)
+
+  #clean up
+  for file_name in os.listdir(testDir):
+    if file_name.endswith('.pmsh'):
+      os.remove(testDir + "/" + file_name)
+
   return failCount
 
 if __name__ == "__main__":
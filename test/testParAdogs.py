@@ -29,6 +29,41 @@
 from test import *
 from testGradient import *
 
+def testConstraints(name, cmd, settings, referenceNorm, maxImbalance, maxHaloFaces, ranks=1):
+  #check the norm, the max/avg imbalance of each balance constraint, and
+  # the total halo faces printed in the paradogs partitioning report
+
+  #print test name
+  print(bcolors.TEST + f"{name:.<{alignWidth}}" + bcolors.ENDC, end="", flush=True)
+
+  run = runSetup(cmd, settings, ranks)
+  norm = runNorm(name, run, settings)
+  if norm is None:
+    return 1
+
+  lines = run.stdout.decode().splitlines()
+  imbalances = [float(line.split()[4]) for line in lines if "imbalance (max/avg):" in line]
+  if len(imbalances)==0 or max(imbalances) > maxImbalance:
+    print(bcolors.FAIL + "FAIL" + bcolors.ENDC)
+    print(bcolors.WARNING + "Expected Constraint Imbalance: <= " + str(maxImbalance) + bcolors.ENDC)
+    print(bcolors.WARNING + "Observed Constraint Imbalance: " + str(imbalances) + bcolors.ENDC)
+    #save the setup for reproducibility
+    writeSetup(name,settings)
+    return 1
+
+  #first row of the report table: Nranks | Elements | Per Rank | Halo Faces | ...
+  rows = [line.split('|') for line in lines if line.count('|')==5]
+  haloFaces = [int(row[3]) for row in rows if row[0].strip().isdigit()]
+  if len(haloFaces)==0 or max(haloFaces) > maxHaloFaces:
+    print(bcolors.FAIL + "FAIL" + bcolors.ENDC)
+    print(bcolors.WARNING + "Expected Halo Faces: <= " + str(maxHaloFaces) + bcolors.ENDC)
+    print(bcolors.WARNING + "Observed Halo Faces: " + str(haloFaces) + bcolors.ENDC)
+    #save the setup for reproducibility
+    writeSetup(name,settings)
+    return 1
+
+  return checkNorm(name, settings, norm, referenceNorm, TOL)
+
 def main():
   failCount=0;
 
@@ -88,6 +123,29 @@ def main():
                                               paradogs_partitioning="SPECTRAL"),
                     referenceNorm=0.942816869518335)
 
+  # squarePMLQuad.msh has a PML layer on one side only, so an element count
+  # balanced split leaves both the interior and PML elements imbalanced. A
+  # single straight cut across the 14 columns balances both with 28 halo faces
+  failCount += testConstraints(name="testParAdogsQuad_InertialPML_MPI", ranks=2,
+                               cmd=gradientBin,
+                               settings=gradientSettings(element=4,data_file=gradientData2D,dim=2,
+                                                         mesh=testDir+"/squarePMLQuad.msh",
+                                                         paradogs_partitioning="INERTIAL",
+                                                         partition_constraints="PML"),
+                               referenceNorm=0.834306992968855,
+                               maxImbalance=1.1,
+                               maxHaloFaces=28)
+
+  failCount += testConstraints(name="testParAdogsQuad_SpectralPML_MPI", ranks=2,
+                               cmd=gradientBin,
+                               settings=gradientSettings(element=4,data_file=gradientData2D,dim=2,
+                                                         mesh=testDir+"/squarePMLQuad.msh",
+                                                         paradogs_partitioning="SPECTRAL",
+                                                         partition_constraints="PML"),
+                               referenceNorm=0.834306992968855,
+                               maxImbalance=1.1,
+                               maxHaloFaces=28)
+
   return failCount
 
 if __name__ == "__main__":
@@ -64,6 +64,15 @@ def main():
                                               paralmond_smoother="CHEBYSHEV"),
                     referenceNorm=0.500000001211135)
 
+  failCount += test(name="testParAlmond_Vcycle_cheby_single",
+                    cmd=ellipticBin,
+                    settings=ellipticSettings(element=3,data_file=ellipticData2D,
+                                              dim=2, precon="PARALMOND",
+                                              precon_precision="SINGLE",
+                                              paralmond_cycle="VCYCLE",
+                                              paralmond_smoother="CHEBYSHEV"),
+                    referenceNorm=0.500000001211135)
+
   failCount += test(name="testParAlmond_Vcycle_cheby_MPI", ranks=4,
                     cmd=ellipticBin,
                     settings=ellipticSettings(element=3,data_file=ellipticData2D,
@@ -100,6 +109,64 @@ def main():
                                               paralmond_smoother="CHEBYSHEV"),
                     referenceNorm=0.500000001211135)
 
+  # sparse direct coarse solver
+  failCount += test(name="testParAlmond_Vcycle_direct",
+                    cmd=ellipticBin,
+                    settings=ellipticSettings(element=3,data_file=ellipticData2D,
+                                              dim=2, precon="PARALMOND",
+                                              paralmond_cycle="VCYCLE",
+                                              paralmond_smoother="CHEBYSHEV",
+                                              paralmond_coarse_solver="DIRECT",
+                                              paralmond_coarse_size=100),
+                    referenceNorm=0.500000001211135)
+
+  # coarse level agglomeration
+  failCount += test(name="testParAlmond_Vcycle_agglomerated_MPI", ranks=4,
+                    cmd=ellipticBin,
+                    settings=ellipticSettings(element=3,data_file=ellipticData2D,
+                                              dim=2, precon="PARALMOND",
+                                              paralmond_cycle="VCYCLE",
+                                              paralmond_smoother="CHEBYSHEV",
+                                              paralmond_coarse_solver="DIRECT",
+                                              paralmond_coarse_size=100,
+                                              paralmond_agglomeration_size=200),
+                    referenceNorm=0.500000001211135)
+
+  # numeric update of the hierarchy after a lambda change
+  failCount += test(name="testParAlmond_Vcycle_update",
+                    cmd=ellipticBin,
+                    settings=ellipticSettings(element=3,data_file=ellipticData2D,
+                                              dim=2, precon="PARALMOND",
+                                              paralmond_cycle="VCYCLE",
+                                              paralmond_smoother="CHEBYSHEV")
+                             + [setting_t("LAMBDA", 0.5),
+                                setting_t("LAMBDA UPDATE", 1.0)],
+                    referenceNorm=0.500000001211135)
+
+  failCount += test(name="testParAlmond_Kcycle_smoothed_update_MPI", ranks=4,
+                    cmd=ellipticBin,
+                    settings=ellipticSettings(element=3,data_file=ellipticData2D,
+                                              dim=2, precon="PARALMOND",
+                                              paralmond_cycle="KCYCLE",
+                                              paralmond_aggregation="SMOOTHED",
+                                              paralmond_smoother="CHEBYSHEV")
+                             + [setting_t("LAMBDA", 0.5),
+                                setting_t("LAMBDA UPDATE", 1.0)],
+                    referenceNorm=0.500000001211135)
+
+  failCount += test(name="testParAlmond_Vcycle_agglomerated_update_MPI", ranks=4,
+                    cmd=ellipticBin,
+                    settings=ellipticSettings(element=3,data_file=ellipticData2D,
+                                              dim=2, precon="PARALMOND",
+                                              paralmond_cycle="VCYCLE",
+                                              paralmond_smoother="CHEBYSHEV",
+                                              paralmond_coarse_solver="DIRECT",
+                                              paralmond_coarse_size=100,
+                                              paralmond_agglomeration_size=200)
+                             + [setting_t("LAMBDA", 0.5),
+                                setting_t("LAMBDA UPDATE", 1.0)],
+                    referenceNorm=0.500000001211135)
+
   return failCount
 
 if __name__ == "__main__":
@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+
+#####################################################################################
+#
+#The MIT License (MIT)
+#
+#Copyright (c) 2017-2022 Tim Warburton, Noel Chalmers, Jesse Chan, Ali Karakus
+#
+#Permission is hereby granted, free of charge, to any person obtaining a copy
+#of this software and associated documentation files (the "Software"), to deal
+#in the Software without restriction, including without limitation the rights
+#to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+#copies of the Software, and to permit persons to whom the Software is
+#furnished to do so, subject to the following conditions:
+#
+#The above copyright notice and this permission notice shall be included in all
+#copies or substantial portions of the Software.
+#
+#THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+#AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+#OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+#SOFTWARE.
+#
+#####################################################################################
+
+from test import *
+
+SWEData2D = SWEDir + "/data/SWEAnalytic2D.h"
+SWEDamData2D = SWEDir + "/data/SWEAVCircularDam2D.h"
+
+def SWESettings(rcformat="2.0", data_file=SWEData2D,
+                mesh="BOX", dim=2, element=3, nx=10, ny=10, nz=10,
+                global_nx=0, global_ny=0, boundary_flag=1,
+                degree=4, thread_model=device, platform_number=0, device_number=0,
+                advection_type="COLLOCATION", viscosity_type="NONE",
+                time_integrator="LSERK4", cfl=0.5, start_time=0.0, final_time=0.5,
+                time_step_update_interval=0,
+                rebalance_interval=0, rebalance_tolerance=1.1, rebalance_margin=0.05,
+                output_interval=0.1, output_to_file="FALSE"):
+  return [setting_t("FORMAT", rcformat),
+          setting_t("DATA FILE", data_file),
+          setting_t("MESH FILE", mesh),
+          setting_t("MESH DIMENSION", dim),
+          setting_t("ELEMENT TYPE", element),
+          setting_t("BOX NX", nx),
+          setting_t("BOX NY", ny),
+          setting_t("BOX NZ", nz),
+          setting_t("BOX GLOBAL NX", global_nx),
+          setting_t("BOX GLOBAL NY", global_ny),
+          setting_t("BOX BOUNDARY FLAG", boundary_flag),
+          setting_t("POLYNOMIAL DEGREE", degree),
+          setting_t("THREAD MODEL", thread_model),
+          setting_t("PLATFORM NUMBER", platform_number),
+          setting_t("DEVICE NUMBER", device_number),
+          setting_t("ADVECTION TYPE", advection_type),
+          setting_t("VISCOSITY TYPE", viscosity_type),
+          setting_t("TIME INTEGRATOR", time_integrator),
+          setting_t("CFL NUMBER", cfl),
+          setting_t("START TIME", start_time),
+          setting_t("FINAL TIME", final_time),
+          setting_t("TIME STEP UPDATE INTERVAL", time_step_update_interval),
+          setting_t("REBALANCE INTERVAL", rebalance_interval),
+          setting_t("REBALANCE TOLERANCE", rebalance_tolerance),
+          setting_t("REBALANCE MARGIN", rebalance_margin),
+          setting_t("OUTPUT INTERVAL", output_interval),
+          setting_t("OUTPUT TO FILE", output_to_file)]
+
+#CFL time step updates change the step size by a small amount on
+# this smooth solution, so the norm should agree with the fixed step
+# run to within the time integration error
+adaptiveTOL = 1.0e-4
+
+def testRebalance(name, cmd, settings, referenceSettings, Nmigrations, ranks=1):
+  #compare against a run that never rebalances, and check the number of
+  # migrations reported, each of which must move some elements
+
+  #print test name
+  print(bcolors.TEST + f"{name:.<{alignWidth}}" + bcolors.ENDC, end="", flush=True)
+
+  referenceNorm = solutionNorm(name + "_reference", cmd, referenceSettings, ranks)
+  if referenceNorm is None:
+    return 1
+
+  run = runSetup(cmd, settings, ranks)
+  norm = runNorm(name, run, settings)
+  if norm is None:
+    return 1
+
+  lines = run.stdout.decode().splitlines()
+  moved = [int(line.split()[2]) for line in lines if "Rebalancing migrated" in line]
+  if len(moved)!=Nmigrations or any(n<=0 for n in moved):
+    print(bcolors.FAIL + "FAIL" + bcolors.ENDC)
+    print(bcolors.WARNING + "Expected Migrations: " + str(Nmigrations) + bcolors.ENDC)
+    print(bcolors.WARNING + "Observed Elements Migrated: " + str(moved) + bcolors.ENDC)
+    #save the setup for reproducibility
+    writeSetup(name,settings)
+    return 1
+
+  return checkNorm(name, settings, norm, referenceNorm, TOL)
+
+def main():
+  failCount=0;
+
+  failCount += testCompare(name="testSWETri_ab3_adaptive",
+                           cmd=SWEBin,
+                           settings=SWESettings(time_integrator="AB3", cfl=0.25,
+                                                time_step_update_interval=1),
+                           referenceSettings=SWESettings(time_integrator="AB3", cfl=0.25),
+                           tol=adaptiveTOL)
+
+  failCount += testCompare(name="testSWETri_lserk4_adaptive",
+                           cmd=SWEBin,
+                           settings=SWESettings(time_integrator="LSERK4",
+                                                time_step_update_interval=5),
+                           referenceSettings=SWESettings(time_integrator="LSERK4"),
+                           tol=adaptiveTOL)
+
+  failCount += testCompare(name="testSWETri_ssprk2_adaptive_MPI", ranks=2,
+                           cmd=SWEBin,
+                           settings=SWESettings(time_integrator="SSPRK2", cfl=0.25,
+                                                time_step_update_interval=5),
+                           referenceSettings=SWESettings(time_integrator="SSPRK2", cfl=0.25),
+                           tol=adaptiveTOL)
+
+  #the circular dam sets its initial depth from the element flags the
+  # mesh computes, which must also be there on quadrilaterals. The
+  # viscosity and its smoothing only read halo data, so the norm should
+  # not depend on the partition
+  failCount += testCompare(name="testSWEQuad_AVCircularDam_MPI", ranks=2,
+                           cmd=SWEBin,
+                           settings=SWESettings(element=4, data_file=SWEDamData2D,
+                                                global_nx=16, global_ny=16,
+                                                viscosity_type="ARTIFICIAL",
+                                                time_integrator="DOPRI5",
+                                                cfl=0.1, final_time=0.1),
+                           referenceSettings=SWESettings(element=4, data_file=SWEDamData2D,
+                                                         global_nx=16, global_ny=16,
+                                                         viscosity_type="ARTIFICIAL",
+                                                         time_integrator="DOPRI5",
+                                                         cfl=0.1, final_time=0.1))
+
+  #a 9x9 box split over two ranks gives 5 and 4 element columns, a cost
+  # imbalance of 45/40.5=1.11. A tolerance of 1.05 triggers exactly one
+  # repartition, which brings the imbalance to about 1.01 for the later
+  # windows. The reference integrates over the same windows but never
+  # rebalances, so the norms only differ by round-off
+  failCount += testRebalance(name="testSWEQuad_rebalance_MPI", ranks=2,
+                             cmd=SWEBin,
+                             settings=SWESettings(element=4, global_nx=9, global_ny=9,
+                                                  time_integrator="DOPRI5",
+                                                  rebalance_interval=0.1,
+                                                  rebalance_tolerance=1.05),
+                             referenceSettings=SWESettings(element=4, global_nx=9, global_ny=9,
+                                                           time_integrator="DOPRI5",
+                                                           rebalance_interval=0.1,
+                                                           rebalance_tolerance=100.0),
+                             Nmigrations=1)
+
+  failCount += testRebalance(name="testSWETri_rebalance_MPI", ranks=2,
+                             cmd=SWEBin,
+                             settings=SWESettings(element=3, global_nx=9, global_ny=9,
+                                                  advection_type="CUBATURE",
+                                                  time_integrator="DOPRI5",
+                                                  rebalance_interval=0.1,
+                                                  rebalance_tolerance=1.05,
+                                                  output_to_file="TRUE"),
+                             referenceSettings=SWESettings(element=3, global_nx=9, global_ny=9,
+                                                           advection_type="CUBATURE",
+                                                           time_integrator="DOPRI5",
+                                                           rebalance_interval=0.1,
+                                                           rebalance_tolerance=100.0),
+                             Nmigrations=1)
+
+  #the same imbalance, but a repartition must gain more than it can, so
+  # no elements migrate
+  failCount += testRebalance(name="testSWEQuad_rebalanceMargin_MPI", ranks=2,
+                             cmd=SWEBin,
+                             settings=SWESettings(element=4, global_nx=9, global_ny=9,
+                                                  time_integrator="DOPRI5",
+                                                  rebalance_interval=0.1,
+                                                  rebalance_tolerance=1.05,
+                                                  rebalance_margin=0.5),
+                             referenceSettings=SWESettings(element=4, global_nx=9, global_ny=9,
+                                                           time_integrator="DOPRI5",
+                                                           rebalance_interval=0.1,
+                                                           rebalance_tolerance=100.0),
+                             Nmigrations=0)
+
+  #clean up
+  for file_name in os.listdir(testDir):
+    if file_name.endswith(('.vtu', '.pvtu', '.pvd')):
+      os.remove(testDir + "/" + file_name)
+
+  return failCount
+
+if __name__ == "__main__":
+  failCount=0;
+  failCount+=main()
+  sys.exit(failCount)
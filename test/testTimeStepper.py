@@ -112,6 +112,40 @@ def main():
                                          time_integrator="MRSAAB3", cfl=0.25),
                     referenceNorm=14.2550270959095)
 
+  #write checkpoints during a full run, then restart from the last one
+  failCount += test(name="testTimeStepper_ab3_checkpoint",
+                    cmd=advectionBin,
+                    settings=advectionSettings(element=3,data_file=advectionData2D,
+                                               dim=2, time_integrator="AB3", cfl=0.25)
+                             + [setting_t("CHECKPOINT INTERVAL", 10)],
+                    referenceNorm=0.723972801309193)
+
+  failCount += test(name="testTimeStepper_ab3_restart",
+                    cmd=advectionBin,
+                    settings=advectionSettings(element=3,data_file=advectionData2D,
+                                               dim=2, time_integrator="AB3", cfl=0.25)
+                             + [setting_t("RESTART FROM CHECKPOINT", "TRUE")],
+                    referenceNorm=0.723972801309193)
+
+  failCount += test(name="testTimeStepper_dopri5_checkpoint", ranks=4,
+                    cmd=advectionBin,
+                    settings=advectionSettings(element=3,data_file=advectionData2D,
+                                               dim=2, time_integrator="DOPRI5")
+                             + [setting_t("CHECKPOINT INTERVAL", 5)],
+                    referenceNorm=0.723627520020827)
+
+  failCount += test(name="testTimeStepper_dopri5_restart", ranks=4,
+                    cmd=advectionBin,
+                    settings=advectionSettings(element=3,data_file=advectionData2D,
+                                               dim=2, time_integrator="DOPRI5")
+                             + [setting_t("RESTART FROM CHECKPOINT", "TRUE")],
+                    referenceNorm=0.723627520020827)
+
+  #clean up
+  for file_name in os.listdir(testDir):
+    if file_name.endswith(('.chk', '.chk.tmp')):
+      os.remove(testDir + "/" + file_name)
+
   return failCount
 
 if __name__ == "__main__":
@@ -24,14 +24,21 @@ SOFTWARE.
 
 */
 
-#include "SWE.hpp"
+#include "mesh.hpp"
 
+using namespace libp;
+
+/*
+  Reads, partitions, and connects a mesh once and saves it as a .pmsh
+  partitioned mesh file set. Solvers run on the same number of ranks
+  can then set [MESH FILE] to the .pmsh file and skip all of that work.
+*/
 int main(int argc, char **argv){
 
   // start up MPI
   Comm::Init(argc, argv);
 
-  LIBP_ABORT("Usage: ./SWEMain setupfile", argc!=2);
+  LIBP_ABORT("Usage: ./meshPartitionMain setupfile", argc!=2);
 
   { /*Scope so everything is destructed before MPI_Finalize */
     comm_t comm(Comm::World().Dup());
@@ -39,26 +46,38 @@ int main(int argc, char **argv){
     //create default settings
     platformSettings_t platformSettings(comm);
     meshSettings_t meshSettings(comm);
-    SWESettings_t SWESettings(comm);
 
     //load settings from file
-    SWESettings.parseFromFile(platformSettings, meshSettings,
-                              argv[1]);
+    settings_t s(comm);
+    s.readSettingsFromFile(argv[1]);
+
+    for(auto it = s.settings.begin(); it != s.settings.end(); ++it) {
+      setting_t& set = it->second;
+      const std::string name = set.getName();
+      const std::string val = set.getVal<std::string>();
+      if (platformSettings.hasSetting(name))
+        platformSettings.changeSetting(name, val);
+      else if (meshSettings.hasSetting(name))
+        meshSettings.changeSetting(name, val);
+      else {
+        LIBP_FORCE_ABORT("Unknown setting: [" << name << "] requested");
+      }
+    }
+
+    LIBP_ABORT("Set [PARTITIONED MESH OUTPUT] to the name of the .pmsh file to write",
+               meshSettings.compareSetting("PARTITIONED MESH OUTPUT", "NONE"));
 
     // set up platform
     platform_t platform(platformSettings);
-    
+
     platformSettings.report();
     meshSettings.report();
-    SWESettings.report();
-    
-    // set up mesh
+
+    // set up mesh, which saves the partitioned mesh on completion
     mesh_t mesh(platform, meshSettings, comm);
-    
-    // set up SWE solver
-    SWE_t SWE(platform, mesh, SWESettings);
-    // run
-    SWE.Run();
+
+    //report the profile while every rank is still here, before teardown
+    Profiler::Finalize();
   }
 
   // close down MPI